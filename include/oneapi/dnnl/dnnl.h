@@ -2445,6 +2445,127 @@ dnnl_status_t DNNL_API dnnl_layer_normalization_backward_desc_init(
 
 /// @} dnnl_api_layer_normalization
 
+/// @addtogroup dnnl_api_layer_normalization_v2
+/// @{
+
+/// Initializes a descriptor for layer normalization v2 forward propagation
+/// primitive.
+///
+/// @note
+///     In-place operation is supported: the dst can refer to the same memory
+///     as the src.
+///
+/// @param lnrm_desc Output descriptor for layer normalization primitive.
+/// @param prop_kind Propagation kind. Possible values are
+///     #dnnl_forward_training and #dnnl_forward_inference.
+/// @param src_desc Source memory descriptor.
+/// @param dst_desc Destination memory descriptor.
+/// @param stat_desc Memory descriptor for mean and variance. If this
+///     parameter is NULL, a zero memory descriptor, or a memory descriptor
+///     with format_kind set to #dnnl_format_kind_undef, then the memory
+///     descriptor for stats is derived from @p src_desc by removing the last
+///     dimension.
+/// @param epsilon Layer normalization epsilon parameter.
+/// @param flags Layer normalization flags (@ref dnnl_normalization_flags_t).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_layer_normalization_v2_forward_desc_init(
+        dnnl_layer_normalization_v2_desc_t *lnrm_desc,
+        dnnl_prop_kind_t prop_kind, const dnnl_memory_desc_t *src_desc,
+        const dnnl_memory_desc_t *dst_desc,
+        const dnnl_memory_desc_t *stat_desc, float epsilon, unsigned flags);
+
+/// Initializes a descriptor for a layer normalization v2 backward propagation
+/// primitive.
+///
+/// @note
+///     In-place operation is supported: the diff_dst can refer to the same
+///     memory as the diff_src.
+///
+/// @param lnrm_desc Output descriptor for layer normalization primitive.
+/// @param prop_kind Propagation kind. Possible values are
+///     #dnnl_backward_data and #dnnl_backward (diffs for all parameters are
+///     computed in this case).
+/// @param diff_src_desc Diff source memory descriptor.
+/// @param diff_dst_desc Diff destination memory descriptor.
+/// @param src_desc Source memory descriptor.
+/// @param stat_desc Memory descriptor for mean and variance. If this
+///     parameter is NULL, a zero memory descriptor, or a memory descriptor
+///     with format_kind set to #dnnl_format_kind_undef, then the memory
+///     descriptor for stats is derived from @p src_desc by removing the last
+///     dimension.
+/// @param epsilon Layer normalization epsilon parameter.
+/// @param flags Layer normalization flags (@ref dnnl_normalization_flags_t).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_layer_normalization_v2_backward_desc_init(
+        dnnl_layer_normalization_v2_desc_t *lnrm_desc,
+        dnnl_prop_kind_t prop_kind, const dnnl_memory_desc_t *diff_src_desc,
+        const dnnl_memory_desc_t *diff_dst_desc,
+        const dnnl_memory_desc_t *src_desc,
+        const dnnl_memory_desc_t *stat_desc, float epsilon, unsigned flags);
+
+/// @} dnnl_api_layer_normalization_v2
+
+/// @addtogroup dnnl_api_group_normalization
+/// @{
+
+/// Initializes a descriptor for group normalization forward propagation
+/// primitive.
+///
+/// @note
+///     In-place operation is supported: the dst can refer to the same memory
+///     as the src.
+///
+/// @param gnrm_desc Output descriptor for group normalization primitive.
+/// @param prop_kind Propagation kind. Possible values are
+///     #dnnl_forward_training and #dnnl_forward_inference.
+/// @param src_desc Source memory descriptor.
+/// @param dst_desc Destination memory descriptor.
+/// @param groups Number of groups the channels are split into. Must divide
+///     the number of channels.
+/// @param epsilon Group normalization epsilon parameter.
+/// @param flags Group normalization flags (@ref dnnl_normalization_flags_t).
+///     Possible values are #dnnl_use_global_stats, #dnnl_use_scale, and
+///     #dnnl_use_shift.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_group_normalization_forward_desc_init(
+        dnnl_group_normalization_desc_t *gnrm_desc, dnnl_prop_kind_t prop_kind,
+        const dnnl_memory_desc_t *src_desc, const dnnl_memory_desc_t *dst_desc,
+        dnnl_dim_t groups, float epsilon, unsigned flags);
+
+/// Initializes a descriptor for a group normalization backward propagation
+/// primitive.
+///
+/// @note
+///     In-place operation is supported: the diff_dst can refer to the same
+///     memory as the diff_src.
+///
+/// @param gnrm_desc Output descriptor for group normalization primitive.
+/// @param prop_kind Propagation kind. Possible values are
+///     #dnnl_backward_data and #dnnl_backward (diffs for all parameters are
+///     computed in this case).
+/// @param diff_src_desc Diff source memory descriptor.
+/// @param diff_dst_desc Diff destination memory descriptor.
+/// @param src_desc Source memory descriptor.
+/// @param groups Number of groups the channels are split into. Must divide
+///     the number of channels.
+/// @param epsilon Group normalization epsilon parameter.
+/// @param flags Group normalization flags (@ref dnnl_normalization_flags_t).
+///     Possible values are #dnnl_use_global_stats, #dnnl_use_scale, and
+///     #dnnl_use_shift.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_group_normalization_backward_desc_init(
+        dnnl_group_normalization_desc_t *gnrm_desc, dnnl_prop_kind_t prop_kind,
+        const dnnl_memory_desc_t *diff_src_desc,
+        const dnnl_memory_desc_t *diff_dst_desc,
+        const dnnl_memory_desc_t *src_desc, dnnl_dim_t groups, float epsilon,
+        unsigned flags);
+
+/// @} dnnl_api_group_normalization
+
 /// @addtogroup dnnl_api_inner_product
 /// @{
 
@@ -2711,7 +2832,7 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_rnn_weights_projection_qparams(
 /// @param dst_layer_desc Memory descriptor for the output vector.
 /// @param dst_iter_desc Memory descriptor for the output recurrent hidden
 ///     state vector.
-/// @param flags Unused.
+/// @param flags Flags, see #dnnl_rnn_flags_t.
 /// @param alpha Negative slope if activation is #dnnl_eltwise_relu.
 /// @param beta Unused.
 /// @returns #dnnl_success on success and a status describing the error
@@ -2772,7 +2893,7 @@ dnnl_status_t DNNL_API dnnl_vanilla_rnn_forward_desc_init(
 ///     vector.
 /// @param diff_dst_iter_desc Memory descriptor for the diff of output
 ///     recurrent hidden state vector.
-/// @param flags Unused.
+/// @param flags Flags, see #dnnl_rnn_flags_t.
 /// @param alpha Negative slope if activation is #dnnl_eltwise_relu.
 /// @param beta Unused.
 /// @returns #dnnl_success on success and a status describing the error
@@ -2836,7 +2957,7 @@ dnnl_status_t DNNL_API dnnl_vanilla_rnn_backward_desc_init(
 ///     state vector.
 /// @param dst_iter_c_desc Memory descriptor for the output recurrent cell
 ///     state vector.
-/// @param flags Unused.
+/// @param flags Flags, see #dnnl_rnn_flags_t.
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_lstm_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
@@ -2893,7 +3014,7 @@ dnnl_status_t DNNL_API dnnl_lstm_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
 ///     state vector.
 /// @param dst_iter_c_desc Memory descriptor for the output recurrent cell
 ///     state vector.
-/// @param flags Unused.
+/// @param flags Flags, see #dnnl_rnn_flags_t.
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_lstm_forward_desc_init_v2(dnnl_rnn_desc_t *rnn_desc,
@@ -2955,7 +3076,7 @@ dnnl_status_t DNNL_API dnnl_lstm_forward_desc_init_v2(dnnl_rnn_desc_t *rnn_desc,
 ///     state vector.
 /// @param dst_iter_c_desc Memory descriptor for the output recurrent cell
 ///     state vector.
-/// @param flags Unused.
+/// @param flags Flags, see #dnnl_rnn_flags_t.
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_lstm_forward_desc_init_v3(dnnl_rnn_desc_t *rnn_desc,
@@ -3029,7 +3150,7 @@ dnnl_status_t DNNL_API dnnl_lstm_forward_desc_init_v3(dnnl_rnn_desc_t *rnn_desc,
 ///     recurrent hidden state vector.
 /// @param diff_dst_iter_c_desc Memory descriptor for the diff of output
 ///     recurrent cell state vector.
-/// @param flags Unused.
+/// @param flags Flags, see #dnnl_rnn_flags_t.
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_lstm_backward_desc_init(dnnl_rnn_desc_t *rnn_desc,
@@ -3114,7 +3235,7 @@ dnnl_status_t DNNL_API dnnl_lstm_backward_desc_init(dnnl_rnn_desc_t *rnn_desc,
 ///     recurrent hidden state vector.
 /// @param diff_dst_iter_c_desc Memory descriptor for the diff of output
 ///     recurrent cell state vector.
-/// @param flags Unused.
+/// @param flags Flags, see #dnnl_rnn_flags_t.
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_lstm_backward_desc_init_v2(
@@ -3210,7 +3331,7 @@ dnnl_status_t DNNL_API dnnl_lstm_backward_desc_init_v2(
 ///     recurrent hidden state vector.
 /// @param diff_dst_iter_c_desc Memory descriptor for the diff of output
 ///     recurrent cell state vector.
-/// @param flags Unused.
+/// @param flags Flags, see #dnnl_rnn_flags_t.
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_lstm_backward_desc_init_v3(
@@ -3270,7 +3391,7 @@ dnnl_status_t DNNL_API dnnl_lstm_backward_desc_init_v3(
 /// @param dst_layer_desc Memory descriptor for the output vector.
 /// @param dst_iter_desc Memory descriptor for the output recurrent hidden
 ///     state vector.
-/// @param flags Unused.
+/// @param flags Flags, see #dnnl_rnn_flags_t.
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_gru_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
@@ -3325,7 +3446,7 @@ dnnl_status_t DNNL_API dnnl_gru_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
 ///     vector.
 /// @param diff_dst_iter_desc Memory descriptor for the diff of output
 ///     recurrent hidden state vector.
-/// @param flags Unused.
+/// @param flags Flags, see #dnnl_rnn_flags_t.
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_gru_backward_desc_init(dnnl_rnn_desc_t *rnn_desc,
@@ -3372,7 +3493,7 @@ dnnl_status_t DNNL_API dnnl_gru_backward_desc_init(dnnl_rnn_desc_t *rnn_desc,
 /// @param dst_layer_desc Memory descriptor for the output vector.
 /// @param dst_iter_desc Memory descriptor for the output recurrent hidden
 ///     state vector.
-/// @param flags Unused.
+/// @param flags Flags, see #dnnl_rnn_flags_t.
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_lbr_gru_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
@@ -3427,7 +3548,7 @@ dnnl_status_t DNNL_API dnnl_lbr_gru_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
 ///     vector.
 /// @param diff_dst_iter_desc Memory descriptor for the diff of output
 ///     recurrent hidden state vector.
-/// @param flags Unused.
+/// @param flags Flags, see #dnnl_rnn_flags_t.
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_lbr_gru_backward_desc_init(
@@ -3480,7 +3601,7 @@ dnnl_status_t DNNL_API dnnl_lbr_gru_backward_desc_init(
 /// @param dst_layer_desc Memory descriptor for the output vector.
 /// @param dst_iter_desc Memory descriptor for the output recurrent hidden
 ///     state vector.
-/// @param flags Unused.
+/// @param flags Flags, see #dnnl_rnn_flags_t.
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_augru_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
@@ -3538,7 +3659,7 @@ dnnl_status_t DNNL_API dnnl_augru_forward_desc_init(dnnl_rnn_desc_t *rnn_desc,
 ///     vector.
 /// @param diff_dst_iter_desc Memory descriptor for the diff of output
 ///     recurrent hidden state vector.
-/// @param flags Unused.
+/// @param flags Flags, see #dnnl_rnn_flags_t.
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_augru_backward_desc_init(dnnl_rnn_desc_t *rnn_desc,
@@ -3588,7 +3709,7 @@ dnnl_status_t DNNL_API dnnl_augru_backward_desc_init(dnnl_rnn_desc_t *rnn_desc,
 /// @param dst_layer_desc Memory descriptor for the output vector.
 /// @param dst_iter_desc Memory descriptor for the output recurrent hidden
 ///     state vector.
-/// @param flags Unused.
+/// @param flags Flags, see #dnnl_rnn_flags_t.
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_lbr_augru_forward_desc_init(
@@ -3647,7 +3768,7 @@ dnnl_status_t DNNL_API dnnl_lbr_augru_forward_desc_init(
 ///     vector.
 /// @param diff_dst_iter_desc Memory descriptor for the diff of output
 ///     recurrent hidden state vector.
-/// @param flags Unused.
+/// @param flags Flags, see #dnnl_rnn_flags_t.
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_lbr_augru_backward_desc_init(
@@ -3752,7 +3873,9 @@ dnnl_status_t DNNL_API dnnl_resampling_backward_desc_init(
 ///     #dnnl_reduction_max, #dnnl_reduction_min, #dnnl_reduction_sum,
 ///     #dnnl_reduction_mul, #dnnl_reduction_mean, #dnnl_reduction_norm_lp_max,
 ///     #dnnl_reduction_norm_lp_sum, #dnnl_reduction_norm_lp_power_p_max,
-///     #dnnl_reduction_norm_lp_power_p_sum.
+///     #dnnl_reduction_norm_lp_power_p_sum, #dnnl_reduction_argmax,
+///     #dnnl_reduction_argmin. The index-producing algorithms require
+///     destination of #dnnl_s32 data type.
 /// @param p Algorithm specific parameter.
 /// @param eps Algorithm specific parameter.
 /// @param src_desc Source memory descriptor.
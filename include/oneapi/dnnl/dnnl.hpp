@@ -315,6 +315,10 @@ struct primitive : public handle<dnnl_primitive_t> {
         prelu = dnnl_prelu,
         /// A softmax version 2 primitive.
         softmax_v2 = dnnl_softmax_v2,
+        /// A layer normalization version 2 primitive.
+        layer_normalization_v2 = dnnl_layer_normalization_v2,
+        /// A group normalization primitive.
+        group_normalization = dnnl_group_normalization,
     };
 
     using handle::handle;
@@ -679,6 +683,10 @@ enum class algorithm {
     reduction_norm_lp_power_p_max = dnnl_reduction_norm_lp_power_p_max,
     /// Reduction using norm_lp_power_p_sum operation
     reduction_norm_lp_power_p_sum = dnnl_reduction_norm_lp_power_p_sum,
+    /// Reduction producing the index of the maximal element
+    reduction_argmax = dnnl_reduction_argmax,
+    /// Reduction producing the index of the minimal element
+    reduction_argmin = dnnl_reduction_argmin,
     /// Softmax, numerically stable
     softmax_accurate = dnnl_softmax_accurate,
     /// LogSoftmax, numerically stable
@@ -736,6 +744,11 @@ enum class normalization_flags : unsigned {
     /// input on forward propagation. On backward propagation of type
     /// #dnnl::prop_kind::backward, the library computes its derivative.
     use_shift = dnnl_use_shift,
+
+    /// Use Root Mean Square (RMS) normalization. If specified, the mean is not
+    /// subtracted from the source and the variance is computed as the mean of
+    /// squared source values. Supported by layer normalization only.
+    rms_norm = dnnl_rms_norm,
 };
 
 /// Converts normalization flags enum value from C++ API to C API type.
@@ -753,7 +766,10 @@ inline dnnl_normalization_flags_t convert_to_c(normalization_flags flags) {
 /// RNN cell flags.
 enum class rnn_flags : unsigned {
     /// Undefined RNN flags
-    undef = dnnl_rnn_flags_undef
+    undef = dnnl_rnn_flags_undef,
+    /// Sequences of the minibatch have different lengths, passed at
+    /// execution time as #DNNL_ARG_SEQ_LENGTHS
+    variable_seq_lengths = dnnl_rnn_flags_variable_seq_lengths
 };
 
 /// Converts RNN cell flags enum value from C++ API to C API type.
@@ -852,7 +868,7 @@ enum class query {
     /// number of outputs expected
     num_of_outputs_s32 = dnnl_query_num_of_outputs_s32,
 
-    /// runtime estimation (seconds), unimplemented
+    /// runtime estimation (seconds), implemented for CPU convolutions
     time_estimate_f64 = dnnl_query_time_estimate_f64,
     /// memory required for scratchpad (bytes)
     ///
@@ -8164,6 +8180,652 @@ struct layer_normalization_backward : public primitive {
 
 /// @} dnnl_api_layer_normalization
 
+/// @addtogroup dnnl_api_layer_normalization_v2 Layer Normalization v2
+///
+/// A primitive to perform layer normalization. Normalization is performed
+/// within the last logical dimension of data tensor. Unlike
+/// @ref dnnl_api_layer_normalization, source and destination (and their
+/// gradients) are described by separate memory descriptors, which makes it
+/// possible to, for example, normalize f32 data into an int8 destination.
+///
+/// @sa @ref dev_guide_layer_normalization in developer guide
+///
+/// @{
+
+/// Layer normalization v2 forward propagation primitive.
+struct layer_normalization_v2_forward : public primitive {
+    /// Descriptor for a layer normalization v2 forward propagation primitive.
+    struct desc {
+        dnnl_layer_normalization_v2_desc_t data;
+
+        /// Default constructor. Produces an empty object.
+        desc() = default;
+
+        /// Constructs a descriptor for layer normalization v2 forward
+        /// propagation primitive.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param stat_desc Statistics memory descriptors.
+        /// @param epsilon Layer normalization epsilon parameter.
+        /// @param flags Layer normalization flags (@ref
+        ///     dnnl::normalization_flags).
+        desc(prop_kind aprop_kind, const memory::desc &src_desc,
+                const memory::desc &dst_desc, const memory::desc &stat_desc,
+                float epsilon, normalization_flags flags) {
+            error::wrap_c_api(
+                    dnnl_layer_normalization_v2_forward_desc_init(&data,
+                            dnnl::convert_to_c(aprop_kind), &src_desc.data,
+                            &dst_desc.data, &stat_desc.data, epsilon,
+                            convert_to_c(flags)),
+                    "could not create a descriptor for a layer normalization "
+                    "v2 forward propagation primitive");
+        }
+
+        /// Constructs a descriptor for layer normalization v2 forward
+        /// propagation primitive.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param epsilon Layer normalization epsilon parameter.
+        /// @param flags Layer normalization flags (@ref
+        ///     dnnl::normalization_flags).
+        desc(prop_kind aprop_kind, const memory::desc &src_desc,
+                const memory::desc &dst_desc, float epsilon,
+                normalization_flags flags) {
+            error::wrap_c_api(
+                    dnnl_layer_normalization_v2_forward_desc_init(&data,
+                            dnnl::convert_to_c(aprop_kind), &src_desc.data,
+                            &dst_desc.data, nullptr, epsilon,
+                            convert_to_c(flags)),
+                    "could not create a descriptor for a layer normalization "
+                    "v2 forward propagation primitive");
+        }
+    };
+
+    /// Primitive descriptor for a layer normalization v2 forward propagation
+    /// primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a layer normalization v2
+        /// forward propagation primitive.
+        ///
+        /// @param adesc Descriptor for a layer normalization v2 forward
+        ///     propagation primitive.
+        /// @param aengine Engine to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const engine &aengine,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, nullptr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a layer normalization v2
+        /// forward propagation primitive.
+        ///
+        /// @param adesc Descriptor for a layer normalization v2 forward
+        ///     propagation primitive.
+        /// @param attr Primitive attributes to use.
+        /// @param aengine Engine to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const primitive_attr &attr,
+                const engine &aengine, bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, &attr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a layer normalization v2
+        /// forward propagation primitive from a C API primitive descriptor
+        /// that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a layer normalization v2
+        ///     forward propagation primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd,
+                    dnnl::primitive::kind::layer_normalization_v2,
+                    dnnl::prop_kind::forward_training,
+                    dnnl::prop_kind::forward_inference) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const { return base::weights_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::workspace_desc()const
+        memory::desc workspace_desc() const { return base::workspace_desc(); }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::mean_desc()const
+        memory::desc mean_desc() const { return stat_desc(mean); }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::variance_desc()const
+        memory::desc variance_desc() const { return stat_desc(var); }
+
+    private:
+        enum {
+            mean = 1,
+            var = 2,
+        };
+        memory::desc stat_desc(int kind) const {
+            dnnl_layer_normalization_v2_desc_t *p;
+            error::wrap_c_api(
+                    dnnl_primitive_desc_query(get(),
+                            dnnl_query_layer_normalization_v2_d, 0, &p),
+                    "could not retrieve a descriptor from a primitive "
+                    "descriptor for layer normalization v2 forward "
+                    "propagation primitive");
+            return query_md(p->flags & dnnl_use_global_stats ? query::src_md
+                                                             : query::dst_md,
+                    kind);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    layer_normalization_v2_forward() = default;
+
+    /// Constructs a layer normalization v2 forward propagation primitive.
+    /// @param pd Primitive descriptor for a layer normalization v2 forward
+    ///     propagation primitive.
+    layer_normalization_v2_forward(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a layer normalization v2 forward propagation primitive
+    ///     from a cache blob.
+    /// @param pd Primitive descriptor for a layer normalization v2 forward
+    ///     propagation primitive.
+    /// @param cache_blob Cache blob.
+    layer_normalization_v2_forward(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// Layer normalization v2 backward propagation primitive.
+struct layer_normalization_v2_backward : public primitive {
+    /// Descriptor for a layer normalization v2 backward propagation
+    /// primitive.
+    struct desc {
+        dnnl_layer_normalization_v2_desc_t data;
+
+        /// Default constructor. Produces an empty object.
+        desc() = default;
+
+        /// Constructs a descriptor for layer normalization v2 backward
+        /// propagation primitive.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::backward_data and #dnnl::prop_kind::backward
+        ///     (diffs for all parameters are computed in this case).
+        /// @param diff_src_desc Diff source memory descriptor.
+        /// @param diff_dst_desc Diff destination memory descriptor.
+        /// @param src_desc Source memory descriptor.
+        /// @param stat_desc Statistics memory descriptors.
+        /// @param epsilon Layer normalization epsilon parameter.
+        /// @param flags Layer normalization flags (@ref
+        ///     dnnl::normalization_flags).
+        desc(prop_kind aprop_kind, const memory::desc &diff_src_desc,
+                const memory::desc &diff_dst_desc, const memory::desc &src_desc,
+                const memory::desc &stat_desc, float epsilon,
+                normalization_flags flags) {
+            error::wrap_c_api(
+                    dnnl_layer_normalization_v2_backward_desc_init(&data,
+                            dnnl::convert_to_c(aprop_kind),
+                            &diff_src_desc.data, &diff_dst_desc.data,
+                            &src_desc.data, &stat_desc.data, epsilon,
+                            convert_to_c(flags)),
+                    "could not create a descriptor for a layer normalization "
+                    "v2 backward propagation primitive");
+        }
+
+        /// Constructs a descriptor for layer normalization v2 backward
+        /// propagation primitive.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::backward_data and #dnnl::prop_kind::backward
+        ///     (diffs for all parameters are computed in this case).
+        /// @param diff_src_desc Diff source memory descriptor.
+        /// @param diff_dst_desc Diff destination memory descriptor.
+        /// @param src_desc Source memory descriptor.
+        /// @param epsilon Layer normalization epsilon parameter.
+        /// @param flags Layer normalization flags (@ref
+        ///     dnnl::normalization_flags).
+        desc(prop_kind aprop_kind, const memory::desc &diff_src_desc,
+                const memory::desc &diff_dst_desc, const memory::desc &src_desc,
+                float epsilon, normalization_flags flags) {
+            error::wrap_c_api(
+                    dnnl_layer_normalization_v2_backward_desc_init(&data,
+                            dnnl::convert_to_c(aprop_kind),
+                            &diff_src_desc.data, &diff_dst_desc.data,
+                            &src_desc.data, nullptr, epsilon,
+                            convert_to_c(flags)),
+                    "could not create a descriptor for a layer normalization "
+                    "v2 backward propagation primitive");
+        }
+    };
+
+    /// Primitive descriptor for a layer normalization v2 backward propagation
+    /// primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a layer normalization v2
+        /// backward propagation primitive.
+        ///
+        /// @param adesc Descriptor for a layer normalization v2 backward
+        ///     propagation primitive.
+        /// @param aengine Engine to use.
+        /// @param hint_fwd_pd Primitive descriptor for a layer normalization
+        ///     v2 forward propagation primitive. It is used as a hint for
+        ///     deciding which memory format to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const engine &aengine,
+                const layer_normalization_v2_forward::primitive_desc
+                        &hint_fwd_pd,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(&adesc.data, nullptr, aengine,
+                    hint_fwd_pd.get(), allow_empty) {}
+
+        /// Constructs a primitive descriptor for a layer normalization v2
+        /// backward propagation primitive.
+        ///
+        /// @param adesc Descriptor for a layer normalization v2 backward
+        ///     propagation primitive.
+        /// @param attr Primitive attributes to use.
+        /// @param aengine Engine to use.
+        /// @param hint_fwd_pd Primitive descriptor for a layer normalization
+        ///     v2 forward propagation primitive. It is used as a hint for
+        ///     deciding which memory format to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const primitive_attr &attr,
+                const engine &aengine,
+                const layer_normalization_v2_forward::primitive_desc
+                        &hint_fwd_pd,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(&adesc.data, &attr, aengine,
+                    hint_fwd_pd.get(), allow_empty) {}
+
+        /// Constructs a primitive descriptor for a layer normalization v2
+        /// backward propagation primitive from a C API primitive descriptor
+        /// that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a layer normalization v2
+        ///     backward propagation primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd,
+                    dnnl::primitive::kind::layer_normalization_v2,
+                    dnnl::prop_kind::backward, dnnl::prop_kind::backward_data) {
+        }
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const { return base::weights_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_src_desc()const
+        memory::desc diff_src_desc() const { return base::diff_src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_dst_desc()const
+        memory::desc diff_dst_desc() const { return base::diff_dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_weights_desc()const
+        memory::desc diff_weights_desc() const {
+            return base::diff_weights_desc(0);
+        }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::mean_desc()const
+        memory::desc mean_desc() const { return query_md(query::src_md, 1); }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::variance_desc()const
+        memory::desc variance_desc() const {
+            return query_md(query::src_md, 2);
+        }
+
+        /// @copydoc dnnl::primitive_desc_base::workspace_desc()const
+        memory::desc workspace_desc() const { return base::workspace_desc(); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    layer_normalization_v2_backward() = default;
+
+    /// Constructs a layer normalization v2 backward propagation primitive.
+    /// @param pd Primitive descriptor for a layer normalization v2 backward
+    ///     propagation primitive.
+    layer_normalization_v2_backward(const primitive_desc &pd)
+        : primitive(pd) {}
+
+    /// Constructs a layer normalization v2 backward propagation primitive
+    ///     from a cache blob.
+    /// @param pd Primitive descriptor for a layer normalization v2 backward
+    ///     propagation primitive.
+    /// @param cache_blob Cache blob.
+    layer_normalization_v2_backward(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_layer_normalization_v2
+
+/// @addtogroup dnnl_api_group_normalization Group Normalization
+///
+/// A primitive to perform group normalization. Channels are split into
+/// groups and normalization is performed within each group over the channels
+/// of the group and all spatial dimensions, independently for each
+/// mini-batch element.
+///
+/// Both forward and backward propagation primitives support in-place
+/// operation; that is, src and dst can refer to the same memory for forward
+/// propagation, and diff_dst and diff_src can refer to the same memory for
+/// backward propagation.
+///
+/// @sa @ref dev_guide_group_normalization in developer guide
+///
+/// @{
+
+/// Group normalization forward propagation primitive.
+struct group_normalization_forward : public primitive {
+    /// Descriptor for a group normalization forward propagation primitive.
+    struct desc {
+        dnnl_group_normalization_desc_t data;
+
+        /// Default constructor. Produces an empty object.
+        desc() = default;
+
+        /// Constructs a descriptor for group normalization forward
+        /// propagation primitive.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training, and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param groups Number of groups.
+        /// @param epsilon Group normalization epsilon parameter.
+        /// @param flags Group normalization flags (@ref
+        ///     dnnl::normalization_flags).
+        desc(prop_kind aprop_kind, const memory::desc &src_desc,
+                const memory::desc &dst_desc, memory::dim groups,
+                float epsilon, normalization_flags flags) {
+            error::wrap_c_api(
+                    dnnl_group_normalization_forward_desc_init(&data,
+                            dnnl::convert_to_c(aprop_kind), &src_desc.data,
+                            &dst_desc.data, groups, epsilon,
+                            convert_to_c(flags)),
+                    "could not create a descriptor for a group normalization "
+                    "forward propagation primitive");
+        }
+    };
+
+    /// Primitive descriptor for a group normalization forward propagation
+    /// primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a group normalization
+        /// forward propagation primitive.
+        ///
+        /// @param adesc Descriptor for a group normalization forward
+        ///     propagation primitive.
+        /// @param aengine Engine to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const engine &aengine,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, nullptr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a group normalization
+        /// forward propagation primitive.
+        ///
+        /// @param adesc Descriptor for a group normalization forward
+        ///     propagation primitive.
+        /// @param attr Primitive attributes to use.
+        /// @param aengine Engine to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const primitive_attr &attr,
+                const engine &aengine, bool allow_empty = false)
+            : dnnl::primitive_desc(
+                    &adesc.data, &attr, aengine, nullptr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a group normalization
+        /// forward propagation primitive from a C API primitive descriptor
+        /// that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a group normalization
+        ///     forward propagation primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd,
+                    dnnl::primitive::kind::group_normalization,
+                    dnnl::prop_kind::forward_training,
+                    dnnl::prop_kind::forward_inference) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const { return base::weights_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::workspace_desc()const
+        memory::desc workspace_desc() const { return base::workspace_desc(); }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::mean_desc()const
+        memory::desc mean_desc() const { return stat_desc(mean); }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::variance_desc()const
+        memory::desc variance_desc() const { return stat_desc(var); }
+
+    private:
+        enum {
+            mean = 1,
+            var = 2,
+        };
+        memory::desc stat_desc(int kind) const {
+            dnnl_group_normalization_desc_t *p;
+            error::wrap_c_api(
+                    dnnl_primitive_desc_query(get(),
+                            dnnl_query_group_normalization_d, 0, &p),
+                    "could not retrieve a descriptor from a primitive "
+                    "descriptor for group normalization forward propagation "
+                    "primitive");
+            return query_md(p->flags & dnnl_use_global_stats ? query::src_md
+                                                             : query::dst_md,
+                    kind);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    group_normalization_forward() = default;
+
+    /// Constructs a group normalization forward propagation primitive.
+    /// @param pd Primitive descriptor for a group normalization forward
+    ///     propagation primitive.
+    group_normalization_forward(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a group normalization forward propagation primitive from
+    ///     a cache blob.
+    /// @param pd Primitive descriptor for a group normalization forward
+    ///     propagation primitive.
+    /// @param cache_blob Cache blob.
+    group_normalization_forward(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// Group normalization backward propagation primitive.
+struct group_normalization_backward : public primitive {
+    /// Descriptor for a group normalization backward propagation primitive.
+    struct desc {
+        dnnl_group_normalization_desc_t data;
+
+        /// Default constructor. Produces an empty object.
+        desc() = default;
+
+        /// Constructs a descriptor for group normalization backward
+        /// propagation primitive.
+        ///
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::backward_data and #dnnl::prop_kind::backward
+        ///     (diffs for all parameters are computed in this case).
+        /// @param diff_src_desc Diff source memory descriptor.
+        /// @param diff_dst_desc Diff destination memory descriptor.
+        /// @param src_desc Source memory descriptor.
+        /// @param groups Number of groups.
+        /// @param epsilon Group normalization epsilon parameter.
+        /// @param flags Group normalization flags (@ref
+        ///     dnnl::normalization_flags).
+        desc(prop_kind aprop_kind, const memory::desc &diff_src_desc,
+                const memory::desc &diff_dst_desc, const memory::desc &src_desc,
+                memory::dim groups, float epsilon, normalization_flags flags) {
+            error::wrap_c_api(
+                    dnnl_group_normalization_backward_desc_init(&data,
+                            dnnl::convert_to_c(aprop_kind),
+                            &diff_src_desc.data, &diff_dst_desc.data,
+                            &src_desc.data, groups, epsilon,
+                            convert_to_c(flags)),
+                    "could not create a descriptor for a group normalization "
+                    "backward propagation primitive");
+        }
+    };
+
+    /// Primitive descriptor for a group normalization backward propagation
+    /// primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a group normalization
+        /// backward propagation primitive.
+        ///
+        /// @param adesc Descriptor for a group normalization backward
+        ///     propagation primitive.
+        /// @param aengine Engine to use.
+        /// @param hint_fwd_pd Primitive descriptor for a group normalization
+        ///     forward propagation primitive. It is used as a hint for
+        ///     deciding which memory format to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const engine &aengine,
+                const group_normalization_forward::primitive_desc &hint_fwd_pd,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(&adesc.data, nullptr, aengine,
+                    hint_fwd_pd.get(), allow_empty) {}
+
+        /// Constructs a primitive descriptor for a group normalization
+        /// backward propagation primitive.
+        ///
+        /// @param adesc Descriptor for a group normalization backward
+        ///     propagation primitive.
+        /// @param attr Primitive attributes to use.
+        /// @param aengine Engine to use.
+        /// @param hint_fwd_pd Primitive descriptor for a group normalization
+        ///     forward propagation primitive. It is used as a hint for
+        ///     deciding which memory format to use.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const desc &adesc, const primitive_attr &attr,
+                const engine &aengine,
+                const group_normalization_forward::primitive_desc &hint_fwd_pd,
+                bool allow_empty = false)
+            : dnnl::primitive_desc(&adesc.data, &attr, aengine,
+                    hint_fwd_pd.get(), allow_empty) {}
+
+        /// Constructs a primitive descriptor for a group normalization
+        /// backward propagation primitive from a C API primitive descriptor
+        /// that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a group normalization
+        ///     backward propagation primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd,
+                    dnnl::primitive::kind::group_normalization,
+                    dnnl::prop_kind::backward, dnnl::prop_kind::backward_data) {
+        }
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const { return base::weights_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_src_desc()const
+        memory::desc diff_src_desc() const { return base::diff_src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_dst_desc()const
+        memory::desc diff_dst_desc() const { return base::diff_dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_weights_desc()const
+        memory::desc diff_weights_desc() const {
+            return base::diff_weights_desc(0);
+        }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::mean_desc()const
+        memory::desc mean_desc() const { return query_md(query::src_md, 1); }
+
+        /// @copydoc dnnl::batch_normalization_forward::primitive_desc::variance_desc()const
+        memory::desc variance_desc() const {
+            return query_md(query::src_md, 2);
+        }
+
+        /// @copydoc dnnl::primitive_desc_base::workspace_desc()const
+        memory::desc workspace_desc() const { return base::workspace_desc(); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    group_normalization_backward() = default;
+
+    /// Constructs a group normalization backward propagation primitive.
+    /// @param pd Primitive descriptor for a group normalization backward
+    ///     propagation primitive.
+    group_normalization_backward(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a group normalization backward propagation primitive from
+    ///     a cache blob.
+    /// @param pd Primitive descriptor for a group normalization backward
+    ///     propagation primitive.
+    /// @param cache_blob Cache blob.
+    group_normalization_backward(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_group_normalization
+
 /// @addtogroup dnnl_api_inner_product Inner Product
 ///
 /// A primitive to compute an inner product.
@@ -8830,7 +9492,7 @@ struct vanilla_rnn_forward : public primitive {
         /// @param dst_layer_desc Memory descriptor for the output vector.
         /// @param dst_iter_desc Memory descriptor for the output recurrent
         ///     hidden state vector.
-        /// @param flags Unused.
+        /// @param flags Flags, see #dnnl::rnn_flags.
         /// @param alpha Negative slope if activation is
         ///     #dnnl::algorithm::eltwise_relu.
         /// @param beta Unused.
@@ -9012,7 +9674,7 @@ struct vanilla_rnn_backward : public primitive {
         ///     output vector.
         /// @param diff_dst_iter_desc Memory descriptor for the diff of output
         ///     recurrent hidden state vector.
-        /// @param flags Unused.
+        /// @param flags Flags, see #dnnl::rnn_flags.
         /// @param alpha Negative slope if activation is
         ///     #dnnl::algorithm::eltwise_relu.
         /// @param beta Unused.
@@ -9247,7 +9909,7 @@ struct lstm_forward : public primitive {
         ///     hidden state vector.
         /// @param dst_iter_c_desc Memory descriptor for the output recurrent
         ///     cell state vector.
-        /// @param flags Unused.
+        /// @param flags Flags, see #dnnl::rnn_flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -9315,7 +9977,7 @@ struct lstm_forward : public primitive {
         ///     hidden state vector.
         /// @param dst_iter_c_desc Memory descriptor for the output recurrent
         ///     cell state vector.
-        /// @param flags Unused.
+        /// @param flags Flags, see #dnnl::rnn_flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -9376,7 +10038,7 @@ struct lstm_forward : public primitive {
         ///     hidden state vector.
         /// @param dst_iter_c_desc Memory descriptor for the output recurrent
         ///     cell state vector.
-        /// @param flags Unused.
+        /// @param flags Flags, see #dnnl::rnn_flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -9599,7 +10261,7 @@ struct lstm_backward : public primitive {
         ///     recurrent hidden state vector.
         /// @param diff_dst_iter_c_desc Memory descriptor for the diff of
         ///     output recurrent cell state vector.
-        /// @param flags Unused.
+        /// @param flags Flags, see #dnnl::rnn_flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -9711,7 +10373,7 @@ struct lstm_backward : public primitive {
         ///     recurrent hidden state vector.
         /// @param diff_dst_iter_c_desc Memory descriptor for the diff of
         ///     output recurrent cell state vector.
-        /// @param flags Unused.
+        /// @param flags Flags, see #dnnl::rnn_flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -9810,7 +10472,7 @@ struct lstm_backward : public primitive {
         ///     recurrent hidden state vector.
         /// @param diff_dst_iter_c_desc Memory descriptor for the diff of
         ///     output recurrent cell state vector.
-        /// @param flags Unused.
+        /// @param flags Flags, see #dnnl::rnn_flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -10068,7 +10730,7 @@ struct gru_forward : public primitive {
         /// @param dst_layer_desc Memory descriptor for the output vector.
         /// @param dst_iter_desc Memory descriptor for the output recurrent
         ///     hidden state vector.
-        /// @param flags Unused.
+        /// @param flags Flags, see #dnnl::rnn_flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -10237,7 +10899,7 @@ struct gru_backward : public primitive {
         ///     output vector.
         /// @param diff_dst_iter_desc Memory descriptor for the diff of output
         ///     recurrent hidden state vector.
-        /// @param flags Unused.
+        /// @param flags Flags, see #dnnl::rnn_flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -10449,7 +11111,7 @@ struct lbr_gru_forward : public primitive {
         /// @param dst_layer_desc Memory descriptor for the output vector.
         /// @param dst_iter_desc Memory descriptor for the output recurrent
         ///     hidden state vector.
-        /// @param flags Unused.
+        /// @param flags Flags, see #dnnl::rnn_flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -10621,7 +11283,7 @@ struct lbr_gru_backward : public primitive {
         ///     output vector.
         /// @param diff_dst_iter_desc Memory descriptor for the diff of output
         ///     recurrent hidden state vector.
-        /// @param flags Unused.
+        /// @param flags Flags, see #dnnl::rnn_flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -10836,7 +11498,7 @@ struct augru_forward : public primitive {
         /// @param dst_layer_desc Memory descriptor for the output vector.
         /// @param dst_iter_desc Memory descriptor for the output recurrent
         ///     hidden state vector.
-        /// @param flags Unused.
+        /// @param flags Flags, see #dnnl::rnn_flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -11014,7 +11676,7 @@ struct augru_backward : public primitive {
         ///     output vector.
         /// @param diff_dst_iter_desc Memory descriptor for the diff of output
         ///     recurrent hidden state vector.
-        /// @param flags Unused.
+        /// @param flags Flags, see #dnnl::rnn_flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -11240,7 +11902,7 @@ struct lbr_augru_forward : public primitive {
         /// @param dst_layer_desc Memory descriptor for the output vector.
         /// @param dst_iter_desc Memory descriptor for the output recurrent
         ///     hidden state vector.
-        /// @param flags Unused.
+        /// @param flags Flags, see #dnnl::rnn_flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -11421,7 +12083,7 @@ struct lbr_augru_backward : public primitive {
         ///     output vector.
         /// @param diff_dst_iter_desc Memory descriptor for the diff of output
         ///     recurrent hidden state vector.
-        /// @param flags Unused.
+        /// @param flags Flags, see #dnnl::rnn_flags.
         desc(prop_kind aprop_kind, rnn_direction direction,
                 const memory::desc &src_layer_desc,
                 const memory::desc &src_iter_desc,
@@ -12815,7 +13477,9 @@ struct reduction : public primitive {
         ///     #dnnl_reduction_mul, #dnnl_reduction_mean,
         ///     #dnnl_reduction_norm_lp_max, #dnnl_reduction_norm_lp_sum,
         ///     #dnnl_reduction_norm_lp_power_p_max,
-        ///     #dnnl_reduction_norm_lp_power_p_sum.
+        ///     #dnnl_reduction_norm_lp_power_p_sum, #dnnl_reduction_argmax,
+        ///     #dnnl_reduction_argmin. The index-producing algorithms require
+        ///     destination of #dnnl::memory::data_type::s32 data type.
         /// @param p algorithm specific parameter.
         /// @param eps algorithm specific parameter.
         /// @param src_desc Source memory descriptor.
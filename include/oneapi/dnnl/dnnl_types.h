@@ -1416,6 +1416,11 @@ typedef enum {
     /// A softmax version 2 primitive (softmax with destination memory
     /// descriptor and algorithm kind).
     dnnl_softmax_v2,
+    /// A layer normalization version 2 primitive (layer normalization with
+    /// destination memory descriptor).
+    dnnl_layer_normalization_v2,
+    /// A group normalization primitive.
+    dnnl_group_normalization,
 
     /// Parameter to allow internal only primitives without undefined behavior.
     /// This parameter is chosen to be valid for so long as sizeof(int) >= 2.
@@ -1578,6 +1583,10 @@ typedef enum {
     dnnl_reduction_norm_lp_power_p_max,
     /// Reduction using lp norm without final pth-root
     dnnl_reduction_norm_lp_power_p_sum,
+    /// Reduction producing the index of the maximal element
+    dnnl_reduction_argmax,
+    /// Reduction producing the index of the minimal element
+    dnnl_reduction_argmin,
     /// Softmax
     dnnl_softmax_accurate = 0x30000,
     /// Logsoftmax
@@ -1651,6 +1660,20 @@ typedef enum {
     ///  - on backward propagation (for prop_kind == #dnnl_backward) compute
     ///    diff wrt shift (hence one extra output used)
     dnnl_use_shift = 0x10U,
+
+    /// Use Root Mean Square (RMS) normalization
+    ///
+    /// Supported by layer normalization only.
+    ///
+    /// If specified:
+    ///  - on forward propagation the mean is not computed and is not
+    ///    subtracted from the source, and the variance is computed as the
+    ///    mean of squared source values. On forward training the mean
+    ///    output is filled with zeros. When used together with
+    ///    #dnnl_use_global_stats the mean input is ignored.
+    ///  - on backward propagation compute derivatives of the RMS
+    ///    normalization
+    dnnl_rms_norm = 0x20U,
 } dnnl_normalization_flags_t;
 
 /// @} dnnl_api_primitives_common
@@ -2288,6 +2311,85 @@ typedef struct {
 
 /// @} dnnl_api_layer_normalization
 
+/// @addtogroup dnnl_api_layer_normalization_v2
+/// @{
+
+/// A descriptor of a Layer Normalization version 2 operation.
+typedef struct {
+    /// The kind of primitive. Used for self-identifying the primitive
+    /// descriptor. Must be #dnnl_layer_normalization_v2.
+    dnnl_primitive_kind_t primitive_kind;
+    /// The kind of propagation. Possible values: #dnnl_forward_training,
+    /// #dnnl_forward_inference, #dnnl_backward, and #dnnl_backward_data.
+    dnnl_prop_kind_t prop_kind;
+    /// Source memory descriptor.
+    dnnl_memory_desc_t src_desc;
+    /// Source gradient memory descriptor.
+    dnnl_memory_desc_t diff_src_desc;
+    /// Scale and shift data and gradient memory descriptors.
+    ///
+    /// Scaleshift memory descriptor uses 2D #dnnl_ab
+    /// format[2, normalized_dim] where 1-st dimension contains gamma parameter,
+    /// 2-nd dimension contains beta parameter. Normalized_dim is equal to the
+    /// last logical dimension of the data tensor across which normalization is
+    /// performed.
+    dnnl_memory_desc_t data_scaleshift_desc;
+    dnnl_memory_desc_t diff_data_scaleshift_desc;
+    /// Mean and variance data memory descriptors.
+    ///
+    /// Statistics (mean and variance) memory descriptor is the k-dimensional tensor
+    /// where k is equal to data_tensor_ndims - 1 and may have any plain
+    /// (stride[last_dim] == 1) user-provided format.
+    dnnl_memory_desc_t stat_desc;
+    /// Layer normalization epsilon parameter.
+    float layer_norm_epsilon;
+    unsigned flags;
+    /// Destination memory descriptor.
+    dnnl_memory_desc_t dst_desc;
+    /// Destination gradient memory descriptor.
+    dnnl_memory_desc_t diff_dst_desc;
+} dnnl_layer_normalization_v2_desc_t;
+
+/// @} dnnl_api_layer_normalization_v2
+
+/// @addtogroup dnnl_api_group_normalization
+/// @{
+
+/// A descriptor of a Group Normalization operation.
+typedef struct {
+    /// The kind of primitive. Used for self-identifying the primitive
+    /// descriptor. Must be #dnnl_group_normalization.
+    dnnl_primitive_kind_t primitive_kind;
+    /// The kind of propagation. Possible values: #dnnl_forward_training,
+    /// #dnnl_forward_inference, #dnnl_backward, and #dnnl_backward_data.
+    dnnl_prop_kind_t prop_kind;
+    /// Source memory descriptor.
+    dnnl_memory_desc_t src_desc;
+    /// Source gradient memory descriptor.
+    dnnl_memory_desc_t diff_src_desc;
+    /// Destination memory descriptor.
+    dnnl_memory_desc_t dst_desc;
+    /// Destination gradient memory descriptor.
+    dnnl_memory_desc_t diff_dst_desc;
+    /// Scale and shift data and gradient memory descriptors.
+    ///
+    /// Scale and shift are separate 1D #dnnl_x tensors of size C (channels).
+    dnnl_memory_desc_t scaleshift_desc;
+    dnnl_memory_desc_t diff_scaleshift_desc;
+    /// Mean and variance data memory descriptors.
+    ///
+    /// Statistics (mean and variance) memory descriptor is the 2D tensor of
+    /// size [N, groups] and has #dnnl_ab format.
+    dnnl_memory_desc_t stat_desc;
+    /// Number of groups the channels are split into.
+    dnnl_dim_t groups;
+    /// Group normalization epsilon parameter.
+    float group_norm_epsilon;
+    unsigned flags;
+} dnnl_group_normalization_desc_t;
+
+/// @} dnnl_api_group_normalization
+
 /// @addtogroup dnnl_api_inner_product
 /// @{
 
@@ -2328,7 +2430,16 @@ typedef struct {
 /// Flags for RNN cell.
 typedef enum {
     /// Undefined RNN flags
-    dnnl_rnn_flags_undef = 0x0
+    dnnl_rnn_flags_undef = 0x0,
+    /// Sequences of the minibatch have different lengths
+    ///
+    /// If specified, the primitive takes an additional #DNNL_ARG_SEQ_LENGTHS
+    /// argument holding the number of valid time steps of each sequence.
+    /// The time steps past the end of a sequence are not computed, the
+    /// corresponding entries of the destination layer are set to zero and the
+    /// destination iteration states hold the states after the last valid
+    /// time step of each sequence.
+    dnnl_rnn_flags_variable_seq_lengths = 0x1
 } dnnl_rnn_flags_t;
 
 /// A direction of RNN primitive execution.
@@ -2514,7 +2625,8 @@ typedef struct {
     /// #dnnl_reduction_max, #dnnl_reduction_min, #dnnl_reduction_sum,
     /// #dnnl_reduction_mul, #dnnl_reduction_mean, #dnnl_reduction_norm_lp_max,
     /// #dnnl_reduction_norm_lp_sum, #dnnl_reduction_norm_lp_power_p_max,
-    /// #dnnl_reduction_norm_lp_power_p_sum.
+    /// #dnnl_reduction_norm_lp_power_p_sum, #dnnl_reduction_argmax,
+    /// #dnnl_reduction_argmin.
     dnnl_alg_kind_t alg_kind;
     /// Source memory descriptor.
     dnnl_memory_desc_t src_desc;
@@ -2531,6 +2643,8 @@ typedef struct {
     /// #dnnl_reduction_sum: @p p and @p eps are ignored
     /// #dnnl_reduction_mul: @p p and @p eps are ignored
     /// #dnnl_reduction_mean: @p p and @p eps are ignored
+    /// #dnnl_reduction_argmax: @p p and @p eps are ignored
+    /// #dnnl_reduction_argmin: @p p and @p eps are ignored
     float p, eps;
 } dnnl_reduction_desc_t;
 
@@ -2718,6 +2832,12 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// #DNNL_ARG_SRC_3.
 #define DNNL_ARG_AUGRU_ATTENTION DNNL_ARG_SRC_3
 
+/// Source argument #4.
+#define DNNL_ARG_SRC_4 5
+/// A special mnemonic for RNN sequence lengths. An alias for
+/// #DNNL_ARG_SRC_4.
+#define DNNL_ARG_SEQ_LENGTHS DNNL_ARG_SRC_4
+
 /// Destination argument #0.
 #define DNNL_ARG_DST_0 17
 /// A special mnemonic for destination argument for primitives that have a
@@ -2996,6 +3116,8 @@ typedef enum {
     dnnl_query_reduction_d, ///< reduction descriptor
     dnnl_query_prelu_d, ///< prelu descriptor
     dnnl_query_softmax_v2_d, ///< softmax version 2 descriptor
+    dnnl_query_layer_normalization_v2_d, ///< layer normalization v2 desc
+    dnnl_query_group_normalization_d, ///< group normalization descriptor
 
     // memory descriptor section
     dnnl_query_some_md = 128, ///< stub
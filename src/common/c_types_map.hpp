@@ -143,6 +143,8 @@ const alg_kind_t reduction_norm_lp_power_p_max
         = dnnl_reduction_norm_lp_power_p_max;
 const alg_kind_t reduction_norm_lp_power_p_sum
         = dnnl_reduction_norm_lp_power_p_sum;
+const alg_kind_t reduction_argmax = dnnl_reduction_argmax;
+const alg_kind_t reduction_argmin = dnnl_reduction_argmin;
 const alg_kind_t softmax_accurate = dnnl_softmax_accurate;
 const alg_kind_t softmax_log = dnnl_softmax_log;
 } // namespace alg_kind
@@ -1265,6 +1267,8 @@ const primitive_kind_t matmul = dnnl_matmul;
 const primitive_kind_t resampling = dnnl_resampling;
 const primitive_kind_t reduction = dnnl_reduction;
 const primitive_kind_t softmax_v2 = dnnl_softmax_v2;
+const primitive_kind_t layer_normalization_v2 = dnnl_layer_normalization_v2;
+const primitive_kind_t group_normalization = dnnl_group_normalization;
 
 // Internal only primitive kinds.
 const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
@@ -1318,6 +1322,9 @@ const query_t matmul_d = dnnl_query_matmul_d;
 const query_t resampling_d = dnnl_query_resampling_d;
 const query_t reduction_d = dnnl_query_reduction_d;
 const query_t softmax_v2_d = dnnl_query_softmax_v2_d;
+const query_t layer_normalization_v2_d
+        = dnnl_query_layer_normalization_v2_d;
+const query_t group_normalization_d = dnnl_query_group_normalization_d;
 
 const query_t some_md = dnnl_query_some_md;
 const query_t src_md = dnnl_query_src_md;
@@ -1352,6 +1359,8 @@ using softmax_desc_t = dnnl_softmax_desc_t;
 using lrn_desc_t = dnnl_lrn_desc_t;
 using batch_normalization_desc_t = dnnl_batch_normalization_desc_t;
 using layer_normalization_desc_t = dnnl_layer_normalization_desc_t;
+using layer_normalization_v2_desc_t = dnnl_layer_normalization_v2_desc_t;
+using group_normalization_desc_t = dnnl_group_normalization_desc_t;
 using inner_product_desc_t = dnnl_inner_product_desc_t;
 using binary_desc_t = dnnl_binary_desc_t;
 using logsoftmax_desc_t = dnnl_logsoftmax_desc_t;
@@ -1388,7 +1397,8 @@ struct op_desc_t {
         softmax_v2_desc_t softmax_v2;
         lrn_desc_t lrn;
         batch_normalization_desc_t batch_normalization;
-        layer_normalization_desc_t layer_normalization;
+        layer_normalization_v2_desc_t layer_normalization_v2;
+        group_normalization_desc_t group_normalization;
         inner_product_desc_t inner_product;
         rnn_desc_t rnn;
         gemm_desc_t gemm;
@@ -1419,7 +1429,8 @@ struct op_desc_t {
     DECL_CTOR_AND_CONVERTERS(softmax_v2_desc_t);
     DECL_CTOR_AND_CONVERTERS(lrn_desc_t);
     DECL_CTOR_AND_CONVERTERS(batch_normalization_desc_t);
-    DECL_CTOR_AND_CONVERTERS(layer_normalization_desc_t);
+    DECL_CTOR_AND_CONVERTERS(layer_normalization_v2_desc_t);
+    DECL_CTOR_AND_CONVERTERS(group_normalization_desc_t);
     DECL_CTOR_AND_CONVERTERS(inner_product_desc_t);
     DECL_CTOR_AND_CONVERTERS(rnn_desc_t);
     DECL_CTOR_AND_CONVERTERS(gemm_desc_t);
@@ -21,8 +21,9 @@ namespace impl {
 namespace experimental {
 
 // Bnorm expermental feature: calculate mean & variance in single pass over
-// input tensor. Improves performance by 25-33% but uses numerically unstable
-// formula.
+// input tensor. Improves performance by 25-33% but uses numerically less
+// stable formula. CPU implementations shift the data by the first value of
+// each channel to reduce cancellation.
 bool DNNL_API use_bnorm_stats_one_pass() {
 #ifdef DNNL_EXPERIMENTAL
     static const bool stats_onepass_algo
@@ -81,6 +81,8 @@ void primitive_task_start(primitive_kind_t kind) {
             CASE(reduction),
             CASE(prelu),
             CASE(softmax_v2),
+            CASE(layer_normalization_v2),
+            CASE(group_normalization),
     };
 #undef CASE
     int kind_idx = (int)kind;
@@ -28,60 +28,72 @@ using namespace dnnl::impl::prop_kind;
 using namespace dnnl::impl::types;
 
 namespace {
-status_t lnorm_desc_init(layer_normalization_desc_t *lnorm_desc,
-        prop_kind_t prop_kind, const memory_desc_t *data_desc,
-        const memory_desc_t *stat_desc, const memory_desc_t *diff_data_desc,
+status_t lnorm_desc_init(layer_normalization_v2_desc_t *lnorm_desc,
+        prop_kind_t prop_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *dst_desc, const memory_desc_t *stat_desc,
+        const memory_desc_t *diff_src_desc, const memory_desc_t *diff_dst_desc,
         float epsilon, unsigned flags) {
-    bool args_ok = !any_null(lnorm_desc, data_desc)
+    bool is_fwd = one_of(prop_kind, forward_training, forward_inference);
+    bool args_ok = !any_null(lnorm_desc, src_desc)
             && one_of(prop_kind, forward_training, forward_inference,
                     backward_data, backward)
-            && 2 <= data_desc->ndims && data_desc->ndims <= 5
-            && IMPLICATION(prop_kind & backward, diff_data_desc != nullptr)
+            && 2 <= src_desc->ndims && src_desc->ndims <= 5
+            && IMPLICATION(is_fwd, dst_desc != nullptr)
+            && IMPLICATION(!is_fwd, !any_null(diff_src_desc, diff_dst_desc))
             && (flags
                        & ~(dnnl_use_global_stats | dnnl_use_scaleshift
-                               | dnnl_use_scale | dnnl_use_shift))
+                               | dnnl_use_scale | dnnl_use_shift
+                               | dnnl_rms_norm))
                     == 0
-            && IMPLICATION(
-                    one_of(prop_kind, forward_training, forward_inference),
-                    !memory_desc_wrapper(data_desc).format_any());
+            && IMPLICATION(is_fwd, !memory_desc_wrapper(src_desc).format_any());
     if (!args_ok) return invalid_arguments;
 
-    auto ld = layer_normalization_desc_t();
-    ld.primitive_kind = primitive_kind::layer_normalization;
+    auto ld = layer_normalization_v2_desc_t();
+    ld.primitive_kind = primitive_kind::layer_normalization_v2;
     ld.prop_kind = prop_kind;
 
     bool runtime_dims_or_strides
-            = memory_desc_wrapper(data_desc).has_runtime_dims_or_strides()
+            = memory_desc_wrapper(src_desc).has_runtime_dims_or_strides()
             || (stat_desc
                     && memory_desc_wrapper(stat_desc)
                                .has_runtime_dims_or_strides());
-    if (one_of(prop_kind, backward_data, backward))
+    if (is_fwd)
+        runtime_dims_or_strides = runtime_dims_or_strides
+                || memory_desc_wrapper(dst_desc).has_runtime_dims_or_strides();
+    else
         runtime_dims_or_strides = runtime_dims_or_strides
-                || memory_desc_wrapper(diff_data_desc)
+                || memory_desc_wrapper(diff_src_desc)
+                           .has_runtime_dims_or_strides()
+                || memory_desc_wrapper(diff_dst_desc)
                            .has_runtime_dims_or_strides();
     if (runtime_dims_or_strides) return unimplemented;
 
-    ld.data_desc = *data_desc;
+    ld.src_desc = *src_desc;
     ld.stat_desc = zero_md();
-    ld.diff_data_desc = zero_md();
-    if (one_of(ld.prop_kind, backward_data, backward))
-        ld.diff_data_desc = *diff_data_desc;
+    ld.diff_src_desc = zero_md();
+    ld.dst_desc = zero_md();
+    ld.diff_dst_desc = zero_md();
+    if (is_fwd) {
+        ld.dst_desc = *dst_desc;
+    } else {
+        ld.diff_src_desc = *diff_src_desc;
+        ld.diff_dst_desc = *diff_dst_desc;
+    }
 
     if (stat_desc)
         ld.stat_desc = *stat_desc;
     else
-        CHECK(dnnl_memory_desc_init_by_tag(&ld.stat_desc,
-                ld.data_desc.ndims - 1, ld.data_desc.dims, data_type::f32,
-                format_tag::any));
+        CHECK(dnnl_memory_desc_init_by_tag(&ld.stat_desc, ld.src_desc.ndims - 1,
+                ld.src_desc.dims, data_type::f32, format_tag::any));
 
-    int ndims = data_desc->ndims;
+    int ndims = src_desc->ndims;
     ld.data_scaleshift_desc = zero_md();
     if (flags & (dnnl_use_scale | dnnl_use_shift)) {
-        dims_t scaleshift_dims = {data_desc->dims[ndims - 1]};
+        dims_t scaleshift_dims = {src_desc->dims[ndims - 1]};
         dnnl_memory_desc_init_by_tag(&ld.data_scaleshift_desc, 1,
                 scaleshift_dims, data_type::f32, dnnl_x);
     } else {
-        dims_t scaleshift_dims = {2, data_desc->dims[ndims - 1]};
+        dims_t scaleshift_dims = {2, src_desc->dims[ndims - 1]};
         dnnl_memory_desc_init_by_tag(&ld.data_scaleshift_desc, 2,
                 scaleshift_dims, data_type::f32, dnnl_nc);
     }
@@ -99,12 +111,20 @@ status_t lnorm_desc_init(layer_normalization_desc_t *lnorm_desc,
 
     ld.flags = flags;
 
-    if (ld.prop_kind == backward_data) {
-        bool consistency = ld.diff_data_desc.ndims == ld.data_desc.ndims
-                && array_cmp(ld.diff_data_desc.dims, ld.data_desc.dims,
-                        ld.diff_data_desc.ndims)
-                && ld.data_desc.ndims == ld.stat_desc.ndims + 1
-                && array_cmp(ld.stat_desc.dims, ld.data_desc.dims,
+    if (is_fwd) {
+        bool consistency = ld.src_desc.ndims == ld.dst_desc.ndims
+                && array_cmp(
+                        ld.src_desc.dims, ld.dst_desc.dims, ld.src_desc.ndims);
+        if (!consistency) return invalid_arguments;
+    } else {
+        bool consistency = ld.diff_src_desc.ndims == ld.src_desc.ndims
+                && array_cmp(ld.diff_src_desc.dims, ld.src_desc.dims,
+                        ld.diff_src_desc.ndims)
+                && ld.diff_src_desc.ndims == ld.diff_dst_desc.ndims
+                && array_cmp(ld.diff_src_desc.dims, ld.diff_dst_desc.dims,
+                        ld.diff_src_desc.ndims)
+                && ld.src_desc.ndims == ld.stat_desc.ndims + 1
+                && array_cmp(ld.stat_desc.dims, ld.src_desc.dims,
                         ld.stat_desc.ndims);
         if (!consistency) return invalid_arguments;
     }
@@ -112,6 +132,20 @@ status_t lnorm_desc_init(layer_normalization_desc_t *lnorm_desc,
     *lnorm_desc = ld;
     return success;
 }
+
+status_t lnorm_v1_desc_init(layer_normalization_desc_t *lnorm_desc,
+        prop_kind_t prop_kind, const memory_desc_t *data_desc,
+        const memory_desc_t *stat_desc, const memory_desc_t *diff_data_desc,
+        float epsilon, unsigned flags) {
+    if (any_null(lnorm_desc)) return invalid_arguments;
+    auto ld = layer_normalization_v2_desc_t();
+    CHECK(lnorm_desc_init(&ld, prop_kind, data_desc, data_desc, stat_desc,
+            diff_data_desc, diff_data_desc, epsilon, flags));
+    // v1 descriptor is a prefix of v2 one with the same src and dst
+    *lnorm_desc = *reinterpret_cast<const layer_normalization_desc_t *>(&ld);
+    lnorm_desc->primitive_kind = primitive_kind::layer_normalization;
+    return success;
+}
 } // namespace
 
 status_t dnnl_layer_normalization_forward_desc_init(
@@ -120,8 +154,8 @@ status_t dnnl_layer_normalization_forward_desc_init(
         float epsilon, unsigned flags) {
     if (!one_of(prop_kind, forward_training, forward_inference))
         return invalid_arguments;
-    return lnorm_desc_init(lnorm_desc, prop_kind, data_desc, stat_desc, nullptr,
-            epsilon, flags);
+    return lnorm_v1_desc_init(lnorm_desc, prop_kind, data_desc, stat_desc,
+            nullptr, epsilon, flags);
 }
 
 status_t dnnl_layer_normalization_backward_desc_init(
@@ -129,8 +163,28 @@ status_t dnnl_layer_normalization_backward_desc_init(
         const memory_desc_t *diff_data_desc, const memory_desc_t *data_desc,
         const memory_desc_t *stat_desc, float epsilon, unsigned flags) {
     if (!one_of(prop_kind, backward, backward_data)) return invalid_arguments;
-    return lnorm_desc_init(lnorm_desc, prop_kind, data_desc, stat_desc,
+    return lnorm_v1_desc_init(lnorm_desc, prop_kind, data_desc, stat_desc,
             diff_data_desc, epsilon, flags);
 }
 
+status_t dnnl_layer_normalization_v2_forward_desc_init(
+        layer_normalization_v2_desc_t *lnorm_desc, prop_kind_t prop_kind,
+        const memory_desc_t *src_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *stat_desc, float epsilon, unsigned flags) {
+    if (!one_of(prop_kind, forward_training, forward_inference))
+        return invalid_arguments;
+    return lnorm_desc_init(lnorm_desc, prop_kind, src_desc, dst_desc,
+            stat_desc, nullptr, nullptr, epsilon, flags);
+}
+
+status_t dnnl_layer_normalization_v2_backward_desc_init(
+        layer_normalization_v2_desc_t *lnorm_desc, prop_kind_t prop_kind,
+        const memory_desc_t *diff_src_desc, const memory_desc_t *diff_dst_desc,
+        const memory_desc_t *src_desc, const memory_desc_t *stat_desc,
+        float epsilon, unsigned flags) {
+    if (!one_of(prop_kind, backward, backward_data)) return invalid_arguments;
+    return lnorm_desc_init(lnorm_desc, prop_kind, src_desc, nullptr, stat_desc,
+            diff_src_desc, diff_dst_desc, epsilon, flags);
+}
+
 // vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -17,6 +17,8 @@
 #ifndef COMMON_LAYER_NORMALIZATION_PD_HPP
 #define COMMON_LAYER_NORMALIZATION_PD_HPP
 
+#include <cstring>
+
 #include "oneapi/dnnl/dnnl.h"
 
 #include "c_types_map.hpp"
@@ -29,9 +31,9 @@ namespace impl {
 struct layer_normalization_fwd_pd_t;
 
 struct layer_normalization_pd_t : public primitive_desc_t {
-    static constexpr auto base_pkind = primitive_kind::layer_normalization;
+    static constexpr auto base_pkind = primitive_kind::layer_normalization_v2;
 
-    const layer_normalization_desc_t *desc() const { return &desc_; }
+    const layer_normalization_v2_desc_t *desc() const { return &desc_; }
     const op_desc_t *op_desc() const override {
         return reinterpret_cast<const op_desc_t *>(this->desc());
     }
@@ -42,7 +44,20 @@ struct layer_normalization_pd_t : public primitive_desc_t {
                 *(prop_kind_t *)result = desc()->prop_kind;
                 break;
             case query::layer_normalization_d:
-                *(const layer_normalization_desc_t **)result = desc();
+                *(const layer_normalization_desc_t **)result
+                        = reinterpret_cast<const layer_normalization_desc_t *>(
+                                desc());
+                break;
+            case query::layer_normalization_v2_d:
+                *(const layer_normalization_v2_desc_t **)result = desc();
+                break;
+            case query::primitive_kind:
+                if (desc()->primitive_kind
+                        == primitive_kind::layer_normalization_v2)
+                    *(primitive_kind_t *)result = desc()->primitive_kind;
+                else
+                    *(primitive_kind_t *)result
+                            = primitive_kind::layer_normalization;
                 break;
             default: return primitive_desc_t::query(what, idx, result);
         }
@@ -50,11 +65,11 @@ struct layer_normalization_pd_t : public primitive_desc_t {
     }
 
     /* common layer_normalization aux functions */
-    int ndims() const { return desc_.data_desc.ndims; }
+    int ndims() const { return desc_.src_desc.ndims; }
     dim_t across_axis() const {
-        return utils::array_product(desc_.data_desc.dims, ndims() - 1);
+        return utils::array_product(desc_.src_desc.dims, ndims() - 1);
     }
-    dim_t norm_axis() const { return desc_.data_desc.dims[ndims() - 1]; }
+    dim_t norm_axis() const { return desc_.src_desc.dims[ndims() - 1]; }
 
     bool stats_are_src() const { return desc_.flags & dnnl_use_global_stats; }
     bool stats_are_tmp() const { return !(stats_are_src() || is_training()); }
@@ -65,6 +80,7 @@ struct layer_normalization_pd_t : public primitive_desc_t {
     bool use_global_stats() const {
         return desc_.flags & dnnl_use_global_stats;
     }
+    bool skip_mean() const { return desc_.flags & dnnl_rms_norm; }
 
     bool is_fwd() const {
         return utils::one_of(desc_.prop_kind, prop_kind::forward_training,
@@ -76,26 +92,26 @@ struct layer_normalization_pd_t : public primitive_desc_t {
     }
 
     bool has_zero_dim_memory() const {
-        return memory_desc_wrapper(desc_.data_desc).has_zero_dim();
+        return memory_desc_wrapper(desc_.src_desc).has_zero_dim();
     }
 
     const memory_desc_t *stat_md() const { return &stat_md_; }
 
 protected:
-    layer_normalization_desc_t desc_;
+    layer_normalization_v2_desc_t desc_;
     const layer_normalization_fwd_pd_t *hint_fwd_pd_;
 
-    memory_desc_t data_md_;
+    memory_desc_t src_md_;
     memory_desc_t stat_md_;
     memory_desc_t scaleshift_md_;
 
-    layer_normalization_pd_t(const layer_normalization_desc_t *adesc,
+    layer_normalization_pd_t(const layer_normalization_v2_desc_t *adesc,
             const primitive_attr_t *attr,
             const layer_normalization_fwd_pd_t *hint_fwd_pd)
         : primitive_desc_t(attr, base_pkind)
-        , desc_(*adesc)
+        , desc_(cast_lnorm_v1_to_v2(*adesc))
         , hint_fwd_pd_(hint_fwd_pd)
-        , data_md_(desc_.data_desc)
+        , src_md_(desc_.src_desc)
         , stat_md_(desc_.stat_desc)
         , scaleshift_md_(desc_.data_scaleshift_desc) {}
 
@@ -123,7 +139,22 @@ protected:
     }
 
 private:
-    const memory_desc_t &data_desc() const { return desc_.data_desc; }
+    layer_normalization_v2_desc_t cast_lnorm_v1_to_v2(
+            const layer_normalization_v2_desc_t &lnorm_desc) const {
+        if (lnorm_desc.primitive_kind
+                == primitive_kind::layer_normalization_v2)
+            return lnorm_desc;
+
+        // v1 descriptor is a prefix of the v2 one: only the fields it has
+        // may be read, the destination descriptors are the source ones
+        layer_normalization_v2_desc_t lnorm_v2_desc;
+        std::memcpy(&lnorm_v2_desc, &lnorm_desc,
+                sizeof(layer_normalization_desc_t));
+        lnorm_v2_desc.dst_desc = lnorm_desc.src_desc;
+        lnorm_v2_desc.diff_dst_desc = lnorm_desc.diff_src_desc;
+
+        return lnorm_v2_desc;
+    }
 };
 
 struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
@@ -164,13 +195,13 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
     }
 
     const memory_desc_t *src_md(int index = 0) const override {
-        if (index == 0) return &data_md_;
+        if (index == 0) return &src_md_;
         if (stats_are_src() && (index == 1 || index == 2)) return &stat_md_;
         return &glob_zero_md;
     }
 
     const memory_desc_t *dst_md(int index = 0) const override {
-        if (index == 0) return &data_md_;
+        if (index == 0) return &dst_md_;
         if (!stats_are_src() && is_training() && (index == 1 || index == 2))
             return &stat_md_;
         return &glob_zero_md;
@@ -182,26 +213,48 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
 
     int n_inputs() const override {
         return 1 + 2 * stats_are_src() + use_scaleshift() + use_scale()
-                + use_shift();
+                + use_shift() + n_binary_po_inputs();
     }
     int n_outputs() const override {
         return 1 + 2 * (!stats_are_src()) * is_training();
     }
 
 protected:
-    layer_normalization_fwd_pd_t(const layer_normalization_desc_t *adesc,
+    memory_desc_t dst_md_;
+
+    layer_normalization_fwd_pd_t(const layer_normalization_v2_desc_t *adesc,
             const primitive_attr_t *attr,
             const layer_normalization_fwd_pd_t *hint_fwd_pd)
-        : layer_normalization_pd_t(adesc, attr, hint_fwd_pd) {}
+        : layer_normalization_pd_t(adesc, attr, hint_fwd_pd)
+        , dst_md_(desc_.dst_desc) {}
 
     bool set_default_formats_common() {
-        return set_default_stat_md_format(data_md_);
+        return IMPLICATION(dst_md_.format_kind == format_kind::any,
+                       memory_desc_init_by_md_and_dt(
+                               dst_md_, src_md_, dst_md_.data_type)
+                               == status::success)
+                && set_default_stat_md_format(src_md_);
     }
 
     bool check_scale_shift_data_type() const {
         return IMPLICATION(use_scaleshift() || use_scale() || use_shift(),
                 weights_md()->data_type == data_type::f32);
     }
+
+    bool attr_oscale_ok() const {
+        const auto &oscale = attr()->output_scales_;
+        const bool ok = IMPLICATION(desc()->primitive_kind != base_pkind,
+                oscale.has_default_values());
+        return ok && oscale.mask_ == 0 && oscale.defined();
+    }
+
+    bool post_ops_ok() const {
+        const auto &po = attr()->post_ops_;
+        for (int i = 0; i < po.len(); i++)
+            if (!(po.entry_[i].is_eltwise() || po.entry_[i].is_binary()))
+                return false;
+        return true;
+    }
 };
 
 struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
@@ -248,16 +301,16 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
     }
 
     const memory_desc_t *src_md(int index = 0) const override {
-        return index == 0 ? &data_md_ : index <= 2 ? &stat_md_ : &glob_zero_md;
+        return index == 0 ? &src_md_ : index <= 2 ? &stat_md_ : &glob_zero_md;
     }
     const memory_desc_t *dst_md(int index = 0) const override {
-        return (index == 0) ? &data_md_ : &glob_zero_md;
+        return (index == 0) ? &src_md_ : &glob_zero_md;
     }
     const memory_desc_t *diff_dst_md(int index = 0) const override {
-        return index == 0 ? &diff_data_md_ : &glob_zero_md;
+        return index == 0 ? &diff_dst_md_ : &glob_zero_md;
     }
     const memory_desc_t *diff_src_md(int index = 0) const override {
-        return index == 0 ? &diff_data_md_ : &glob_zero_md;
+        return index == 0 ? &diff_src_md_ : &glob_zero_md;
     }
 
     const memory_desc_t *weights_md(int index = 0) const override {
@@ -277,22 +330,28 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
     }
 
 protected:
-    memory_desc_t diff_data_md_;
+    memory_desc_t diff_src_md_;
+    memory_desc_t diff_dst_md_;
     memory_desc_t diff_scaleshift_md_;
 
-    layer_normalization_bwd_pd_t(const layer_normalization_desc_t *adesc,
+    layer_normalization_bwd_pd_t(const layer_normalization_v2_desc_t *adesc,
             const primitive_attr_t *attr,
             const layer_normalization_fwd_pd_t *hint_fwd_pd)
         : layer_normalization_pd_t(adesc, attr, hint_fwd_pd)
-        , diff_data_md_(desc_.diff_data_desc)
+        , diff_src_md_(desc_.diff_src_desc)
+        , diff_dst_md_(desc_.diff_dst_desc)
         , diff_scaleshift_md_(desc_.diff_data_scaleshift_desc) {}
 
     bool set_default_formats_common() {
-        return IMPLICATION(diff_data_md_.format_kind == format_kind::any,
+        return IMPLICATION(diff_dst_md_.format_kind == format_kind::any,
                        memory_desc_init_by_md_and_dt(
-                               diff_data_md_, data_md_, diff_data_md_.data_type)
+                               diff_dst_md_, src_md_, diff_dst_md_.data_type)
                                == status::success)
-                && set_default_stat_md_format(diff_data_md_);
+                && IMPLICATION(diff_src_md_.format_kind == format_kind::any,
+                        memory_desc_init_by_md_and_dt(
+                                diff_src_md_, src_md_, diff_src_md_.data_type)
+                                == status::success)
+                && set_default_stat_md_format(diff_src_md_);
     }
 
     bool check_scale_shift_data_type() const {
@@ -220,6 +220,11 @@ enum {
     key_gemm_int_c_in_acc_dt,
     key_gemm_tmp_buffer,
     key_gemm_flag,
+    key_gnorm_affine,
+    key_gnorm_reduction,
+    key_gnorm_shift,
+    key_gnorm_tmp_mean,
+    key_gnorm_tmp_var,
     key_iprod_bias_bf16_convert_wsp,
     key_iprod_dst_bf16_convert_wsp,
     key_iprod_dst_reorder,
@@ -265,6 +270,7 @@ enum {
     key_rnn_ptrs_wei_layer,
     key_rnn_ptrs_wei_iter,
     key_rnn_ptrs_wei_projection,
+    key_rnn_seq_lengths,
     key_softmax_reduction,
     key_softmax_interim_store,
     key_sum_reduction,
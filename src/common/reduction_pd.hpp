@@ -70,6 +70,12 @@ struct reduction_pd_t : public primitive_desc_t {
     int n_inputs() const override { return 1 + n_binary_po_inputs(); }
     int n_outputs() const override { return 1; }
 
+    // The algorithms producing indices of the reduced elements.
+    bool is_arg_alg() const {
+        return utils::one_of(desc_.alg_kind, alg_kind::reduction_argmax,
+                alg_kind::reduction_argmin);
+    }
+
     static void memory_desc_reduce_dim(memory_desc_t &md, int dim) {
         if (md.format_kind != format_kind::blocked) return;
 
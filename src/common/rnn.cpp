@@ -95,8 +95,13 @@ status_t check_data_type_consistency_fwd(const rnn_desc_t &r) {
 
     const bool is_forward = !(r.prop_kind == prop_kind::backward);
     const bool is_inference = r.prop_kind == prop_kind::forward_inference;
-    const bool is_int8_ok
-            = one_of(r.cell_kind, dnnl_vanilla_lstm, dnnl_vanilla_gru);
+    const bool is_int8_ok = one_of(r.cell_kind, dnnl_vanilla_lstm,
+            dnnl_vanilla_gru, dnnl_vanilla_augru);
+    // weights_peephole_desc is reused as attention_desc, the attention is
+    // quantized as src_layer, which has to be u8 for AUGRU
+    const bool is_int8_peephole_ok = r.cell_kind == dnnl_vanilla_augru
+            ? everyone_is(u8, r.weights_peephole_desc.data_type, src_layer_dt)
+            : r.weights_peephole_desc.data_type == data_type::undef;
 
     const bool cell_state_check = expect_dt(r.src_iter_c_desc, f32, bf16, f16)
             && expect_dt(r.dst_iter_c_desc, f32, bf16, f16);
@@ -134,14 +139,14 @@ status_t check_data_type_consistency_fwd(const rnn_desc_t &r) {
             && everyone_is(s8, weights_iter_dt, weights_layer_dt)
             && expect_dt(r.src_iter_desc, u8)
             && expect_dt(r.src_iter_c_desc, f32)
-            && r.weights_peephole_desc.data_type == data_type::undef
+            && is_int8_peephole_ok
             && one_of(weights_projection_dt, s8, data_type::undef)
             && expect_dt(r.dst_iter_desc, u8)
             && expect_dt(r.dst_iter_c_desc, f32) && expect_dt(r.bias_desc, f32);
 
     const bool is_f32u8f32 = is_inference && is_int8_ok && src_layer_dt == u8
             && everyone_is(s8, weights_iter_dt, weights_layer_dt)
-            && r.weights_peephole_desc.data_type == data_type::undef
+            && is_int8_peephole_ok
             && one_of(weights_projection_dt, s8, data_type::undef)
             && one_of(dst_layer_dt, u8, f32) && expect_dt(r.src_iter_desc, f32)
             && expect_dt(r.dst_iter_desc, f32) && expect_dt(r.bias_desc, f32);
@@ -151,14 +156,14 @@ status_t check_data_type_consistency_fwd(const rnn_desc_t &r) {
             && everyone_is(s8, weights_iter_dt, weights_layer_dt)
             && expect_dt(r.src_iter_desc, s8)
             && expect_dt(r.src_iter_c_desc, f32)
-            && r.weights_peephole_desc.data_type == data_type::undef
+            && is_int8_peephole_ok
             && one_of(weights_projection_dt, s8, data_type::undef)
             && expect_dt(r.dst_iter_desc, s8)
             && expect_dt(r.dst_iter_c_desc, f32) && expect_dt(r.bias_desc, f32);
 
     const bool is_f32s8f32 = is_inference && is_int8_ok && src_layer_dt == s8
             && everyone_is(s8, weights_iter_dt, weights_layer_dt)
-            && r.weights_peephole_desc.data_type == data_type::undef
+            && is_int8_peephole_ok
             && one_of(weights_projection_dt, s8, data_type::undef)
             && one_of(dst_layer_dt, s8, f32) && expect_dt(r.src_iter_desc, f32)
             && expect_dt(r.dst_iter_desc, f32) && expect_dt(r.bias_desc, f32);
@@ -149,6 +149,14 @@ struct rnn_pd_t : public primitive_desc_t {
         return is_lstm() && !memory_desc_wrapper(desc_.dst_iter_desc).is_zero();
     }
 
+    bool with_seq_lengths() const {
+        return desc_.flags & dnnl_rnn_flags_variable_seq_lengths;
+    }
+
+    const memory_desc_t *seq_lengths_md() const {
+        return with_seq_lengths() ? &seq_lengths_md_ : &glob_zero_md;
+    }
+
     dnnl::impl::alg_kind_t cell_kind() const { return desc_.cell_kind; }
     dnnl::impl::alg_kind_t activation_kind() const {
         return desc_.activation_kind;
@@ -190,6 +198,7 @@ protected:
     memory_desc_t dst_layer_md_;
     memory_desc_t dst_iter_md_;
     memory_desc_t dst_iter_c_md_;
+    memory_desc_t seq_lengths_md_;
 
     memory_desc_t ws_md_;
 
@@ -209,7 +218,14 @@ protected:
         , dst_layer_md_(desc_.dst_layer_desc)
         , dst_iter_md_(desc_.dst_iter_desc)
         , dst_iter_c_md_(desc_.dst_iter_c_desc)
-        , ws_md_() {}
+        , seq_lengths_md_()
+        , ws_md_() {
+        if (with_seq_lengths()) {
+            const dims_t dims = {MB()};
+            dnnl_memory_desc_init_by_tag(
+                    &seq_lengths_md_, 1, dims, data_type::s32, format_tag::x);
+        }
+    }
 };
 
 struct rnn_fwd_pd_t : public rnn_pd_t {
@@ -228,6 +244,9 @@ struct rnn_fwd_pd_t : public rnn_pd_t {
         if (arg == DNNL_ARG_SRC_ITER_C && with_src_iter_c())
             return arg_usage_t::input;
 
+        if (arg == DNNL_ARG_SEQ_LENGTHS && with_seq_lengths())
+            return arg_usage_t::input;
+
         if (utils::one_of(arg, DNNL_ARG_WEIGHTS_LAYER, DNNL_ARG_WEIGHTS_ITER))
             return arg_usage_t::input;
 
@@ -259,6 +278,7 @@ struct rnn_fwd_pd_t : public rnn_pd_t {
             case DNNL_ARG_AUGRU_ATTENTION: return &const_augru_attention_md();
             case DNNL_ARG_SRC_ITER: return src_md(1);
             case DNNL_ARG_SRC_ITER_C: return src_md(2);
+            case DNNL_ARG_SEQ_LENGTHS: return seq_lengths_md();
             case DNNL_ARG_WEIGHTS_LAYER: return weights_md(0);
             case DNNL_ARG_WEIGHTS_ITER: return weights_md(1);
             case DNNL_ARG_WEIGHTS_PEEPHOLE:
@@ -278,7 +298,8 @@ struct rnn_fwd_pd_t : public rnn_pd_t {
 
     int n_inputs() const override {
         return 3 + is_lstm_peephole() + is_lstm_projection() + with_bias()
-                + with_src_iter() + with_src_iter_c() + is_augru();
+                + with_src_iter() + with_src_iter_c() + is_augru()
+                + with_seq_lengths();
     }
     int n_outputs() const override {
         return 1 + with_dst_iter() + with_dst_iter_c() + is_training();
@@ -38,7 +38,9 @@ status_t serialize_desc(
         CASE(eltwise)
         CASE(inner_product)
         CASE(gemm)
+        CASE(group_normalization)
         CASE(layer_normalization)
+        CASE(layer_normalization_v2)
         CASE(logsoftmax)
         CASE(lrn)
         CASE(matmul)
@@ -329,6 +331,28 @@ void serialize_desc(
     sstream.write(&desc.accum_data_type);
 }
 
+// Group normalization
+void serialize_desc(serialization_stream_t &sstream,
+        const group_normalization_desc_t &desc) {
+    // Kinds
+    sstream.write(&desc.primitive_kind);
+    sstream.write(&desc.prop_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.src_desc);
+    serialize_md(sstream, desc.diff_src_desc);
+    serialize_md(sstream, desc.dst_desc);
+    serialize_md(sstream, desc.diff_dst_desc);
+    serialize_md(sstream, desc.scaleshift_desc);
+    serialize_md(sstream, desc.diff_scaleshift_desc);
+    serialize_md(sstream, desc.stat_desc);
+    // Groups
+    sstream.write(&desc.groups);
+    // Epsilon
+    sstream.write(&desc.group_norm_epsilon);
+    // Flags
+    sstream.write(&desc.flags);
+}
+
 // Layer normalization
 void serialize_desc(serialization_stream_t &sstream,
         const layer_normalization_desc_t &desc) {
@@ -347,6 +371,16 @@ void serialize_desc(serialization_stream_t &sstream,
     sstream.write(&desc.flags);
 }
 
+void serialize_desc(serialization_stream_t &sstream,
+        const layer_normalization_v2_desc_t &desc) {
+    const auto &v1_desc
+            = *reinterpret_cast<const layer_normalization_desc_t *>(&desc);
+    serialize_desc(sstream, v1_desc);
+    // Memory descriptors
+    serialize_md(sstream, desc.dst_desc);
+    serialize_md(sstream, desc.diff_dst_desc);
+}
+
 void serialize_desc(serialization_stream_t &sstream, const lrn_desc_t &desc) {
     // Kinds
     sstream.write(&desc.primitive_kind);
@@ -41,8 +41,12 @@ void serialize_desc(
 void serialize_desc(serialization_stream_t &sstream, const gemm_desc_t &desc);
 void serialize_desc(
         serialization_stream_t &sstream, const inner_product_desc_t &desc);
+void serialize_desc(serialization_stream_t &sstream,
+        const group_normalization_desc_t &desc);
 void serialize_desc(serialization_stream_t &sstream,
         const layer_normalization_desc_t &desc);
+void serialize_desc(serialization_stream_t &sstream,
+        const layer_normalization_v2_desc_t &desc);
 void serialize_desc(serialization_stream_t &sstream, const lrn_desc_t &desc);
 void serialize_desc(serialization_stream_t &sstream, const matmul_desc_t &desc);
 void serialize_desc(
@@ -0,0 +1,81 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "memory_desc_wrapper.hpp"
+#include "utils.hpp"
+
+dnnl_status_t dnnl_topk_desc_init(dnnl_topk_desc_t *desc,
+        dnnl_alg_kind_t alg_kind, const dnnl_memory_desc_t *src_desc,
+        const dnnl_memory_desc_t *dst_desc,
+        const dnnl_memory_desc_t *indices_desc, int axis) {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::status;
+    using namespace dnnl::impl::utils;
+    using namespace dnnl::impl::alg_kind;
+
+    bool args_ok = !any_null(desc, src_desc, dst_desc, indices_desc)
+            && one_of(alg_kind, topk_max, topk_min)
+            && src_desc->format_kind != format_kind::any
+            && src_desc->ndims > 0 && 0 <= axis && axis < src_desc->ndims
+            && everyone_is(src_desc->ndims, dst_desc->ndims,
+                    indices_desc->ndims)
+            && dst_desc->data_type == src_desc->data_type
+            && indices_desc->data_type == data_type::s32;
+    if (!args_ok) return invalid_arguments;
+
+    for (int d = 0; d < src_desc->ndims; ++d) {
+        if (!everyone_is(dst_desc->dims[d], indices_desc->dims[d]))
+            return invalid_arguments;
+        if (d != axis && dst_desc->dims[d] != src_desc->dims[d])
+            return invalid_arguments;
+    }
+
+    const dim_t k = dst_desc->dims[axis];
+    if (k < 1 || k > src_desc->dims[axis]) return invalid_arguments;
+
+    if (memory_desc_wrapper(src_desc).has_runtime_dims_or_strides())
+        return unimplemented;
+
+    if (src_desc->format_kind != format_kind::blocked
+            || !one_of(dst_desc->format_kind, format_kind::blocked,
+                    format_kind::any)
+            || !one_of(indices_desc->format_kind, format_kind::blocked,
+                    format_kind::any))
+        return invalid_arguments;
+
+    if (src_desc->extra.flags != 0
+            || !IMPLICATION(dst_desc->format_kind == format_kind::blocked,
+                    dst_desc->extra.flags == 0)
+            || !IMPLICATION(indices_desc->format_kind == format_kind::blocked,
+                    indices_desc->extra.flags == 0))
+        return invalid_arguments;
+
+    auto td = topk_desc_t();
+    td.primitive_kind = primitive_kind::topk;
+    td.alg_kind = alg_kind;
+
+    td.src_desc = *src_desc;
+    td.dst_desc = *dst_desc;
+    td.indices_desc = *indices_desc;
+
+    td.axis = axis;
+
+    *desc = td;
+    return success;
+}
@@ -0,0 +1,117 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_TOPK_PD_HPP
+#define COMMON_TOPK_PD_HPP
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct topk_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::topk;
+
+    typedef topk_pd_t hint_class;
+
+    const topk_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::topk_d:
+                *(const topk_desc_t **)result = desc();
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return arg_usage_t::input; break;
+            case DNNL_ARG_DST:
+            case DNNL_ARG_DST_1: return arg_usage_t::output; break;
+            default: return primitive_desc_t::arg_usage(arg);
+        }
+    }
+
+    const memory_desc_t *arg_md(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0); break;
+            case DNNL_ARG_DST: return dst_md(0); break;
+            case DNNL_ARG_DST_1: return dst_md(1); break;
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(int index = 0) const override {
+        return index == 0 ? &src_md_ : &glob_zero_md;
+    }
+    // dst_md(0) holds the selected values, dst_md(1) their indices.
+    const memory_desc_t *dst_md(int index = 0) const override {
+        return index == 0 ? &dst_md_
+                          : index == 1 ? &indices_md_ : &glob_zero_md;
+    }
+
+    int n_inputs() const override { return 1; }
+    int n_outputs() const override { return 2; }
+
+    int axis() const { return desc_.axis; }
+    // Number of selected elements.
+    dim_t K() const { return dst_md_.dims[axis()]; }
+    // Number of elements the selection is made from.
+    dim_t axis_size() const { return src_md_.dims[axis()]; }
+    bool is_max() const { return desc_.alg_kind == alg_kind::topk_max; }
+
+protected:
+    topk_desc_t desc_;
+
+    memory_desc_t src_md_;
+    memory_desc_t dst_md_;
+    memory_desc_t indices_md_;
+
+    topk_pd_t(const topk_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*adesc)
+        , src_md_(desc_.src_desc)
+        , dst_md_(desc_.dst_desc)
+        , indices_md_(desc_.indices_desc) {}
+
+    // The outputs with format_kind::any follow the layout of the source.
+    status_t set_default_params() {
+        const memory_desc_wrapper src_d(src_md_);
+        if (!src_d.is_blocking_desc()) return status::unimplemented;
+
+        for (auto md : {&dst_md_, &indices_md_}) {
+            if (md->format_kind != format_kind::any) continue;
+            CHECK(memory_desc_init_by_blocking_desc(
+                    *md, src_d.blocking_desc()));
+        }
+        return status::success;
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -38,6 +38,7 @@
 #include "convolution_pd.hpp"
 #include "deconvolution_pd.hpp"
 #include "eltwise_pd.hpp"
+#include "group_normalization_pd.hpp"
 #include "inner_product_pd.hpp"
 #include "layer_normalization_pd.hpp"
 #include "lrn_pd.hpp"
@@ -208,6 +209,7 @@ std::string flags2str(unsigned flags) {
     if (flags & dnnl_use_scale) s += "C";
     if (flags & dnnl_use_shift) s += "H";
     if (flags & dnnl_fuse_norm_relu) s += "R";
+    if (flags & dnnl_rms_norm) s += "M";
     return s;
 }
 
@@ -645,6 +647,31 @@ static std::string init_info_eltwise(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+static std::string init_info_group_normalization(
+        const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << ","
+       << pd->desc()->prop_kind << ",";
+
+    auto src_md = pd->src_md(0);
+    auto dst_md = pd->is_fwd() ? pd->dst_md(0) : pd->diff_dst_md(0);
+    auto stats_md = pd->is_fwd() && !pd->stats_are_src() ? pd->dst_md(1)
+                                                         : pd->src_md(1);
+    auto diff_src_md = pd->diff_src_md();
+    ss << "src_" << src_md;
+    if (!pd->is_fwd()) ss << " diff_src_" << diff_src_md;
+    ss << (pd->is_fwd() ? " dst_" : " diff_dst_") << dst_md;
+    if (stats_md) ss << " stats_" << stats_md;
+    ss << ",";
+
+    ss << pd->attr() << ",";
+    ss << "flags:" << flags2str(pd->desc()->flags) << ",";
+    ss << "g" << pd->G() << md2desc_str(src_md);
+
+    return ss.str();
+}
+
 template <typename pd_t>
 static std::string init_info_inner_product(const engine_t *e, const pd_t *pd) {
     std::stringstream ss;
@@ -1008,7 +1035,9 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(group_normalization);
             CASE(inner_product);
+            case primitive_kind::layer_normalization_v2:
             CASE(layer_normalization);
             CASE(lrn);
             CASE(logsoftmax);
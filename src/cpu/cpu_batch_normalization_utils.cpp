@@ -14,8 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "common/bfloat16.hpp"
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/experimental.hpp"
 #include "common/utils.hpp"
 
 #include "cpu/platform.hpp"
@@ -187,6 +189,27 @@ bool is_spatial_thr(const batch_normalization_pd_t *bdesc, bool is_nspc,
     return S_nthr > 1;
 }
 
+bool use_stats_one_pass(const batch_normalization_pd_t *bdesc) {
+    return experimental::use_bnorm_stats_one_pass() && bdesc->is_fwd()
+            && !bdesc->stats_is_src();
+}
+
+void init_stats_shift(const batch_normalization_pd_t *bdesc, const void *src,
+        float *shift) {
+    const memory_desc_wrapper src_d(bdesc->src_md());
+    if (src_d.has_zero_dim()) return;
+
+    const bool is_bf16 = src_d.data_type() == data_type::bf16;
+    dims_t pos = {0};
+    for (dim_t c = 0; c < bdesc->C(); c++) {
+        pos[1] = c;
+        const dim_t off = src_d.off_v(pos);
+        shift[c] = is_bf16
+                ? static_cast<float>(static_cast<const bfloat16_t *>(src)[off])
+                : static_cast<const float *>(src)[off];
+    }
+}
+
 } // namespace bnorm_utils
 } // namespace cpu
 } // namespace impl
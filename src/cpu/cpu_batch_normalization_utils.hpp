@@ -36,6 +36,18 @@ bool thread_balance(bool do_blocking, bool spatial_thr_allowed, bool is_nhwc,
 bool is_spatial_thr(const batch_normalization_pd_t *bdesc, bool is_nhwc,
         int simd_w, int data_size);
 
+// Returns true if mean and variance are computed in a single pass over src.
+// Requires the library built with ONEDNN_EXPERIMENTAL=ON and
+// ONEDNN_EXPERIMENTAL_BNORM_STATS_ONE_PASS set.
+bool use_stats_one_pass(const batch_normalization_pd_t *bdesc);
+
+// Fills `shift` with the first src value of every channel. One-pass
+// statistics accumulate sum(x - shift) and sum((x - shift)^2): the shift
+// keeps the sum of squares close to the variance and avoids the catastrophic
+// cancellation of the plain sum(x^2) / n - mean^2 formula.
+void init_stats_shift(const batch_normalization_pd_t *bdesc, const void *src,
+        float *shift);
+
 } // namespace bnorm_utils
 } // namespace cpu
 } // namespace impl
@@ -20,6 +20,11 @@
 #include "cpu/ref_concat.hpp"
 #include "cpu/simple_concat.hpp"
 
+#if DNNL_X64
+#include "cpu/x64/jit_avx512_core_concat.hpp"
+using namespace dnnl::impl::cpu::x64;
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -29,6 +34,7 @@ using namespace dnnl::impl::data_type;
 #define INSTANCE(...) \
     impl_list_item_t(impl_list_item_t::concat_type_deduction_helper_t< \
             __VA_ARGS__::pd_t>()),
+#define INSTANCE_X64(...) DNNL_X64_ONLY(INSTANCE(__VA_ARGS__))
 // clang-format off
 constexpr impl_list_item_t cpu_concat_impl_list[] = REG_CONCAT_P({
         INSTANCE(simple_concat_t<f32>)
@@ -36,10 +42,12 @@ constexpr impl_list_item_t cpu_concat_impl_list[] = REG_CONCAT_P({
         INSTANCE(simple_concat_t<s8>)
         INSTANCE(simple_concat_t<s32>)
         INSTANCE(simple_concat_t<bf16>)
+        INSTANCE_X64(jit_avx512_core_concat_t)
         INSTANCE(ref_concat_t)
         nullptr,
 });
 // clang-format on
+#undef INSTANCE_X64
 #undef INSTANCE
 } // namespace
 
@@ -35,6 +35,7 @@
 #include "cpu/x64/ip_convolution.hpp"
 #include "cpu/x64/jit_avx2_1x1_convolution.hpp"
 #include "cpu/x64/jit_avx2_convolution.hpp"
+#include "cpu/x64/jit_avx2_f32_wino_conv_2x3.hpp"
 #include "cpu/x64/jit_avx512_common_1x1_convolution.hpp"
 #include "cpu/x64/jit_avx512_common_convolution.hpp"
 #include "cpu/x64/jit_avx512_core_amx_1x1_convolution.hpp"
@@ -43,6 +44,7 @@
 #include "cpu/x64/jit_avx512_core_bf16_convolution.hpp"
 #include "cpu/x64/jit_avx512_core_f32_wino_conv_2x3.hpp"
 #include "cpu/x64/jit_avx512_core_f32_wino_conv_4x3.hpp"
+#include "cpu/x64/jit_avx512_core_grouped_conv.hpp"
 #include "cpu/x64/jit_avx512_core_u8s8s32x_wino_convolution.hpp"
 #include "cpu/x64/jit_avx512_core_x8s8s32x_1x1_convolution.hpp"
 #include "cpu/x64/jit_avx512_core_x8s8s32x_convolution.hpp"
@@ -89,11 +91,13 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AMX(brgemm_convolution_fwd_t<avx512_core_bf16_amx_bf16>)
             CPU_INSTANCE_AVX512(brgemm_1x1_convolution_fwd_t<avx512_core>)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core>)
+            CPU_INSTANCE_AVX512(jit_avx512_core_grouped_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_common_dw_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_common_1x1_convolution_fwd_f32_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_f32_wino_conv_2x3_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_f32_wino_conv_4x3_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_common_convolution_fwd_t<f32>)
+            CPU_INSTANCE_AVX2(jit_avx2_f32_wino_conv_2x3_fwd_t)
             CPU_INSTANCE_AVX2(jit_avx2_dw_convolution_fwd_t)
             CPU_INSTANCE_AVX2(jit_avx2_1x1_convolution_fwd_t)
             CPU_INSTANCE_SSE41(jit_sse41_dw_convolution_fwd_t)
@@ -120,6 +124,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AMX(jit_avx512_core_amx_convolution_fwd_t)
             CPU_INSTANCE_AVX512(brgemm_1x1_convolution_fwd_t<avx512_core_bf16>)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core_bf16>)
+            CPU_INSTANCE_AVX512(jit_avx512_core_grouped_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_uni_dw_convolution_fwd_t<avx512_core, bf16, f32>)
             CPU_INSTANCE_AVX512(jit_avx512_core_bf16_1x1_convolution_fwd_t<f32>)
             CPU_INSTANCE_AVX512(jit_avx512_core_bf16_convolution_fwd_t)
@@ -136,6 +141,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AMX(jit_avx512_core_amx_convolution_fwd_t)
             CPU_INSTANCE_AVX512(brgemm_1x1_convolution_fwd_t<avx512_core_bf16>)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core_bf16>)
+            CPU_INSTANCE_AVX512(jit_avx512_core_grouped_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_uni_dw_convolution_fwd_t<avx512_core, bf16, bf16>)
             CPU_INSTANCE_AVX512(jit_avx512_core_bf16_1x1_convolution_fwd_t<bf16>)
             CPU_INSTANCE_AVX512(jit_avx512_core_bf16_convolution_fwd_t)
@@ -237,6 +243,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AMX(jit_avx512_core_amx_convolution_fwd_t)
             CPU_INSTANCE_AVX512(brgemm_1x1_convolution_fwd_t<avx512_core_vnni>)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core_vnni>)
+            CPU_INSTANCE_AVX512(jit_avx512_core_grouped_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_x8s8s32x_convolution_fwd_t)
             CPU_INSTANCE_AVX2(jit_uni_x8s8s32x_1x1_convolution_fwd_t<avx2>)
@@ -269,6 +276,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AMX(jit_avx512_core_amx_convolution_fwd_t)
             CPU_INSTANCE_AVX512(brgemm_1x1_convolution_fwd_t<avx512_core_vnni>)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core_vnni>)
+            CPU_INSTANCE_AVX512(jit_avx512_core_grouped_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_x8s8s32x_convolution_fwd_t)
             CPU_INSTANCE_AVX2(jit_uni_x8s8s32x_1x1_convolution_fwd_t<avx2>)
@@ -289,6 +297,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AMX(jit_avx512_core_amx_convolution_fwd_t)
             CPU_INSTANCE_AVX512(brgemm_1x1_convolution_fwd_t<avx512_core_vnni>)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core_vnni>)
+            CPU_INSTANCE_AVX512(jit_avx512_core_grouped_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_x8s8s32x_convolution_fwd_t)
             CPU_INSTANCE_AVX2(jit_uni_x8s8s32x_1x1_convolution_fwd_t<avx2>)
@@ -310,6 +319,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AMX(jit_avx512_core_amx_convolution_fwd_t)
             CPU_INSTANCE_AVX512(brgemm_1x1_convolution_fwd_t<avx512_core_vnni>)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core_vnni>)
+            CPU_INSTANCE_AVX512(jit_avx512_core_grouped_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_x8s8s32x_convolution_fwd_t)
             CPU_INSTANCE_AVX2(jit_uni_x8s8s32x_1x1_convolution_fwd_t<avx2>)
@@ -332,6 +342,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AMX(jit_avx512_core_amx_convolution_fwd_t)
             CPU_INSTANCE_AVX512(brgemm_1x1_convolution_fwd_t<avx512_core_vnni>)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core_vnni>)
+            CPU_INSTANCE_AVX512(jit_avx512_core_grouped_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_u8s8s32x_wino_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_x8s8s32x_convolution_fwd_t)
@@ -367,6 +378,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AMX(jit_avx512_core_amx_convolution_fwd_t)
             CPU_INSTANCE_AVX512(brgemm_1x1_convolution_fwd_t<avx512_core_vnni>)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core_vnni>)
+            CPU_INSTANCE_AVX512(jit_avx512_core_grouped_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_u8s8s32x_wino_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_x8s8s32x_convolution_fwd_t)
@@ -388,6 +400,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AMX(jit_avx512_core_amx_convolution_fwd_t)
             CPU_INSTANCE_AVX512(brgemm_1x1_convolution_fwd_t<avx512_core_vnni>)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core_vnni>)
+            CPU_INSTANCE_AVX512(jit_avx512_core_grouped_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_u8s8s32x_wino_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_x8s8s32x_convolution_fwd_t)
@@ -410,6 +423,7 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
             CPU_INSTANCE_AMX(jit_avx512_core_amx_convolution_fwd_t)
             CPU_INSTANCE_AVX512(brgemm_1x1_convolution_fwd_t<avx512_core_vnni>)
             CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core_vnni>)
+            CPU_INSTANCE_AVX512(jit_avx512_core_grouped_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_u8s8s32x_wino_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_x8s8s32x_convolution_fwd_t)
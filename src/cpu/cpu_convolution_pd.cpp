@@ -0,0 +1,42 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+#if DNNL_X64
+#include "cpu/x64/jit_conv_cost_model.hpp"
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t conv_time_estimate(const convolution_pd_t *pd, double *result) {
+#if DNNL_X64
+    *result = x64::conv_cost_model::time_estimate(pd);
+    return status::success;
+#else
+    UNUSED(pd);
+    UNUSED(result);
+    return status::unimplemented;
+#endif
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
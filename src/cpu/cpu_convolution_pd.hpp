@@ -30,9 +30,20 @@ namespace dnnl {
 namespace impl {
 namespace cpu {
 
+// Answers query::time_estimate_f64 with the analytical estimate of the
+// convolution cost model. The query stays unimplemented on architectures
+// without one.
+status_t conv_time_estimate(const convolution_pd_t *pd, double *result);
+
 struct cpu_convolution_fwd_pd_t : public convolution_fwd_pd_t {
     using convolution_fwd_pd_t::convolution_fwd_pd_t;
 
+    status_t query(query_t what, int idx, void *result) const override {
+        if (what == query::time_estimate_f64)
+            return conv_time_estimate(this, (double *)result);
+        return convolution_fwd_pd_t::query(what, idx, result);
+    }
+
     bool has_padded_dst() const {
         memory_desc_wrapper dst_d(&dst_md_);
         return OC() != dst_d.padded_dims()[1];
@@ -62,11 +73,23 @@ struct cpu_convolution_fwd_pd_t : public convolution_fwd_pd_t {
 
 struct cpu_convolution_bwd_data_pd_t : public convolution_bwd_data_pd_t {
     using convolution_bwd_data_pd_t::convolution_bwd_data_pd_t;
+
+    status_t query(query_t what, int idx, void *result) const override {
+        if (what == query::time_estimate_f64)
+            return conv_time_estimate(this, (double *)result);
+        return convolution_bwd_data_pd_t::query(what, idx, result);
+    }
 };
 
 struct cpu_convolution_bwd_weights_pd_t : public convolution_bwd_weights_pd_t {
     using convolution_bwd_weights_pd_t::convolution_bwd_weights_pd_t;
 
+    status_t query(query_t what, int idx, void *result) const override {
+        if (what == query::time_estimate_f64)
+            return conv_time_estimate(this, (double *)result);
+        return convolution_bwd_weights_pd_t::query(what, idx, result);
+    }
+
     bool wants_padded_bias() const {
         if (!with_bias()) return false;
         memory_desc_wrapper diff_dst_d(&diff_dst_md_);
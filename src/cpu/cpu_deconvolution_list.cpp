@@ -23,6 +23,7 @@
 #include "cpu/x64/jit_avx512_core_amx_deconvolution.hpp"
 #include "cpu/x64/jit_avx512_core_x8s8s32x_1x1_deconvolution.hpp"
 #include "cpu/x64/jit_avx512_core_x8s8s32x_deconvolution.hpp"
+#include "cpu/x64/jit_brgemm_deconv.hpp"
 #include "cpu/x64/jit_uni_x8s8s32x_1x1_deconvolution.hpp"
 #include "cpu/x64/jit_uni_x8s8s32x_deconvolution.hpp"
 using namespace dnnl::impl::cpu::x64;
@@ -44,6 +45,11 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
     static const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> the_map = REG_DECONV_P({
         {{forward}, {
             CPU_INSTANCE_AMX(jit_avx512_core_amx_deconvolution_fwd_t)
+            CPU_INSTANCE_AMX(brgemm_deconvolution_fwd_t<avx512_core_bf16_amx_bf16>)
+            CPU_INSTANCE_AMX(brgemm_deconvolution_fwd_t<avx512_core_bf16_amx_int8>)
+            CPU_INSTANCE_AVX512(brgemm_deconvolution_fwd_t<avx512_core_bf16>)
+            CPU_INSTANCE_AVX512(brgemm_deconvolution_fwd_t<avx512_core_vnni>)
+            CPU_INSTANCE_AVX512(brgemm_deconvolution_fwd_t<avx512_core>)
             CPU_INSTANCE_AVX512(jit_avx512_core_x8s8s32x_1x1_deconvolution_fwd_t)
             CPU_INSTANCE_AVX512(jit_avx512_core_x8s8s32x_deconvolution_fwd_t)
             CPU_INSTANCE_AVX2(jit_uni_x8s8s32x_1x1_deconvolution_fwd_t<avx2>)
@@ -55,10 +61,14 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             nullptr,
         }},
         {{backward_data}, REG_BWD_PK({
+            CPU_INSTANCE_AMX(brgemm_deconvolution_bwd_data_t<avx512_core_bf16_amx_bf16>)
+            CPU_INSTANCE_AVX512(brgemm_deconvolution_bwd_data_t<avx512_core_bf16>)
+            CPU_INSTANCE_AVX512(brgemm_deconvolution_bwd_data_t<avx512_core>)
             CPU_INSTANCE(ref_deconvolution_bwd_data_t)
             nullptr,
         })},
         {{backward_weights}, REG_BWD_PK({
+            CPU_INSTANCE_AMX(brgemm_deconvolution_bwd_weights_t)
             CPU_INSTANCE(ref_deconvolution_bwd_weights_t)
             nullptr,
         })},
@@ -57,8 +57,9 @@ DECLARE_IMPL_LIST(binary);
 DECLARE_IMPL_LIST(convolution);
 DECLARE_IMPL_LIST(deconvolution);
 DECLARE_IMPL_LIST(eltwise);
+DECLARE_IMPL_LIST(group_normalization);
 DECLARE_IMPL_LIST(inner_product);
-DECLARE_IMPL_LIST(layer_normalization);
+DECLARE_IMPL_LIST(layer_normalization_v2);
 DECLARE_IMPL_LIST(lrn);
 DECLARE_IMPL_LIST(logsoftmax);
 DECLARE_IMPL_LIST(matmul);
@@ -93,8 +94,10 @@ public:
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(group_normalization);
             CASE(inner_product);
-            CASE(layer_normalization);
+            case primitive_kind::layer_normalization:
+            CASE(layer_normalization_v2);
             CASE(lrn);
             CASE(logsoftmax);
             CASE(matmul);
@@ -50,8 +50,8 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
 // clang-format on
 } // namespace
 
-const impl_list_item_t *get_layer_normalization_impl_list(
-        const layer_normalization_desc_t *desc) {
+const impl_list_item_t *get_layer_normalization_v2_impl_list(
+        const layer_normalization_v2_desc_t *desc) {
     static const impl_list_item_t empty_list[] = {nullptr};
 
     const bool is_fwd = utils::one_of(
@@ -35,8 +35,10 @@ constexpr impl_list_item_t impl_list[] = REG_REDUCTION_P({
     CPU_INSTANCE_X64(jit_uni_reduction_t)
 
     CPU_INSTANCE(ref_reduction_t<f32, f32, f32>)
+    CPU_INSTANCE(ref_reduction_t<f32, s32, f32>)
     CPU_INSTANCE(ref_reduction_t<bf16, bf16, f32>)
     CPU_INSTANCE(ref_reduction_t<bf16, f32, f32>)
+    CPU_INSTANCE(ref_reduction_t<bf16, s32, f32>)
     CPU_INSTANCE(ref_reduction_t<s8, s8, s32>)
     CPU_INSTANCE(ref_reduction_t<s8, s32, s32>)
     CPU_INSTANCE(ref_reduction_t<s8, f32, f32>)
@@ -54,6 +54,8 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
         }},
         {{backward}, REG_BWD_PK({
             CPU_INSTANCE_X64(jit_uni_softmax_bwd_t<avx512_core>)
+            CPU_INSTANCE_X64(jit_uni_softmax_bwd_t<avx2>)
+            CPU_INSTANCE_X64(jit_uni_softmax_bwd_t<sse41>)
             CPU_INSTANCE(ref_softmax_bwd_t)
             nullptr,
         })},
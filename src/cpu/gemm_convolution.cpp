@@ -42,6 +42,22 @@ struct im_pos_t {
                         || ic != prev.ic);
     }
 };
+
+// Adds the partial bias gradients of the minibatch threads 1..nthr_mb-1 to
+// diff_bias, which already holds the ones of the first thread.
+void bwd_bias_reduction(const conv_gemm_conf_t &jcp, int nthr_mb,
+        size_t g_start, size_t g_end, const float *bias_reduce_base,
+        float *diff_bias) {
+    for_(size_t g = g_start; g < g_end; ++g)
+    for (int tidx = 1; tidx < nthr_mb; ++tidx) {
+        const float *__restrict db_ws
+                = bias_reduce_base + (tidx - 1) * jcp.oc;
+        float *__restrict db = diff_bias + g * jcp.oc;
+        PRAGMA_OMP_SIMD()
+        for (dim_t oc = 0; oc < jcp.oc; ++oc)
+            db[oc] += db_ws[oc];
+    }
+}
 } // namespace
 
 status_t gemm_convolution_fwd_t::execute_forward_nspc(
@@ -596,6 +612,8 @@ status_t gemm_convolution_bwd_weights_t::execute_backward_weights_nspc(
 
     auto wei_reduction
             = ctx.get_scratchpad_grantor().get<data_t>(key_conv_wei_reduction);
+    auto bia_reduction
+            = ctx.get_scratchpad_grantor().get<data_t>(key_conv_bia_reduction);
 
     const dim_t K = jcp.os * static_cast<size_t>(jcp.od);
     const size_t src_step
@@ -622,7 +640,9 @@ status_t gemm_convolution_bwd_weights_t::execute_backward_weights_nspc(
         assert(IMPLICATION(!jcp.need_wei_reduction, nthr_mb == 1));
 
         const int need_reduction = nthr_mb != 1;
-        const dim_t LDC = need_reduction ? jcp.oc : jcp.ngroups * jcp.oc;
+        // the first minibatch thread accumulates directly in diff_weights
+        const bool use_diff_wei = ithr_mb == 0;
+        const dim_t LDC = use_diff_wei ? jcp.ngroups * jcp.oc : jcp.oc;
         data_t *__restrict imtr
                 = ctx.get_scratchpad_grantor().get<data_t>(key_conv_gemm_imtr)
                 + (ptrdiff_t)ithr * jcp.id * jcp.ic * jcp.is;
@@ -643,17 +663,41 @@ status_t gemm_convolution_bwd_weights_t::execute_backward_weights_nspc(
             }
 
             data_t *weights_reduce_base = wei_reduction
-                    + ithr_g * nthr_mb * weights_g_size * jcp.ks * jcp.ic;
-            data_t *weights_reduce = weights_reduce_base
-                    + ithr_mb * weights_g_size * jcp.ks * jcp.ic;
+                    + ithr_g * (nthr_mb - 1) * weights_g_size * jcp.ks * jcp.ic;
+            data_t *bias_reduce_base
+                    = bia_reduction + ithr_g * (nthr_mb - 1) * jcp.oc;
 
             for (size_t g = g_start; g < g_end; ++g) {
-                data_t *_diff_weights = need_reduction
-                        ? weights_reduce
-                        : diff_weights + g * weights_g_size;
+                data_t *_diff_weights = use_diff_wei
+                        ? diff_weights + g * weights_g_size
+                        : weights_reduce_base
+                                + (ithr_mb - 1) * weights_g_size * jcp.ks
+                                        * jcp.ic;
+                data_t *_diff_bias = nullptr;
+                if (jcp.with_bias)
+                    _diff_bias = use_diff_wei
+                            ? diff_bias + g * jcp.oc
+                            : bias_reduce_base + (ithr_mb - 1) * jcp.oc;
                 for (size_t mb = mb_start; mb < mb_end; ++mb) {
                     const data_t *_src
                             = src + mb * jcp.ngroups * src_step + g * jcp.ic;
+                    if (jcp.with_bias) {
+                        // diff_dst of this image is about to be read by
+                        // gemm, reduce it for the bias gradient on the way
+                        if (mb == mb_start)
+                            for (dim_t oc = 0; oc < jcp.oc; ++oc)
+                                _diff_bias[oc] = 0;
+                        const data_t *_diff_dst = diff_dst
+                                + mb * jcp.ngroups * dst_step + g * jcp.oc;
+                        for (dim_t os = 0; os < K; ++os) {
+                            const data_t *__restrict dd
+                                    = _diff_dst + os * jcp.ngroups * jcp.oc;
+                            data_t *__restrict db = _diff_bias;
+                            PRAGMA_OMP_SIMD()
+                            for (dim_t oc = 0; oc < jcp.oc; ++oc)
+                                db[oc] += dd[oc];
+                        }
+                    }
                     if (jcp.im2col_sz && is_problem_3d)
                         jit_gemm_convolution_utils::transpose_dt(
                                 jcp, _src, imtr);
@@ -696,6 +740,9 @@ status_t gemm_convolution_bwd_weights_t::execute_backward_weights_nspc(
                 jit_gemm_convolution_utils::bwd_weights_reduction_par_nspc(
                         ithr_mb, nthr_mb, g_start, g_end, jcp,
                         weights_reduce_base, diff_weights);
+                if (jcp.with_bias && ithr_mb == 0)
+                    bwd_bias_reduction(jcp, nthr_mb, g_start, g_end,
+                            bias_reduce_base, diff_bias);
             }
         } else {
             if (need_reduction && dnnl_thr_syncable()) dnnl_thr_barrier();
@@ -722,36 +769,20 @@ status_t gemm_convolution_bwd_weights_t::execute_backward_weights_nspc(
                 assert(IMPLICATION((g_end - g_start) > 1, need_reduction == 0));
 
                 data_t *weights_reduce_base = wei_reduction
-                        + ithr_g * nthr_mb * weights_g_size * jcp.ic * jcp.ks;
+                        + ithr_g * (nthr_mb - 1) * weights_g_size * jcp.ic
+                                * jcp.ks;
 
                 jit_gemm_convolution_utils::bwd_weights_reduction_par_nspc(
                         ithr_mb, nthr_mb, g_start, g_end, jcp,
                         weights_reduce_base, diff_weights);
+                if (jcp.with_bias && ithr_mb == 0)
+                    bwd_bias_reduction(jcp, nthr_mb, g_start, g_end,
+                            bia_reduction + ithr_g * (nthr_mb - 1) * jcp.oc,
+                            diff_bias);
             }
         });
     }
 
-    if (jcp.with_bias) {
-        parallel_nd(jcp.ngroups, jcp.oc, [&](dim_t g, dim_t oc) {
-            data_t db = 0;
-            const size_t offset_base = g * jcp.oc + oc;
-            for_(dim_t mb = 0; mb < jcp.mb; ++mb)
-            for_(dim_t od = 0; od < jcp.od; ++od)
-            for (dim_t oh = 0; oh < jcp.oh; ++oh) {
-                const data_t *__restrict diff_dst_arr = diff_dst + offset_base
-                        + ((static_cast<size_t>(mb) * jcp.od + od) * jcp.oh
-                                  + oh)
-                                * jcp.ow * jcp.ngroups * jcp.oc;
-                const int width_stride = jcp.ngroups * jcp.oc;
-
-                PRAGMA_OMP_SIMD(reduction(+ : db))
-                for (int ow = 0; ow < jcp.ow; ++ow) {
-                    db += diff_dst_arr[ow * width_stride];
-                }
-            }
-            diff_bias[g * jcp.oc + oc] = db;
-        });
-    }
     return st;
 }
 
@@ -765,6 +796,8 @@ status_t gemm_convolution_bwd_weights_t::execute_backward_weights_ncsp(
     auto col = ctx.get_scratchpad_grantor().get<data_t>(key_conv_gemm_col);
     auto wei_reduction
             = ctx.get_scratchpad_grantor().get<data_t>(key_conv_wei_reduction);
+    auto bia_reduction
+            = ctx.get_scratchpad_grantor().get<data_t>(key_conv_bia_reduction);
 
     const conv_gemm_conf_t &jcp = this->pd()->jcp_;
 
@@ -805,18 +838,40 @@ status_t gemm_convolution_bwd_weights_t::execute_backward_weights_ncsp(
                 for (ptrdiff_t i = 0; i < jcp.im2col_sz; i++)
                     _col[i] = (data_t)0;
             }
+            // the first minibatch thread accumulates directly in
+            // diff_weights
+            const bool use_diff_wei = ithr_mb == 0;
             data_t *weights_reduce_base
-                    = wei_reduction + ithr_g * nthr_mb * weights_g_size;
-            data_t *weights_reduce
-                    = weights_reduce_base + ithr_mb * weights_g_size;
+                    = wei_reduction + ithr_g * (nthr_mb - 1) * weights_g_size;
+            data_t *bias_reduce_base
+                    = bia_reduction + ithr_g * (nthr_mb - 1) * jcp.oc;
 
             for (size_t g = g_start; g < g_end; ++g) {
-                data_t *_diff_weights = need_reduction
-                        ? weights_reduce
-                        : (diff_weights + g * weights_g_size);
+                data_t *_diff_weights = use_diff_wei
+                        ? diff_weights + g * weights_g_size
+                        : weights_reduce_base + (ithr_mb - 1) * weights_g_size;
+                data_t *_diff_bias = nullptr;
+                if (jcp.with_bias)
+                    _diff_bias = use_diff_wei
+                            ? diff_bias + g * jcp.oc
+                            : bias_reduce_base + (ithr_mb - 1) * jcp.oc;
                 for (size_t mb = mb_start; mb < mb_end; ++mb) {
                     const data_t *_src
                             = src + (mb * jcp.ngroups + g) * src_step;
+                    if (jcp.with_bias) {
+                        // diff_dst of this image is about to be read by
+                        // gemm, reduce it for the bias gradient on the way
+                        const data_t *_diff_dst
+                                = diff_dst + (mb * jcp.ngroups + g) * dst_step;
+                        for (dim_t oc = 0; oc < jcp.oc; ++oc) {
+                            const data_t *__restrict dd = _diff_dst + oc * K;
+                            data_t db = mb == mb_start ? 0 : _diff_bias[oc];
+                            PRAGMA_OMP_SIMD(reduction(+ : db))
+                            for (dim_t os = 0; os < K; ++os)
+                                db += dd[os];
+                            _diff_bias[oc] = db;
+                        }
+                    }
                     for_(int od = 0; od < jcp.od; ++od)
                     for (int os_nb = 0; os_nb < jcp.os_nb_block; ++os_nb) {
                         auto out_off = os_nb * k + od * jcp.os;
@@ -862,6 +917,9 @@ status_t gemm_convolution_bwd_weights_t::execute_backward_weights_ncsp(
                 jit_gemm_convolution_utils::bwd_weights_reduction_par_ncsp(
                         ithr_mb, nthr_mb, jcp, weights_reduce_base,
                         weights_base);
+                if (jcp.with_bias && ithr_mb == 0)
+                    bwd_bias_reduction(jcp, nthr_mb, g_start, g_end,
+                            bias_reduce_base, diff_bias);
             }
         } else {
             if (need_reduction && dnnl_thr_syncable()) dnnl_thr_barrier();
@@ -887,36 +945,21 @@ status_t gemm_convolution_bwd_weights_t::execute_backward_weights_ncsp(
 
                 assert(IMPLICATION((g_end - g_start) > 1, need_reduction == 0));
 
-                data_t *weights_reduce_base
-                        = wei_reduction + ithr_g * nthr_mb * weights_g_size;
+                data_t *weights_reduce_base = wei_reduction
+                        + ithr_g * (nthr_mb - 1) * weights_g_size;
                 data_t *weights_base = diff_weights + g_start * weights_g_size;
 
                 jit_gemm_convolution_utils::bwd_weights_reduction_par_ncsp(
                         ithr_mb, nthr_mb, jcp, weights_reduce_base,
                         weights_base);
+                if (jcp.with_bias && ithr_mb == 0)
+                    bwd_bias_reduction(jcp, nthr_mb, g_start, g_end,
+                            bia_reduction + ithr_g * (nthr_mb - 1) * jcp.oc,
+                            diff_bias);
             }
         });
     }
 
-    if (jcp.with_bias) {
-        parallel_nd(jcp.ngroups, jcp.oc, [&](dim_t g, dim_t oc) {
-            data_t db = 0;
-            dim_t offset_ = g * dst_step + oc * K;
-            for (dim_t mb = 0; mb < jcp.mb; ++mb) {
-                dim_t offset = offset_ + mb * jcp.ngroups * dst_step;
-                for_(dim_t od = 0; od < jcp.od; ++od)
-                for (dim_t oh = 0; oh < jcp.oh; ++oh) {
-                    PRAGMA_OMP_SIMD(reduction(+ : db))
-                    for (dim_t ow = 0; ow < jcp.ow; ++ow) {
-                        db += diff_dst[offset + ow];
-                    }
-                    offset += jcp.ow;
-                }
-            }
-            diff_bias[g * jcp.oc + oc] = db;
-        });
-    }
-
     return st;
 }
 
@@ -998,6 +998,30 @@ void col2im(const conv_gemm_conf_t &jcp, const float *col, float *im,
         parallel_nd(jcp.ic, ker);
 }
 
+namespace {
+// Books the per-group diff_weights copies used by the minibatch reduction of
+// the f32 and bf16 backward by weights. As cpu_reducer does for the jit
+// implementations, the f32 implementation accumulates the first minibatch
+// chunk of each group directly in diff_weights and the bias gradient
+// alongside, the bf16 one needs an f32 copy for every thread.
+void book_bwd_weights_reduction(memory_tracking::registrar_t &scratchpad,
+        const conv_gemm_conf_t &jcp, bool is_bf16_conv) {
+    using namespace memory_tracking::names;
+    const size_t wei_g_size = (size_t)jcp.ic * jcp.oc * jcp.ks;
+    if (is_bf16_conv) {
+        scratchpad.book<float>(key_conv_wei_reduction, jcp.nthr * wei_g_size);
+        return;
+    }
+    const size_t copies = jcp.need_wei_reduction
+            ? bwd_weights_reduction_copies(jcp.nthr, jcp.ngroups, jcp.mb)
+            : 0;
+    if (copies == 0) return;
+    scratchpad.book<float>(key_conv_wei_reduction, copies * wei_g_size);
+    if (jcp.with_bias)
+        scratchpad.book<float>(key_conv_bia_reduction, copies * jcp.oc);
+}
+} // namespace
+
 status_t init_conf(conv_gemm_conf_t &jcp,
         memory_tracking::registrar_t &scratchpad, const convolution_desc_t &cd,
         memory_desc_t &src_md, memory_desc_t &weights_md, memory_desc_t &dst_md,
@@ -1972,10 +1996,11 @@ status_t init_conf(conv_gemm_conf_t &jcp,
 
             // Potential scratchpad memory requirement when outer threading is
             // enabled during f32/bf16 BWD_W nspc convolution
+            const size_t wei_g_size = (size_t)jcp.ic * jcp.oc * jcp.ks;
             size_t thr_mem_estimate = max_threads
                     * (gemm_col_datatype_size * jcp.im2col_sz
                             + gemm_col_datatype_size * jcp.id * jcp.is * jcp.ic
-                            + sizeof(float) * weights_d.size());
+                            + sizeof(float) * wei_g_size);
             if (is_bf16_conv) {
                 thr_mem_estimate += sizeof(float) * weights_d.size();
                 if (jcp.with_bias
@@ -1995,8 +2020,7 @@ status_t init_conf(conv_gemm_conf_t &jcp,
                     gemm_col_datatype_size);
 
             jcp.need_wei_reduction = jcp.mb != 1 && jcp.nthr != 1;
-            scratchpad.book<float>(
-                    key_conv_wei_reduction, jcp.nthr * weights_d.size());
+            book_bwd_weights_reduction(scratchpad, jcp, is_bf16_conv);
             scratchpad.book(key_conv_gemm_imtr,
                     static_cast<size_t>(jcp.nthr) * jcp.id * jcp.is * jcp.ic,
                     gemm_col_datatype_size);
@@ -2013,8 +2037,8 @@ status_t init_conf(conv_gemm_conf_t &jcp,
         } else if (!jcp.is_nspc && is_bwd_w) {
             // Potential scratchpad memory requirement when outer threading is
             // enabled during f32/bf16 BWD_W blocked convolution
-            size_t thr_mem_estimate
-                    = sizeof(float) * max_threads * weights_d.size();
+            const size_t wei_g_size = (size_t)jcp.ic * jcp.oc * jcp.ks;
+            size_t thr_mem_estimate = sizeof(float) * max_threads * wei_g_size;
             if (is_bf16_conv) {
                 thr_mem_estimate += sizeof(float) * weights_d.size();
                 if (jcp.with_bias
@@ -2040,8 +2064,7 @@ status_t init_conf(conv_gemm_conf_t &jcp,
             const int sizeof_cacheline_float = 16;
             if (is_bwd_w) {
                 jcp.need_wei_reduction = jcp.mb != 1 && jcp.nthr != 1;
-                scratchpad.book<float>(
-                        key_conv_wei_reduction, jcp.nthr * weights_d.size());
+                book_bwd_weights_reduction(scratchpad, jcp, is_bf16_conv);
             }
 
             if (is_bf16_conv) {
@@ -2130,6 +2153,19 @@ void bwd_weights_balance(int ithr, int nthr, int ngroups, int mb, int &ithr_g,
     }
 }
 
+int bwd_weights_reduction_copies(int nthr, int ngroups, int mb) {
+    // The threads actually running the primitive may be fewer than nthr,
+    // which changes the split between groups and minibatch.
+    int copies = 0;
+    for (int t = 1; t <= nthr; ++t) {
+        int ithr_g, nthr_g, ithr_mb, nthr_mb;
+        bwd_weights_balance(
+                0, t, ngroups, mb, ithr_g, nthr_g, ithr_mb, nthr_mb);
+        copies = nstl::max(copies, nthr_g * (nthr_mb - 1));
+    }
+    return copies;
+}
+
 void bwd_weights_reduction_par_ncsp(int ithr, int nthr,
         const conv_gemm_conf_t &jcp, const float *weights_reduce_ws,
         float *weights) {
@@ -2138,10 +2174,20 @@ void bwd_weights_reduction_par_ncsp(int ithr, int nthr,
     size_t weights_start {0}, weights_end {0};
     balance211(weights_g_size, nthr, ithr, weights_start, weights_end);
 
-    for (int i = 0; i < nthr; ++i) {
-        const float *ws_i = weights_reduce_ws + i * weights_g_size;
-        for (size_t s = weights_start; s < weights_end; ++s)
-            weights[s] = (i == 0 ? 0 : weights[s]) + ws_i[s];
+    // weights already hold the partial sums of the first thread, the chunk
+    // of weights stays in cache while the copies of the others stream in
+    const size_t chunk = 1024;
+    for (size_t c_start = weights_start; c_start < weights_end;
+            c_start += chunk) {
+        const size_t c_end = nstl::min(weights_end, c_start + chunk);
+        for (int i = 1; i < nthr; ++i) {
+            const float *__restrict ws_i
+                    = weights_reduce_ws + (i - 1) * weights_g_size;
+            float *__restrict w = weights;
+            PRAGMA_OMP_SIMD()
+            for (size_t s = c_start; s < c_end; ++s)
+                w[s] += ws_i[s];
+        }
     }
 }
 
@@ -2155,24 +2201,17 @@ void bwd_weights_reduction_par_nspc(int ithr, int nthr, size_t g_start,
     // Threads divide work w.r.t. min-batch and groups, therefore
     //   - weights_reduce_base format: spatial-input_channels-output_channels
     //   - diff_weights format: spatial-input_channels-groups-output_channels
-    for (auto tidx = 0; tidx < nthr; ++tidx) {
-        const float *ws_base
-                = weights_reduce_base + tidx * weights_g_size * jcp.ks * jcp.ic;
-        for_(auto w = weights_start; w < weights_end; ++w)
-        for (auto g = g_start; g < g_end; ++g) {
-            float *__restrict dwei_ptr
-                    = diff_weights + (w * jcp.ngroups + g) * jcp.oc;
-            const float *__restrict ws_ptr = ws_base + w * jcp.oc;
-            if (tidx == 0) {
-                PRAGMA_OMP_SIMD()
-                for (auto oc = 0; oc < jcp.oc; ++oc) {
-                    dwei_ptr[oc] = ws_ptr[oc];
-                }
-            } else {
-                PRAGMA_OMP_SIMD()
-                for (auto oc = 0; oc < jcp.oc; ++oc) {
-                    dwei_ptr[oc] += ws_ptr[oc];
-                }
+    // diff_weights already hold the partial sums of the first thread.
+    for_(auto w = weights_start; w < weights_end; ++w)
+    for (auto g = g_start; g < g_end; ++g) {
+        float *__restrict dwei_ptr
+                = diff_weights + (w * jcp.ngroups + g) * jcp.oc;
+        for (auto tidx = 1; tidx < nthr; ++tidx) {
+            const float *__restrict ws_ptr = weights_reduce_base
+                    + ((tidx - 1) * jcp.ks * jcp.ic + w) * weights_g_size;
+            PRAGMA_OMP_SIMD()
+            for (auto oc = 0; oc < jcp.oc; ++oc) {
+                dwei_ptr[oc] += ws_ptr[oc];
             }
         }
     }
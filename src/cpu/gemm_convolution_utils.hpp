@@ -120,6 +120,9 @@ status_t init_conf(conv_gemm_conf_t &jcp,
 
 void bwd_weights_balance(int ithr, int nthr, int ngroups, int mb, int &ithr_g,
         int &nthr_g, int &ithr_mb, int &nthr_mb);
+// Returns the number of per-group diff_weights copies needed by the f32
+// minibatch reduction with at most nthr threads.
+int bwd_weights_reduction_copies(int nthr, int ngroups, int mb);
 void bwd_weights_reduction_par_ncsp(int ithr, int nthr,
         const conv_gemm_conf_t &jcp, const float *weights_reduce_ws,
         float *weights);
@@ -97,6 +97,12 @@ status_t ncsp_batch_normalization_fwd_t<d_type>::execute_forward(
     size_t data_size = N * C * SP * sizeof(data_t);
     bool do_blocking = (data_size >= l3_size_ / 2 && l3_size_ > 0);
 
+    // One-pass statistics accumulate sums and sums of squares shifted by the
+    // first value of each channel, the shift is kept in mean until reduction.
+    const bool stats_one_pass
+            = calculate_stats && bnorm_utils::use_stats_one_pass(pd());
+    if (stats_one_pass) bnorm_utils::init_stats_shift(pd(), src, mean);
+
     parallel(nthr, [&](const int ithr, const int nthr) {
         int C_ithr = 0, C_nthr = 0;
         int N_ithr = 0, N_nthr = 0;
@@ -146,9 +152,62 @@ status_t ncsp_batch_normalization_fwd_t<d_type>::execute_forward(
             // might change (due to re-balance on C). Since sync is not always
             // possible (in case of TBB) use different parts of ws for each
             // iteration if threads are not synced by the algorithm.
-            size_t ws_iter_off = (dnnl_thr_syncable() ? 0 : 1) * C_off;
+            // One-pass statistics keep the sums of squares right after the
+            // sums, as the backward pass does for diff_gamma and diff_beta.
+            size_t ws_iter_off = (dnnl_thr_syncable() ? 0 : 1)
+                    * (stats_one_pass ? 2 : 1) * C_off;
 
-            if (calculate_stats) {
+            if (stats_one_pass) {
+                acc_data_t *mean_blk = mean + C_off;
+                acc_data_t *variance_blk = variance + C_off;
+                for (dim_t c = C_blk_s; c < C_blk_e; c++) {
+                    size_t off = c + C_off;
+                    const acc_data_t shift_c = mean[off];
+                    acc_data_t sum = 0., sqsum = 0.;
+                    for (dim_t n = N_s; n < N_e; ++n) {
+                        const acc_data_t *_src;
+                        size_t soff = off * SP + n * C * SP;
+                        if (d_type == bf16) {
+                            // convert src from bf16 to f32
+                            acc_data_t *tmp_src
+                                    = bf16_src_cvt_wsp + ithr * SP_cl_align;
+                            cvt_bfloat16_to_float(tmp_src + S_s,
+                                    (bfloat16_t *)src + soff + S_s, S_chunk);
+                            _src = tmp_src;
+                        } else {
+                            _src = reinterpret_cast<const acc_data_t *>(
+                                    src + soff);
+                        }
+                        PRAGMA_OMP_SIMD(reduction(+ : sum, sqsum))
+                        for (dim_t sp = S_s; sp < S_e; ++sp) {
+                            acc_data_t m = _src[sp] - shift_c;
+                            sum += m;
+                            sqsum += m * m;
+                        }
+                    }
+                    const size_t r_off
+                            = ws_iter_off + SP_N_ithr * C_blks_per_iter + c;
+                    ws_reduce[r_off] = sum;
+                    ws_reduce[r_off + SP_N_nthr * C_blks_per_iter] = sqsum;
+                }
+
+                if (dnnl_thr_syncable()) dnnl_thr_barrier();
+
+                for (dim_t c = C_blk_gl_s; c < C_blk_gl_e; c++) {
+                    acc_data_t sum = 0., sqsum = 0.;
+                    for (dim_t n = 0; n < SP_N_nthr; n++) {
+                        const size_t r_off
+                                = ws_iter_off + n * C_blks_per_iter + c;
+                        sum += ws_reduce[r_off];
+                        sqsum += ws_reduce[r_off + SP_N_nthr * C_blks_per_iter];
+                    }
+                    const acc_data_t m = sum / (N * SP);
+                    variance_blk[c] = nstl::max(sqsum / (N * SP) - m * m, 0.f);
+                    mean_blk[c] += m;
+                }
+
+                if (dnnl_thr_syncable()) dnnl_thr_barrier();
+            } else if (calculate_stats) {
                 acc_data_t *mean_blk = mean + C_off;
                 acc_data_t *variance_blk = variance + C_off;
                 for (dim_t c = C_blk_s; c < C_blk_e; c++) {
@@ -29,6 +29,7 @@
 #include "cpu/platform.hpp"
 
 #include "cpu/cpu_batch_normalization_pd.hpp"
+#include "cpu/cpu_batch_normalization_utils.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -72,8 +73,11 @@ struct ncsp_batch_normalization_fwd_t : public primitive_t {
             using namespace memory_tracking::names;
             auto scratchpad = scratchpad_registry().registrar();
             if (!stats_is_src()) {
+                // one-pass statistics keep sums and sums of squares
+                const int n_rbufs
+                        = bnorm_utils::use_stats_one_pass(this) ? 2 : 1;
                 scratchpad.template book<acc_data_t>(
-                        key_bnorm_reduction, C() * nthr_);
+                        key_bnorm_reduction, n_rbufs * C() * nthr_);
 
                 if (!is_training()) {
                     scratchpad.template book<acc_data_t>(
@@ -100,8 +100,66 @@ status_t nspc_batch_normalization_fwd_t<d_type>::execute_forward(
         return res;
     };
     const int nthr = pd()->nthr_;
+    const bool stats_one_pass = bnorm_utils::use_stats_one_pass(pd());
 
-    if (calculate_stats) {
+    if (calculate_stats && stats_one_pass) {
+        // Single pass over src: accumulate shifted sums and sums of squares
+        // per thread, the shift is stored in mean until the reduction.
+        acc_data_t *ws_sqsum = ws_reduce + C * nthr;
+        bnorm_utils::init_stats_shift(pd(), src, mean);
+        parallel(nthr, [&](const int ithr, const int nthr) {
+            dim_t N_s = 0, N_e = 0;
+            balance211(N, nthr, ithr, N_s, N_e);
+
+            for (dim_t c = 0; c < C; c++) {
+                ws_reduce[C * ithr + c] = 0.;
+                ws_sqsum[C * ithr + c] = 0.;
+            }
+
+            for (dim_t n = N_s; n < N_e; n++) {
+                for (dim_t sp = 0; sp < SP; sp++) {
+                    const acc_data_t *_src;
+                    const size_t s_off = (size_t)n * SP * C + sp * C;
+                    if (d_type == bf16) {
+                        // convert src from b16 to f32
+                        acc_data_t *tmp_src = tmp_data_ + ithr * C_align;
+                        cvt_bfloat16_to_float(
+                                tmp_src, (bfloat16_t *)src + s_off, C);
+                        _src = tmp_src;
+                    } else {
+                        _src = reinterpret_cast<const acc_data_t *>(
+                                src + s_off);
+                    }
+                    PRAGMA_OMP_SIMD()
+                    for (int c = 0; c < C; c++) {
+                        acc_data_t m = _src[c] - mean[c];
+                        ws_reduce[C * ithr + c] += m;
+                        ws_sqsum[C * ithr + c] += m * m;
+                    }
+                }
+            }
+        });
+        parallel_nd(C, [&](dim_t c) {
+            acc_data_t sum = 0, sqsum = 0;
+            for (dim_t n = 0; n < nthr; n++) {
+                sum += ws_reduce[C * n + c];
+                sqsum += ws_sqsum[C * n + c];
+            }
+            const acc_data_t m = sum / (SP * N);
+            variance[c] = nstl::max(sqsum / (SP * N) - m * m, 0.f);
+            mean[c] += m;
+        });
+        parallel(nthr, [&](const int ithr, const int nthr) {
+            acc_data_t *mean_loc = tmp_mean + nstl::max(C, (dim_t)16) * ithr;
+            acc_data_t *variance_loc = tmp_var + nstl::max(C, (dim_t)16) * ithr;
+            if (ithr > 0 || save_stats) {
+                for (dim_t c = 0; c < C; c++) {
+                    mean_loc[c] = mean[c];
+                    variance_loc[c] = variance[c];
+                }
+            }
+        });
+    } else if (calculate_stats) {
         parallel(nthr, [&](const int ithr, const int nthr) {
             dim_t N_s = 0, N_e = 0;
             balance211(N, nthr, ithr, N_s, N_e);
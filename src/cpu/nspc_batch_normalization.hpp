@@ -27,6 +27,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_batch_normalization_pd.hpp"
+#include "cpu/cpu_batch_normalization_utils.hpp"
 #include "cpu/platform.hpp"
 
 namespace dnnl {
@@ -74,8 +75,11 @@ struct nspc_batch_normalization_fwd_t : public primitive_t {
             auto scratchpad = scratchpad_registry().registrar();
             if (!stats_is_src()) {
                 const size_t stats_buf_sz = nstl::max(C(), dim_t(16)) * nthr_;
+                // one-pass statistics keep sums and sums of squares
+                const int n_rbufs
+                        = bnorm_utils::use_stats_one_pass(this) ? 2 : 1;
                 scratchpad.template book<acc_data_t>(
-                        key_bnorm_reduction, stats_buf_sz);
+                        key_bnorm_reduction, n_rbufs * stats_buf_sz);
                 scratchpad.template book<acc_data_t>(
                         key_bnorm_tmp_mean, stats_buf_sz);
                 scratchpad.template book<acc_data_t>(
@@ -309,7 +309,9 @@ struct ref_deconvolution_bwd_data_t : public primitive_t {
 
         DECLARE_COMMON_PD_T(conv_pd_->name(), ref_deconvolution_bwd_data_t);
 
-        status_t init_convolution(engine_t *engine) {
+        // Implementations built on top of a specific convolution override
+        // this to skip the iteration over the whole convolution list.
+        virtual status_t init_convolution(engine_t *engine) {
             using namespace types;
 
             convolution_desc_t cd;
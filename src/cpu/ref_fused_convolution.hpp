@@ -18,6 +18,10 @@
 #ifndef CPU_REF_FUSED_CONVOLUTION_HPP
 #define CPU_REF_FUSED_CONVOLUTION_HPP
 
+#include <array>
+#include <cstring>
+
+#include "common/dnnl_thread.hpp"
 #include "common/primitive.hpp"
 #include "common/primitive_iterator.hpp"
 #include "common/reorder.hpp"
@@ -25,6 +29,7 @@
 
 #include "cpu/cpu_convolution_pd.hpp"
 #include "cpu/dw_convolution_utils.hpp"
+#include "cpu/platform.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -108,33 +113,82 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
         }
 
         const memory_desc_t *arg_md(int index = 0) const override {
-            switch (index) { // for now
-                case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS:
-                    return op_pds_.back()->weights_md(0);
-                case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS:
-                    return op_pds_.back()->weights_md(1);
-                default: return convolution_fwd_pd_t::arg_md(index);
+            for (const auto &dw_op : dw_ops_) {
+                const auto &dw_pd = op_pds_[dw_op.second];
+                if (index == dw_arg(dw_op.first, DNNL_ARG_WEIGHTS))
+                    return dw_pd->weights_md(0);
+                if (index == dw_arg(dw_op.first, DNNL_ARG_BIAS))
+                    return dw_pd->weights_md(1);
             }
+            return convolution_fwd_pd_t::arg_md(index);
         }
 
         arg_usage_t arg_usage(int arg) const override {
-            if (arg == (DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS))
-                return arg_usage_t::input;
-
-            if (arg == (DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS)
-                    && attr_post_op_dw_inputs() > 1)
-                return arg_usage_t::input;
+            for (const auto &dw_op : dw_ops_) {
+                const auto &dw_pd = op_pds_[dw_op.second];
+                if (arg == dw_arg(dw_op.first, DNNL_ARG_WEIGHTS))
+                    return arg_usage_t::input;
+                if (arg == dw_arg(dw_op.first, DNNL_ARG_BIAS)
+                        && dw_pd->weights_md(1)->data_type != data_type::undef)
+                    return arg_usage_t::input;
+            }
 
             return convolution_fwd_pd_t::arg_usage(arg);
         }
 
+        int n_inputs() const override {
+            // The base class accounts for the first depthwise post-op only.
+            int n_dw_inputs = 0;
+            for (size_t i = 1; i < dw_ops_.size(); ++i) {
+                const auto &dw_pd = op_pds_[dw_ops_[i].second];
+                n_dw_inputs += 1
+                        + (dw_pd->weights_md(1)->data_type != data_type::undef);
+            }
+            return convolution_fwd_pd_t::n_inputs() + n_dw_inputs;
+        }
+
+        // A step of the row-pipelined execution: the op_idx-th operation
+        // computes the block of destination rows starting at dst_row from
+        // the block of source rows starting at src_row. Rows of the
+        // intermediate tensors are relative to the beginning of their
+        // buffers. Before the step, `keep` rows starting at `shift` are moved
+        // to the beginning of the destination buffer.
+        struct row_step_t {
+            int op_idx;
+            int pd_idx; // -1 if there are no rows to compute
+            dim_t src_row, dst_row;
+            dim_t shift, keep;
+        };
+
         size_t user_scratchpad_size_;
         std::vector<std::shared_ptr<primitive_desc_t>> op_pds_;
         std::vector<arg_cache_t> args_;
+        // Depthwise post-ops and the indices of the corresponding ops.
+        std::vector<std::pair<int, size_t>> dw_ops_;
+
+        bool use_row_pipeline_ = false;
+        std::vector<row_step_t> row_steps_;
+        std::vector<std::vector<std::shared_ptr<primitive_desc_t>>> row_pds_;
+        // Offsets of the buffers keeping the destination rows of all the
+        // operations but the last one. The last value is the total size.
+        std::vector<size_t> row_buffer_offsets_;
+
+        size_t row_size(int op_idx) const {
+            const memory_desc_wrapper dst_d(op_pds_[op_idx]->dst_md());
+            return dst_d.blocking_desc().strides[2] * dst_d.data_type_size();
+        }
+
+        // The first depthwise post-op uses the dedicated argument, the next
+        // ones are identified by their post-op index.
+        int dw_arg(int po_idx, int arg) const {
+            return po_idx == attr()->post_ops_.find(primitive_kind::convolution)
+                    ? (DNNL_ARG_ATTR_POST_OP_DW | arg)
+                    : (DNNL_ARG_ATTR_MULTIPLE_POST_OP(po_idx) | arg);
+        }
 
     private:
         std::string name_;
-        const unsigned int max_fusions_ = 1;
+        const unsigned int max_fusions_ = 2;
 
         status_t append_op(std::shared_ptr<primitive_desc_t> &op_pd,
                 size_t &sp_begin, size_t &sp_end, engine_t *engine) {
@@ -222,7 +276,7 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
             // Loop through the post-ops until we reach the end
             // (if we have more than one op to fuse later)
             while (po_op_iter < end) {
-                if (fusion_ops++ > max_fusions_) return status::unimplemented;
+                if (fusion_ops++ >= max_fusions_) return status::unimplemented;
 
                 const auto &prev_op_pd = op_pds_.back();
 
@@ -234,15 +288,19 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
 
                 auto conv_pd = reinterpret_cast<convolution_pd_t *>(
                         prev_op_pd.get());
-                bool ok = true && is_fwd()
-                        && utils::everyone_is(
-                                1, conv_pd->KD(), conv_pd->KH(), conv_pd->KW());
-                if (!ok) return status::unimplemented;
+                if (!is_fwd()) return status::unimplemented;
 
                 convolution_desc_t cd_dw;
                 primitive_attr_t attr_dw;
                 CHECK(get_depthwise_conv_desc(cd_dw, *(conv_pd->dst_md()),
                         root_attr, attr_dw, po_op_iter));
+                // Next depthwise post-op is a separate operation of the chain
+                const int next_dw_idx
+                        = attr_dw.post_ops_.find(primitive_kind::convolution);
+                if (next_dw_idx != -1) {
+                    auto &dw_e = attr_dw.post_ops_.entry_;
+                    dw_e.erase(dw_e.begin() + next_dw_idx, dw_e.end());
+                }
                 dnnl_primitive_desc_iterator it(
                         engine, (op_desc_t *)&cd_dw, &attr_dw, nullptr);
                 if (!it.is_initialized()) return status::out_of_memory;
@@ -254,15 +312,24 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
                         inout_sp_offset_end, engine));
 
                 const auto &op = op_pds_.back();
+                dw_ops_.emplace_back(po_op_iter, op_pds_.size() - 1);
+                const bool is_last_op = po.find(primitive_kind::convolution,
+                                                po_op_iter + 1)
+                        == -1;
+
                 arg_cache_t arg_cache;
                 arg_cache.append_inout_arg(DNNL_ARG_SRC, inout_sp_offset_begin,
                         op->src_md(), true);
-                arg_cache.append_ctx_arg(DNNL_ARG_DST);
+                if (is_last_op)
+                    arg_cache.append_ctx_arg(DNNL_ARG_DST);
+                else
+                    arg_cache.append_inout_arg(DNNL_ARG_DST,
+                            inout_sp_offset_end, op->dst_md(), false);
                 arg_cache.append_ctx_arg(DNNL_ARG_WEIGHTS,
-                        DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS);
+                        dw_arg(po_op_iter, DNNL_ARG_WEIGHTS));
                 if (op->weights_md(1)->data_type != data_type::undef)
-                    arg_cache.append_ctx_arg(DNNL_ARG_BIAS,
-                            DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS);
+                    arg_cache.append_ctx_arg(
+                            DNNL_ARG_BIAS, dw_arg(po_op_iter, DNNL_ARG_BIAS));
                 for (int idx = 0; idx < attr_dw.post_ops_.len(); ++idx) {
                     if (attr_dw.post_ops_.contain(primitive_kind::binary, idx))
                         arg_cache.append_ctx_arg(
@@ -275,6 +342,13 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
 
                 args_.push_back(arg_cache);
 
+                if (!is_last_op) {
+                    // Increment scratchpad offsets
+                    inout_sp_offset_begin = inout_sp_offset_end;
+                    inout_sp_offset_end
+                            += memory_desc_wrapper(op->dst_md()).size();
+                }
+
                 while (++po_op_iter < end) {
                     if (utils::one_of(po.entry_[po_op_iter].kind,
                                 primitive_kind::convolution))
@@ -284,11 +358,234 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
 
             assert(!op_pds_.empty());
 
-            CHECK(init_scratchpad_memory(inout_sp_offset_end));
+            CHECK(init_row_pipeline(engine));
+
+            CHECK(init_scratchpad_memory(use_row_pipeline_
+                            ? row_buffer_offsets_.back()
+                            : inout_sp_offset_end));
 
             return status::success;
         }
 
+        static bool row_pipeline_post_ops_ok(const primitive_attr_t *attr) {
+            // Binary post-ops are applied to a block of rows, so only the
+            // second operands broadcasted over mini-batch and spatial
+            // dimensions are supported.
+            const auto &po = attr->post_ops_;
+            for (int idx = 0; idx < po.len(); ++idx) {
+                if (!po.entry_[idx].is_binary()) continue;
+                const auto &src1_md = po.entry_[idx].binary.src1_desc;
+                for (int d = 0; d < src1_md.ndims; ++d)
+                    if (d != 1 && src1_md.dims[d] != 1) return false;
+            }
+            return true;
+        }
+
+        // Creates a convolution for a block of rows of the `full_pd` problem
+        // with mini-batch 1. The implementation has to be the same as the
+        // one chosen for the full problem, otherwise the pipelining is not
+        // worth it.
+        static status_t create_row_conv_pd(
+                std::shared_ptr<primitive_desc_t> &pd,
+                const convolution_pd_t *full_pd, dim_t ih, dim_t oh,
+                dim_t pad_t, dim_t pad_b, engine_t *engine) {
+            convolution_desc_t cd = *full_pd->desc();
+
+            auto init_md = [](memory_desc_t &md, const memory_desc_t &full_md,
+                                   dim_t h) {
+                dims_t dims;
+                utils::array_copy(dims, full_md.dims, full_md.ndims);
+                dims[0] = 1;
+                dims[2] = h;
+                return dnnl_memory_desc_init_by_tag(&md, full_md.ndims, dims,
+                        full_md.data_type, format_tag::nhwc);
+            };
+            CHECK(init_md(cd.src_desc, *full_pd->src_md(), ih));
+            CHECK(init_md(cd.dst_desc, *full_pd->dst_md(), oh));
+            cd.weights_desc = *full_pd->weights_md(0);
+            cd.bias_desc = *full_pd->weights_md(1);
+            cd.padding[0][0] = pad_t;
+            cd.padding[1][0] = pad_b;
+
+            dnnl_primitive_desc_iterator it(
+                    engine, (op_desc_t *)&cd, full_pd->attr(), nullptr);
+            if (!it.is_initialized()) return status::out_of_memory;
+            pd = *(++it);
+            if (!pd) return status::unimplemented;
+            if (strcmp(pd->name(), full_pd->name()) != 0)
+                return status::unimplemented;
+            return status::success;
+        }
+
+        const convolution_pd_t *op_conv_pd(int op_idx) const {
+            return static_cast<const convolution_pd_t *>(
+                    op_pds_[op_idx].get());
+        }
+
+        static int find_or_append(std::vector<std::array<dim_t, 4>> &keys,
+                const std::array<dim_t, 4> &key) {
+            for (size_t i = 0; i < keys.size(); ++i)
+                if (keys[i] == key) return (int)i;
+            keys.push_back(key);
+            return (int)keys.size() - 1;
+        }
+
+        // Splits the execution into blocks of oh_blk destination rows. For
+        // every operation, starting from the last one, the source rows
+        // required by the block are computed, and the rows already kept in
+        // the buffer of the previous operation are excluded from the block
+        // of this previous operation. Returns the number of rows every
+        // buffer has to keep. The unique shapes of the blocks are returned
+        // in `keys` as {ih, oh, top padding, bottom padding}.
+        std::vector<dim_t> init_row_steps(dim_t oh_blk,
+                std::vector<row_step_t> &steps,
+                std::vector<std::vector<std::array<dim_t, 4>>> &keys) const {
+            const int n_ops = (int)op_pds_.size();
+            std::vector<dim_t> buf_rows(n_ops, 0);
+            std::vector<dim_t> buf_s(n_ops, 0), buf_e(n_ops, 0);
+            steps.clear();
+            keys.assign(n_ops, {});
+
+            const dim_t OH = op_conv_pd(n_ops - 1)->OH();
+            for (dim_t oh_s = 0; oh_s < OH; oh_s += oh_blk) {
+                std::vector<row_step_t> block(n_ops);
+                for (int k = 0; k < n_ops; ++k)
+                    block[k] = {k, -1, 0, 0, 0, 0};
+
+                dim_t out_s = oh_s, out_e = nstl::min(OH, oh_s + oh_blk);
+                for (int k = n_ops - 1; k >= 0 && out_s < out_e; --k) {
+                    const auto conv_pd = op_conv_pd(k);
+                    const dim_t SH = conv_pd->KSH();
+                    const dim_t ext_KH
+                            = (conv_pd->KH() - 1) * (conv_pd->KDH() + 1) + 1;
+                    const dim_t src_s = out_s * SH - conv_pd->padT();
+                    const dim_t src_e = (out_e - 1) * SH - conv_pd->padT()
+                            + ext_KH;
+                    const dim_t in_s = nstl::max<dim_t>(0, src_s);
+                    const dim_t in_e = nstl::min(conv_pd->IH(), src_e);
+
+                    auto &step = block[k];
+                    step.pd_idx = find_or_append(keys[k],
+                            {in_e - in_s, out_e - out_s, in_s - src_s,
+                                    src_e - in_e});
+                    step.dst_row = k == n_ops - 1 ? out_s : out_s - buf_s[k];
+                    step.src_row = in_s;
+                    if (k == 0) break;
+
+                    const dim_t keep = nstl::max<dim_t>(
+                            0, nstl::min(buf_e[k - 1], in_e) - in_s);
+                    block[k - 1].shift = in_s - buf_s[k - 1];
+                    block[k - 1].keep = keep;
+                    buf_s[k - 1] = in_s;
+                    buf_e[k - 1] = in_e;
+                    buf_rows[k - 1] = nstl::max(buf_rows[k - 1], in_e - in_s);
+                    step.src_row = 0;
+                    out_s = in_s + keep;
+                    out_e = in_e;
+                }
+
+                for (const auto &step : block)
+                    if (step.pd_idx >= 0 || (step.keep > 0 && step.shift > 0))
+                        steps.push_back(step);
+            }
+            return buf_rows;
+        }
+
+        size_t row_buffers_size(const std::vector<dim_t> &buf_rows) const {
+            size_t size = 0;
+            for (size_t k = 0; k + 1 < op_pds_.size(); ++k)
+                size += utils::rnd_up(buf_rows[k] * row_size((int)k), 64);
+            return size;
+        }
+
+        // The row-pipelined execution computes the fused convolutions by
+        // blocks of destination rows. For every block only the rows of the
+        // intermediate tensors it requires are computed into buffers sized
+        // to stay in cache. Rows shared by consecutive blocks are moved to
+        // the beginning of the buffers instead of being recomputed. Blocks of
+        // rows are dense only for channels-last formats and a single image,
+        // hence the restrictions below.
+        status_t init_row_pipeline(engine_t *engine) {
+            use_row_pipeline_ = false;
+            row_steps_.clear();
+            row_pds_.clear();
+            row_buffer_offsets_.assign(1, 0);
+
+            const int n_ops = (int)op_pds_.size();
+            if (n_ops < 2) return status::success;
+
+            size_t inter_size = 0;
+            for (int k = 0; k < n_ops; ++k) {
+                const auto &op_pd = op_pds_[k];
+                if (op_pd->kind() != primitive_kind::convolution)
+                    return status::success;
+                const memory_desc_wrapper src_d(op_pd->src_md());
+                const memory_desc_wrapper dst_d(op_pd->dst_md());
+                const bool ok = src_d.ndims() == 4
+                        && src_d.matches_tag(format_tag::nhwc)
+                        && dst_d.matches_tag(format_tag::nhwc)
+                        && row_pipeline_post_ops_ok(op_pd->attr());
+                if (!ok) return status::success;
+                if (k < n_ops - 1) inter_size += dst_d.size();
+            }
+
+            // Nothing to gain if the intermediate tensors fit in cache.
+            const int nthr = dnnl_get_max_threads();
+            const size_t llc_size
+                    = platform::get_per_core_cache_size(3) * nthr;
+            if (inter_size <= llc_size) return status::success;
+
+            // Keep the buffers in the L2 caches of all the cores. The size of
+            // the buffers grows with the block size, so look for the largest
+            // block which fits.
+            const size_t buffer_size
+                    = platform::get_per_core_cache_size(2) * nthr / 2;
+            const dim_t OH = op_conv_pd(n_ops - 1)->OH();
+            std::vector<row_step_t> steps;
+            std::vector<std::vector<std::array<dim_t, 4>>> keys;
+            dim_t oh_blk_min = 1, oh_blk_max = OH - 1;
+            while (oh_blk_min < oh_blk_max) {
+                const dim_t oh_blk = (oh_blk_min + oh_blk_max + 1) / 2;
+                if (row_buffers_size(init_row_steps(oh_blk, steps, keys))
+                        <= buffer_size)
+                    oh_blk_min = oh_blk;
+                else
+                    oh_blk_max = oh_blk - 1;
+            }
+            if (oh_blk_min >= OH) return status::success;
+            const auto buf_rows = init_row_steps(oh_blk_min, steps, keys);
+
+            std::vector<std::vector<std::shared_ptr<primitive_desc_t>>> pds(
+                    n_ops);
+            for (int k = 0; k < n_ops; ++k) {
+                const auto conv_pd = op_conv_pd(k);
+                for (const auto &key : keys[k]) {
+                    std::shared_ptr<primitive_desc_t> pd;
+                    if (create_row_conv_pd(pd, conv_pd, key[0], key[1], key[2],
+                                key[3], engine)
+                            != status::success)
+                        return status::success;
+                    user_scratchpad_size_ = nstl::max<size_t>(
+                            user_scratchpad_size_,
+                            pd->scratchpad_size(attr()->scratchpad_mode_));
+                    pds[k].push_back(pd);
+                }
+            }
+
+            row_buffer_offsets_.clear();
+            size_t offset = 0;
+            for (int k = 0; k < n_ops - 1; ++k) {
+                row_buffer_offsets_.push_back(offset);
+                offset += utils::rnd_up(buf_rows[k] * row_size(k), 64);
+            }
+            row_buffer_offsets_.push_back(offset);
+
+            row_steps_ = std::move(steps);
+            row_pds_ = std::move(pds);
+            use_row_pipeline_ = true;
+            return status::success;
+        }
+
         status_t init_scratchpad_memory(size_t inout_buffer_size) {
 
             auto scratchpad = scratchpad_registry().registrar();
@@ -319,6 +616,14 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
             op_pd->create_primitive(p, engine);
             primitives_.emplace_back(p);
         }
+        for (const auto &op_row_pds : pd()->row_pds_) {
+            row_primitives_.emplace_back();
+            for (auto &op_pd : op_row_pds) {
+                std::shared_ptr<primitive_t> p;
+                CHECK(op_pd->create_primitive(p, engine));
+                row_primitives_.back().emplace_back(p);
+            }
+        }
         return status::success;
     }
 
@@ -333,6 +638,8 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
 #endif
 
     status_t execute(const exec_ctx_t &ctx) const override {
+        if (pd()->use_row_pipeline_) return execute_row_pipelined(ctx);
+
         engine_t *engine = ctx.stream()->engine();
         const auto scratchpad = ctx.get_scratchpad_grantor();
 
@@ -374,7 +681,100 @@ struct ref_fused_convolution_fwd_t : public primitive_t {
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // Executes `op` with the arguments cached for the op_idx-th operation
+    // with source and destination replaced by the given blocks of rows.
+    status_t execute_op(const exec_ctx_t &ctx, size_t op_idx,
+            const std::shared_ptr<primitive_t> &op, memory_t *src,
+            memory_t *dst) const {
+        const auto &ctx_args = ctx.args();
+        exec_args_t exec_args;
+        for (const auto &arg_info : pd()->args_[op_idx].info()) {
+            if (arg_info.op_arg == DNNL_ARG_SRC)
+                exec_args[DNNL_ARG_SRC] = {src, true};
+            else if (arg_info.op_arg == DNNL_ARG_DST)
+                exec_args[DNNL_ARG_DST] = {dst, false};
+            else if (arg_info.is_ctx_arg)
+                exec_args[arg_info.op_arg] = ctx_args.at(arg_info.ctx_arg);
+        }
+
+        exec_ctx_t op_ctx(ctx, std::move(exec_args));
+        nested_scratchpad_t ns(
+                ctx, memory_tracking::names::key_fusion_forward_scratchpad, op);
+        op_ctx.set_scratchpad_grantor(ns.grantor());
+        return op->execute(op_ctx);
+    }
+
+    status_t execute_row_pipelined(const exec_ctx_t &ctx) const {
+        engine_t *engine = ctx.stream()->engine();
+        const auto scratchpad = ctx.get_scratchpad_grantor();
+
+        const auto buffer_storage = scratchpad.get_memory_storage(
+                memory_tracking::names::key_fusion_inout_buffer);
+        char *buffer = scratchpad.get<char>(
+                memory_tracking::names::key_fusion_inout_buffer);
+
+        const auto &op_pds = pd()->op_pds_;
+        const int n_ops = (int)op_pds.size();
+        const memory_desc_wrapper src_d(op_pds.front()->src_md());
+        const memory_desc_wrapper dst_d(op_pds.back()->dst_md());
+        const auto &buf_offsets = pd()->row_buffer_offsets_;
+
+        const memory_storage_t *src_storage
+                = ctx.input(DNNL_ARG_SRC)->memory_storage();
+        const memory_storage_t *dst_storage
+                = ctx.output(DNNL_ARG_DST)->memory_storage();
+
+        auto make_memory = [&](const memory_storage_t *storage,
+                                   const memory_desc_t *md, size_t offset) {
+            return utils::make_unique<memory_t>(engine, md,
+                    storage->get_sub_storage(
+                            offset, memory_desc_wrapper(md).size()));
+        };
+
+        for (dim_t n = 0; n < src_d.dims()[0]; ++n) {
+            for (const auto &step : pd()->row_steps_) {
+                const int k = step.op_idx;
+                const bool is_first = k == 0;
+                const bool is_last = k == n_ops - 1;
+
+                // Move the rows shared with the previous block to the
+                // beginning of the buffer.
+                if (!is_last && step.keep > 0 && step.shift > 0) {
+                    const size_t row_size = pd()->row_size(k);
+                    char *buf = buffer + buf_offsets[k];
+                    std::memmove(buf, buf + step.shift * row_size,
+                            step.keep * row_size);
+                }
+                if (step.pd_idx < 0) continue;
+
+                const auto &op_pd = pd()->row_pds_[k][step.pd_idx];
+                const size_t src_off = is_first
+                        ? src_d.blk_off(n, 0, step.src_row, 0)
+                                * src_d.data_type_size()
+                        : buf_offsets[k - 1]
+                                + step.src_row * pd()->row_size(k - 1);
+                const size_t dst_off = is_last
+                        ? dst_d.blk_off(n, 0, step.dst_row, 0)
+                                * dst_d.data_type_size()
+                        : buf_offsets[k] + step.dst_row * pd()->row_size(k);
+
+                auto src = make_memory(
+                        is_first ? src_storage : buffer_storage.get(),
+                        op_pd->src_md(), src_off);
+                auto dst = make_memory(
+                        is_last ? dst_storage : buffer_storage.get(),
+                        op_pd->dst_md(), dst_off);
+                CHECK(execute_op(ctx, k, row_primitives_[k][step.pd_idx],
+                        src.get(), dst.get()));
+            }
+        }
+
+        return status::success;
+    }
+
     std::vector<std::shared_ptr<primitive_t>> primitives_;
+    std::vector<std::vector<std::shared_ptr<primitive_t>>> row_primitives_;
 };
 
 } // namespace cpu
@@ -0,0 +1,277 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include <math.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "cpu/ref_group_normalization.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+template <typename T>
+inline float maybe_up_convert(T x) {
+    return x;
+}
+
+template <>
+inline float maybe_up_convert<bfloat16_t>(bfloat16_t x) {
+    return (float)x;
+}
+
+} // namespace
+
+using namespace data_type;
+
+template <impl::data_type_t d_type>
+status_t ref_group_normalization_fwd_t<d_type>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper stat_d(pd()->stat_md());
+    const memory_desc_wrapper ss_d(pd()->weights_md());
+
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto scale = pd()->use_scale() ? CTX_IN_MEM(const float *, DNNL_ARG_SCALE)
+                                   : nullptr;
+    auto shift = pd()->use_shift() ? CTX_IN_MEM(const float *, DNNL_ARG_SHIFT)
+                                   : nullptr;
+
+    auto mean = pd()->stats_are_src()
+            ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_MEAN))
+            : CTX_OUT_MEM(float *, DNNL_ARG_MEAN);
+    auto variance = pd()->stats_are_src()
+            ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE))
+            : CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE);
+
+    auto dst = CTX_OUT_CLEAN_MEM(data_t *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const dim_t N = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t G = pd()->G();
+    const dim_t SP = pd()->D() * pd()->H() * pd()->W();
+    const dim_t C_per_G = C / G;
+    const dim_t group_size = C_per_G * SP;
+
+    const float eps = pd()->desc()->group_norm_epsilon;
+    const bool save_stats = pd()->is_training();
+    const bool calculate_stats = !pd()->stats_are_src();
+
+    /* fast return */
+    if (this->pd()->has_zero_dim_memory()) {
+        if (calculate_stats && save_stats) {
+            for (dim_t n = 0; n < N; n++)
+                for (dim_t g = 0; g < G; g++) {
+                    mean[stat_d.off(n, g)] = 0;
+                    variance[stat_d.off(n, g)] = 0;
+                }
+        }
+        return status::success;
+    }
+
+    parallel_nd(N, G, [&](dim_t n, dim_t g) {
+        const size_t s_off = stat_d.off(n, g);
+        const dim_t c_start = g * C_per_G, c_end = c_start + C_per_G;
+        float v_mean = calculate_stats ? 0 : mean[s_off];
+        float v_variance = calculate_stats ? 0 : variance[s_off];
+
+        if (calculate_stats) {
+            for (dim_t c = c_start; c < c_end; ++c)
+                for (dim_t sp = 0; sp < SP; ++sp)
+                    v_mean += maybe_up_convert(
+                            src[src_d.off_l((n * C + c) * SP + sp)]);
+            v_mean /= group_size;
+
+            for (dim_t c = c_start; c < c_end; ++c)
+                for (dim_t sp = 0; sp < SP; ++sp) {
+                    float m = maybe_up_convert(
+                                      src[src_d.off_l((n * C + c) * SP + sp)])
+                            - v_mean;
+                    v_variance += m * m;
+                }
+            v_variance /= group_size;
+        }
+
+        float sqrt_variance = sqrtf(v_variance + eps);
+        for (dim_t c = c_start; c < c_end; ++c) {
+            const float sm
+                    = (scale ? scale[ss_d.off(c)] : 1.0f) / sqrt_variance;
+            const float sv = shift ? shift[ss_d.off(c)] : 0;
+            for (dim_t sp = 0; sp < SP; ++sp) {
+                const dim_t l_off = (n * C + c) * SP + sp;
+                float d = sm * (maybe_up_convert(src[src_d.off_l(l_off)])
+                                       - v_mean)
+                        + sv;
+
+                ref_post_ops_t::args_t args;
+                args.ctx = &ctx;
+                args.l_offset = l_off;
+                args.dst_md = pd()->dst_md();
+                ref_post_ops->execute(d, args);
+
+                dst[dst_d.off_l(l_off)] = d;
+            }
+        }
+
+        if (calculate_stats && save_stats) {
+            mean[s_off] = v_mean;
+            variance[s_off] = v_variance;
+        }
+    });
+    return status::success;
+}
+
+template struct ref_group_normalization_fwd_t<f32>;
+template struct ref_group_normalization_fwd_t<bf16>;
+
+template <impl::data_type_t d_type>
+status_t ref_group_normalization_bwd_t<d_type>::execute_backward(
+        const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper stat_d(pd()->stat_md());
+    const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+    const memory_desc_wrapper ss_d(pd()->weights_md());
+    const memory_desc_wrapper diff_ss_d(pd()->diff_weights_md());
+
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto mean = CTX_IN_MEM(const float *, DNNL_ARG_MEAN);
+    auto variance = CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE);
+    auto diff_dst = CTX_IN_MEM(const data_t *, DNNL_ARG_DIFF_DST);
+    auto scale = pd()->use_scale() ? CTX_IN_MEM(const float *, DNNL_ARG_SCALE)
+                                   : nullptr;
+    auto diff_src = CTX_OUT_CLEAN_MEM(data_t *, DNNL_ARG_DIFF_SRC, status);
+    CHECK(status);
+
+    const bool with_diff_ss = pd()->desc()->prop_kind == prop_kind::backward;
+    auto diff_scale = with_diff_ss && pd()->use_scale()
+            ? CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DIFF_SCALE, status)
+            : nullptr;
+    CHECK(status);
+    auto diff_shift = with_diff_ss && pd()->use_shift()
+            ? CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DIFF_SHIFT, status)
+            : nullptr;
+    CHECK(status);
+
+    const dim_t N = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t G = pd()->G();
+    const dim_t SP = pd()->D() * pd()->H() * pd()->W();
+    const dim_t C_per_G = C / G;
+    const dim_t group_size = C_per_G * SP;
+
+    /* fast return */
+    if (this->pd()->has_zero_dim_memory()) {
+        for (dim_t c = 0; c < C; ++c) {
+            if (diff_scale) diff_scale[diff_ss_d.off(c)] = 0;
+            if (diff_shift) diff_shift[diff_ss_d.off(c)] = 0;
+        }
+        return status::success;
+    }
+
+    const float eps = pd()->desc()->group_norm_epsilon;
+    const bool calculate_diff_stats = !pd()->use_global_stats();
+
+    if (diff_scale || diff_shift) {
+        parallel_nd(C, [&](dim_t c) {
+            const dim_t g = c / C_per_G;
+            float diff_gamma = 0;
+            float diff_beta = 0;
+
+            for (dim_t n = 0; n < N; ++n) {
+                const size_t s_off = stat_d.off(n, g);
+                const float inv_sqrt_variance
+                        = 1.0f / sqrtf(variance[s_off] + eps);
+                for (dim_t sp = 0; sp < SP; ++sp) {
+                    const dim_t l_off = (n * C + c) * SP + sp;
+                    const float dd = maybe_up_convert(
+                            diff_dst[diff_dst_d.off_l(l_off)]);
+                    diff_gamma += (maybe_up_convert(src[src_d.off_l(l_off)])
+                                          - mean[s_off])
+                            * dd * inv_sqrt_variance;
+                    diff_beta += dd;
+                }
+            }
+
+            if (diff_scale) diff_scale[diff_ss_d.off(c)] = diff_gamma;
+            if (diff_shift) diff_shift[diff_ss_d.off(c)] = diff_beta;
+        });
+    }
+
+    parallel_nd(N, G, [&](dim_t n, dim_t g) {
+        const size_t s_off = stat_d.off(n, g);
+        const dim_t c_start = g * C_per_G, c_end = c_start + C_per_G;
+        const float inv_sqrt_variance = 1.0f / sqrtf(variance[s_off] + eps);
+        const float v_mean = mean[s_off];
+
+        float dd_gamma = 0, dd_gamma_x = 0;
+        if (calculate_diff_stats) {
+            for (dim_t c = c_start; c < c_end; ++c) {
+                const float gamma = scale ? scale[ss_d.off(c)] : 1;
+                for (dim_t sp = 0; sp < SP; ++sp) {
+                    const dim_t l_off = (n * C + c) * SP + sp;
+                    const float dd = maybe_up_convert(
+                            diff_dst[diff_dst_d.off_l(l_off)]);
+                    dd_gamma += dd * gamma;
+                    dd_gamma_x += dd * gamma
+                            * (maybe_up_convert(src[src_d.off_l(l_off)])
+                                    - v_mean);
+                }
+            }
+            dd_gamma_x *= inv_sqrt_variance;
+        }
+
+        for (dim_t c = c_start; c < c_end; ++c) {
+            const float gamma = scale ? scale[ss_d.off(c)] : 1;
+            for (dim_t sp = 0; sp < SP; ++sp) {
+                const dim_t l_off = (n * C + c) * SP + sp;
+                float v_diff_src = maybe_up_convert(
+                                           diff_dst[diff_dst_d.off_l(l_off)])
+                        * gamma;
+                if (calculate_diff_stats) {
+                    v_diff_src -= dd_gamma / group_size
+                            + (maybe_up_convert(src[src_d.off_l(l_off)])
+                                      - v_mean)
+                                    * dd_gamma_x * inv_sqrt_variance
+                                    / group_size;
+                }
+                v_diff_src *= inv_sqrt_variance;
+                diff_src[diff_src_d.off_l(l_off)] = v_diff_src;
+            }
+        }
+    });
+    return status::success;
+}
+
+template struct ref_group_normalization_bwd_t<f32>;
+template struct ref_group_normalization_bwd_t<bf16>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -0,0 +1,129 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_GROUP_NORMALIZATION_HPP
+#define CPU_REF_GROUP_NORMALIZATION_HPP
+
+#include <assert.h>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+#include "cpu/primitive_attr_postops.hpp"
+
+#include "cpu/cpu_group_normalization_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+template <data_type_t d_type>
+struct ref_group_normalization_fwd_t : public primitive_t {
+    struct pd_t : public cpu_group_normalization_fwd_pd_t {
+        pd_t(const group_normalization_desc_t *adesc,
+                const primitive_attr_t *attr,
+                const group_normalization_fwd_pd_t *hint_fwd_pd)
+            : cpu_group_normalization_fwd_pd_t(adesc, attr, hint_fwd_pd) {}
+
+        DECLARE_COMMON_PD_T("ref:any", ref_group_normalization_fwd_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using skip_mask_t = primitive_attr_t::skip_mask_t;
+            bool ok = is_fwd() && platform::has_data_type_support(d_type)
+                    && utils::everyone_is(
+                            d_type, src_md()->data_type, dst_md()->data_type)
+                    && stat_md()->data_type == f32
+                    && check_scale_shift_data_type()
+                    && attr()->has_default_values(skip_mask_t::post_ops)
+                    && post_ops_ok() && set_default_formats_common()
+                    && attr_.set_default_formats(dst_md(0)) == status::success;
+            if (!ok) return status::unimplemented;
+
+            return status::success;
+        }
+    };
+
+    ref_group_normalization_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    typedef typename prec_traits<d_type>::type data_t;
+
+    status_t init(engine_t *engine) override {
+        ref_post_ops
+                = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
+        if (!ref_post_ops) return status::out_of_memory;
+        return status::success;
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<ref_post_ops_t> ref_post_ops;
+};
+
+template <data_type_t d_type>
+struct ref_group_normalization_bwd_t : public primitive_t {
+    struct pd_t : public cpu_group_normalization_bwd_pd_t {
+        pd_t(const group_normalization_desc_t *adesc,
+                const primitive_attr_t *attr,
+                const group_normalization_fwd_pd_t *hint_fwd_pd)
+            : cpu_group_normalization_bwd_pd_t(adesc, attr, hint_fwd_pd) {}
+
+        DECLARE_COMMON_PD_T("ref:any", ref_group_normalization_bwd_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            bool ok = is_bwd() && platform::has_data_type_support(d_type)
+                    && set_default_formats_common()
+                    && utils::everyone_is(d_type, src_md()->data_type,
+                            diff_src_md()->data_type, diff_dst_md()->data_type)
+                    && stat_md()->data_type == f32
+                    && check_scale_shift_data_type()
+                    && attr()->has_default_values();
+            if (!ok) return status::unimplemented;
+
+            return status::success;
+        }
+    };
+
+    ref_group_normalization_bwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    typedef typename prec_traits<d_type>::type data_t;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_backward(ctx);
+    }
+
+private:
+    status_t execute_backward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
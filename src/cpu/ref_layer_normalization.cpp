@@ -20,6 +20,7 @@
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/type_helpers.hpp"
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/ref_layer_normalization.hpp"
 
 namespace dnnl {
@@ -70,7 +71,8 @@ status_t ref_layer_normalization_fwd_t<d_type>::execute_forward(
             ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE))
             : CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE);
 
-    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    const auto dst_dt = dst_d.data_type();
 
     const dim_t N = pd()->across_axis();
     const dim_t C = pd()->norm_axis();
@@ -78,6 +80,8 @@ status_t ref_layer_normalization_fwd_t<d_type>::execute_forward(
     const float eps = pd()->desc()->layer_norm_epsilon;
     const bool save_stats = pd()->is_training();
     const bool calculate_stats = !pd()->stats_are_src();
+    const bool skip_mean = pd()->skip_mean();
+    const float oscale = pd()->attr()->output_scales_.scales_[0];
 
     const auto ss_off = [&use_scale, &use_shift, &use_ss](
                                 const memory_desc_wrapper &md, dim_t c) {
@@ -100,13 +104,15 @@ status_t ref_layer_normalization_fwd_t<d_type>::execute_forward(
 
     parallel_nd(N, [&](dim_t n) {
         const size_t s_off = stat_d.off_l(n);
-        auto v_mean = calculate_stats ? 0 : mean[s_off];
-        auto v_variance = calculate_stats ? 0 : variance[s_off];
+        float v_mean = calculate_stats || skip_mean ? 0 : mean[s_off];
+        float v_variance = calculate_stats ? 0 : variance[s_off];
 
         if (calculate_stats) {
-            for (dim_t c = 0; c < C; ++c)
-                v_mean += maybe_up_convert(src[src_d.off_l(n * C + c)]);
-            v_mean /= C;
+            if (!skip_mean) {
+                for (dim_t c = 0; c < C; ++c)
+                    v_mean += maybe_up_convert(src[src_d.off_l(n * C + c)]);
+                v_mean /= C;
+            }
 
             for (dim_t c = 0; c < C; ++c) {
                 float m = src[src_d.off_l(n * C + c)] - v_mean;
@@ -123,7 +129,16 @@ status_t ref_layer_normalization_fwd_t<d_type>::execute_forward(
             const size_t dst_off = dst_d.off_l(n * C + c),
                          src_off = src_d.off_l(n * C + c);
 
-            dst[dst_off] = sm * (maybe_up_convert(src[src_off]) - v_mean) + sv;
+            float d = sm * (maybe_up_convert(src[src_off]) - v_mean) + sv;
+            d *= oscale;
+
+            ref_post_ops_t::args_t args;
+            args.ctx = &ctx;
+            args.l_offset = n * C + c;
+            args.dst_md = pd()->dst_md();
+            ref_post_ops->execute(d, args);
+
+            io::store_float_value(dst_dt, d, dst, dst_off);
         }
 
         if (calculate_stats) {
@@ -206,6 +221,7 @@ status_t ref_layer_normalization_bwd_t<d_type>::execute_backward(
 
     const float eps = pd()->desc()->layer_norm_epsilon;
     const bool calculate_diff_stats = !pd()->use_global_stats();
+    const bool skip_mean = pd()->skip_mean();
 
     if (diff_scale || diff_shift) {
         parallel_nd(C, [&](dim_t c) {
@@ -218,9 +234,10 @@ status_t ref_layer_normalization_bwd_t<d_type>::execute_backward(
                              s_off = stat_d.off_l(n);
                 float inv_sqrt_variance = static_cast<float>(
                         1.0f / sqrtf(variance[s_off] + eps));
+                const float v_mean = skip_mean ? 0 : mean[s_off];
                 data_t dd = maybe_up_convert(diff_dst[diff_dst_off]);
-                diff_gamma += (maybe_up_convert(src[src_off]) - mean[s_off])
-                        * dd * inv_sqrt_variance;
+                diff_gamma += (maybe_up_convert(src[src_off]) - v_mean) * dd
+                        * inv_sqrt_variance;
                 diff_beta += dd;
             }
 
@@ -233,6 +250,7 @@ status_t ref_layer_normalization_bwd_t<d_type>::execute_backward(
         const size_t s_off = stat_d.off_l(n);
         float inv_sqrt_variance
                 = static_cast<float>(1.0f / sqrtf(variance[s_off] + eps));
+        const float v_mean = skip_mean ? 0 : mean[s_off];
         float dd_gamma = float(0), dd_gamma_x = float(0);
         if (calculate_diff_stats) {
             for (dim_t c = 0; c < C; ++c) {
@@ -242,7 +260,7 @@ status_t ref_layer_normalization_bwd_t<d_type>::execute_backward(
                 data_t dd = maybe_up_convert(diff_dst[diff_dst_off]);
                 dd_gamma += dd * gamma;
                 dd_gamma_x += dd * gamma
-                        * (maybe_up_convert(src[src_off]) - mean[s_off]);
+                        * (maybe_up_convert(src[src_off]) - v_mean);
             }
             dd_gamma_x *= inv_sqrt_variance;
         }
@@ -253,10 +271,12 @@ status_t ref_layer_normalization_bwd_t<d_type>::execute_backward(
                          diff_src_off = diff_src_d.off_l(n * C + c),
                          diff_dst_off = diff_dst_d.off_l(n * C + c);
             float v_diff_src = maybe_up_convert(diff_dst[diff_dst_off]) * gamma;
-            if (calculate_diff_stats)
-                v_diff_src -= dd_gamma / C
-                        + (maybe_up_convert(src[src_off]) - mean[s_off])
-                                * dd_gamma_x * inv_sqrt_variance / C;
+            if (calculate_diff_stats) {
+                // RMS normalization has no mean term in the derivative
+                if (!skip_mean) v_diff_src -= dd_gamma / C;
+                v_diff_src -= (maybe_up_convert(src[src_off]) - v_mean)
+                        * dd_gamma_x * inv_sqrt_variance / C;
+            }
             v_diff_src *= inv_sqrt_variance;
             diff_src[diff_src_off] = v_diff_src;
         }
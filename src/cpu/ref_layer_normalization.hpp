@@ -25,6 +25,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/platform.hpp"
+#include "cpu/primitive_attr_postops.hpp"
 
 #include "cpu/cpu_layer_normalization_pd.hpp"
 
@@ -35,7 +36,7 @@ namespace cpu {
 template <data_type_t d_type>
 struct ref_layer_normalization_fwd_t : public primitive_t {
     struct pd_t : public cpu_layer_normalization_fwd_pd_t {
-        pd_t(const layer_normalization_desc_t *adesc,
+        pd_t(const layer_normalization_v2_desc_t *adesc,
                 const primitive_attr_t *attr,
                 const layer_normalization_fwd_pd_t *hint_fwd_pd)
             : cpu_layer_normalization_fwd_pd_t(adesc, attr, hint_fwd_pd) {}
@@ -44,12 +45,17 @@ struct ref_layer_normalization_fwd_t : public primitive_t {
 
         status_t init(engine_t *engine) {
             using namespace data_type;
+            using skip_mask_t = primitive_attr_t::skip_mask_t;
             bool ok = is_fwd() && platform::has_data_type_support(d_type)
                     && src_md()->data_type == d_type
+                    && utils::one_of(dst_md()->data_type, d_type, s8, u8)
                     && stat_md()->data_type == f32
                     && check_scale_shift_data_type()
-                    && attr()->has_default_values()
-                    && set_default_formats_common();
+                    && attr()->has_default_values(
+                            skip_mask_t::oscale | skip_mask_t::post_ops)
+                    && attr_oscale_ok() && post_ops_ok()
+                    && set_default_formats_common()
+                    && attr_.set_default_formats(dst_md(0)) == status::success;
             if (!ok) return status::unimplemented;
 
             return status::success;
@@ -60,6 +66,13 @@ struct ref_layer_normalization_fwd_t : public primitive_t {
 
     typedef typename prec_traits<d_type>::type data_t;
 
+    status_t init(engine_t *engine) override {
+        ref_post_ops
+                = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
+        if (!ref_post_ops) return status::out_of_memory;
+        return status::success;
+    }
+
     status_t execute(const exec_ctx_t &ctx) const override {
         return execute_forward(ctx);
     }
@@ -67,12 +80,14 @@ struct ref_layer_normalization_fwd_t : public primitive_t {
 private:
     status_t execute_forward(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<ref_post_ops_t> ref_post_ops;
 };
 
 template <data_type_t d_type>
 struct ref_layer_normalization_bwd_t : public primitive_t {
     struct pd_t : public cpu_layer_normalization_bwd_pd_t {
-        pd_t(const layer_normalization_desc_t *adesc,
+        pd_t(const layer_normalization_v2_desc_t *adesc,
                 const primitive_attr_t *attr,
                 const layer_normalization_fwd_pd_t *hint_fwd_pd)
             : cpu_layer_normalization_bwd_pd_t(adesc, attr, hint_fwd_pd) {}
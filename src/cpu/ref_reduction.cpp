@@ -48,10 +48,33 @@ void ref_reduction_t<src_type, dst_type, acc_type>::init_acc(
         case reduction_norm_lp_sum:
         case reduction_norm_lp_power_p_max:
         case reduction_norm_lp_power_p_sum: acc = acc_t(0); break;
+        // Elements which are NaN or -inf (+inf for argmin) are never selected
+        // unless all of them are, then the result is 0.
+        case reduction_argmax:
+            acc = numeric_limits<acc_t>::has_infinity
+                    ? -numeric_limits<acc_t>::infinity()
+                    : numeric_limits<acc_t>::lowest();
+            break;
+        case reduction_argmin:
+            acc = numeric_limits<acc_t>::has_infinity
+                    ? numeric_limits<acc_t>::infinity()
+                    : numeric_limits<acc_t>::max();
+            break;
         default: assert(!"unknown alg");
     }
 }
 
+template <data_type_t src_type, data_type_t dst_type, data_type_t acc_type>
+bool ref_reduction_t<src_type, dst_type, acc_type>::update_arg(
+        acc_t &acc, const src_t &src, alg_kind_t alg) const {
+    const acc_t src_ = static_cast<acc_t>(src);
+    // Strict comparison keeps the first of equal elements.
+    const bool update = alg == alg_kind::reduction_argmax ? src_ > acc
+                                                          : src_ < acc;
+    if (update) acc = src_;
+    return update;
+}
+
 template <data_type_t src_type, data_type_t dst_type, data_type_t acc_type>
 void ref_reduction_t<src_type, dst_type, acc_type>::accumulate(
         acc_t &acc, const src_t &src, alg_kind_t alg, float p) const {
@@ -136,6 +159,20 @@ status_t ref_reduction_t<src_type, dst_type, acc_type>::execute_ref(
         const dim_t src_idle_off = src_mdw.off_v(idle_pos);
         acc_t acc {0};
         init_acc(acc, alg);
+
+        // The index is the offset of the element in the logical
+        // row-major order of the reduced dimensions.
+        if (pd()->is_arg_alg()) {
+            dim_t idx = 0;
+            for (dim_t r = 0; r < reduce_size; ++r) {
+                utils::l_dims_by_l_offset(reduce_pos, r, reduce_dims, ndims);
+                const dim_t src_off = src_idle_off + src_mdw.off_v(reduce_pos);
+                if (update_arg(acc, src[src_off], alg)) idx = r;
+            }
+            dst[dst_off] = static_cast<dst_t>(idx);
+            return;
+        }
+
         for (dim_t r = 0; r < reduce_size; ++r) {
             utils::l_dims_by_l_offset(reduce_pos, r, reduce_dims, ndims);
             const dim_t src_reduce_off = src_mdw.off_v(reduce_pos);
@@ -160,8 +197,10 @@ status_t ref_reduction_t<src_type, dst_type, acc_type>::execute_ref(
 
 using namespace data_type;
 template struct ref_reduction_t<f32, f32, f32>;
+template struct ref_reduction_t<f32, s32, f32>;
 template struct ref_reduction_t<bf16, bf16, f32>;
 template struct ref_reduction_t<bf16, f32, f32>;
+template struct ref_reduction_t<bf16, s32, f32>;
 template struct ref_reduction_t<s8, s8, s32>;
 template struct ref_reduction_t<s8, s32, s32>;
 template struct ref_reduction_t<s8, f32, f32>;
@@ -47,6 +47,7 @@ struct ref_reduction_t : public primitive_t {
                     && platform::has_data_type_support(dst_type)
                     && set_default_params() == status::success
                     && attr()->has_default_values(sm::post_ops)
+                    && IMPLICATION(is_arg_alg(), attr()->has_default_values())
                     && attr_.set_default_formats(dst_md(0)) == status::success;
             if (!ok) return status::unimplemented;
 
@@ -81,6 +82,7 @@ private:
     void finalize(
             float &acc_f32, alg_kind_t alg, float p, float eps, dim_t n) const;
     void init_acc(acc_t &acc, alg_kind_t alg) const;
+    bool update_arg(acc_t &acc, const src_t &src, alg_kind_t alg) const;
 };
 
 } // namespace cpu
@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ref_topk.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+template <data_type_t d_type>
+status_t ref_topk_t<d_type>::execute_ref(const exec_ctx_t &ctx) const {
+    using namespace topk_utils;
+
+    status_t status = status::success;
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_CLEAN_MEM(data_t *, DNNL_ARG_DST, status);
+    CHECK(status);
+    auto indices = CTX_OUT_CLEAN_MEM(int32_t *, DNNL_ARG_DST_1, status);
+    CHECK(status);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    const memory_desc_wrapper indices_d(pd()->dst_md(1));
+
+    const int ndims = src_d.ndims();
+    const int axis = pd()->axis();
+    const dim_t axis_size = pd()->axis_size();
+    const dim_t K = pd()->K();
+    const bool is_max = pd()->is_max();
+
+    // Points of the outer dimensions, each of them selects along the axis.
+    dims_t outer_dims;
+    utils::array_copy(outer_dims, src_d.dims(), ndims);
+    outer_dims[axis] = 1;
+    const dim_t outer_size = src_d.nelems() / axis_size;
+
+    auto scratch_entries = ctx.get_scratchpad_grantor().template get<entry_t>(
+            memory_tracking::names::key_topk_entries);
+
+    const auto cmp = [=](const entry_t &a, const entry_t &b) {
+        return precedes(a, b, is_max);
+    };
+
+    parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(outer_size, nthr, ithr, start, end);
+        entry_t *entries = scratch_entries + ithr * axis_size;
+
+        dims_t pos;
+        for (dim_t l_offset = start; l_offset < end; l_offset++) {
+            utils::l_dims_by_l_offset(pos, l_offset, outer_dims, ndims);
+            for (dim_t i = 0; i < axis_size; i++) {
+                pos[axis] = i;
+                entries[i].value = static_cast<float>(src[src_d.off_v(pos)]);
+                entries[i].index = static_cast<int32_t>(i);
+            }
+
+            std::partial_sort(entries, entries + K, entries + axis_size, cmp);
+
+            for (dim_t k = 0; k < K; k++) {
+                pos[axis] = k;
+                dst[dst_d.off_v(pos)] = static_cast<data_t>(entries[k].value);
+                indices[indices_d.off_v(pos)] = entries[k].index;
+            }
+        }
+    });
+
+    return status::success;
+}
+
+using namespace data_type;
+template struct ref_topk_t<f32>;
+template struct ref_topk_t<bf16>;
+template struct ref_topk_t<s8>;
+template struct ref_topk_t<u8>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
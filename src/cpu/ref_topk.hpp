@@ -0,0 +1,83 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_TOPK_HPP
+#define CPU_REF_TOPK_HPP
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_topk_pd.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/topk_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+template <data_type_t d_type>
+struct ref_topk_t : public primitive_t {
+    struct pd_t : public cpu_topk_pd_t {
+        using cpu_topk_pd_t::cpu_topk_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_topk_t);
+
+        status_t init(engine_t *engine) {
+            bool ok = src_md()->data_type == d_type
+                    && dst_md(0)->data_type == d_type
+                    && dst_md(1)->data_type == data_type::s32
+                    && platform::has_data_type_support(d_type)
+                    && set_default_params() == status::success
+                    && attr()->has_default_values();
+            if (!ok) return status::unimplemented;
+
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        int nthr_; // To not exceed the limit in execute used for set up.
+
+    private:
+        void init_scratchpad() {
+            nthr_ = dnnl_get_max_threads();
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<topk_utils::entry_t>(
+                    memory_tracking::names::key_topk_entries,
+                    axis_size() * nthr_);
+        }
+    };
+
+    ref_topk_t(const pd_t *apd) : primitive_t(apd) {}
+
+    using data_t = typename prec_traits<d_type>::type;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_ref(ctx);
+    }
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    status_t execute_ref(const exec_ctx_t &ctx) const;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
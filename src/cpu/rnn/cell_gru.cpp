@@ -142,8 +142,10 @@ dnnl_status_t gru_bwd_cell_exec_template(T1 gemm_layer_f, T2 gemm_iter_f,
 
     // 4. calculate diff weights
     // dWh1 += dG1 * h, dWh2 += dG2 * h, dWh3 += dG3 * (G1(*)h)
-    CHECK(gemm_weights_iter_f((rnn.n_gates - 1) * rnn.dhc, rnn.sic, rnn.mb,
-            scratch_gates_, src_iter_, src_iter_ld, 1.0f, diff_w_iter_));
+    // dWh1 and dWh2 are computed over all the iterations when merged
+    if (!rnn.merge_gemm_iter)
+        CHECK(gemm_weights_iter_f((rnn.n_gates - 1) * rnn.dhc, rnn.sic, rnn.mb,
+                scratch_gates_, src_iter_, src_iter_ld, 1.0f, diff_w_iter_));
     CHECK(gemm_weights_iter_f(rnn.dhc, rnn.sic, rnn.mb,
             &(scratch_gates(0, 2, 0)), scratch_cell_, rnn.ws_states_layer_ld,
             1.0f, &(diff_w_iter(0, 2, 0))));
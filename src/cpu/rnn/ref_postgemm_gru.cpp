@@ -138,7 +138,8 @@ void gru_fwd_part2_postgemm_template(T1 func1, T2 to_src, T3 acc_to_float,
                                     + bias(2, j));
 
             if (rnn.is_augru) {
-                const auto a = reinterpret_as_float(augru_attention(i));
+                // the attention has the data type of src_layer
+                const auto a = src_to_float(augru_attention(i));
                 G0 = 1 - a * G0;
             }
 
@@ -29,6 +29,8 @@
 
  */
 
+#include <atomic>
+
 #include "common/dnnl_thread.hpp"
 #include "common/stream.hpp"
 
@@ -237,6 +239,235 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
                   return dnnl_success;
               };
 
+    // With variable sequence lengths, the cells only process the rows of the
+    // sequences that are still running.
+    rnn_conf_t seq_rnn = rnn;
+
+    // conf.mb rows of the cell starting from row mb_s are computed.
+    const auto compute_cell = [&](const rnn_conf_t &conf, int dir, int j,
+                                      int i, int slot, int mb_s) {
+        const int lay = (aprop == prop_kind::forward) ? j : rnn.n_layer - j - 1;
+        const int iter
+                = (aprop == prop_kind::forward) ? i : rnn.n_iter - i - 1;
+
+        if (seq_active_mb_) {
+            if (seq_active_mb_[iter] == 0) return dnnl_success;
+            seq_rnn.mb = seq_active_mb_[iter];
+        }
+        const rnn_conf_t &cell_rnn = seq_active_mb_ ? seq_rnn : conf;
+
+        // We set parameters to the cell execution call
+
+        // dst_layer is equal to dst_iter. To avoid
+        // duplication of memory access we hence use only
+        // dst_layer and set dst_iter to nullptr, unless we
+        // cannot for one of the following condition:
+        // - in the last layer and last iteration, we need to
+        //   copy ht in two tensors (dst_layer and dst_iter)
+        dst_layer_t *cell_dst_layer
+                = &(ws_states_layer(lay + 1, dir, iter + 1, 0));
+        dst_iter_t *cell_dst_iter = nullptr;
+        const src_layer_t *cell_src_layer
+                = &(ws_states_layer(lay, dir, iter + 1, 0));
+        const src_iter_t *cell_src_iter
+                = &(ws_states_iter(lay + 1, dir, iter, 0));
+
+        void *cell_dst_iter_c = const_cast<void *>(
+                ws_states_iter_c(lay + 1, dir, iter + 1, 0));
+        const void *cell_src_iter_c
+                = ws_states_iter_c(lay + 1, dir, iter, 0);
+
+        // the cell_position is used only when skip_data_copy is
+        // supported currently supported only for forward
+        cell_position_t cell_position = middle_cell;
+        if (iter == 0) cell_position |= first_iter;
+        if (lay == 0) cell_position |= first_layer;
+        if (iter == rnn.n_iter - 1) cell_position |= last_iter;
+        if (lay == rnn.n_layer - 1) cell_position |= last_layer;
+
+        // The dst_* paths should be before the src_* paths as
+        // the later will override cell_src_layer and
+        // cell_src_iter appropriately for 1st layer and 1st
+        // iter.
+        const bool last_iter_skip_copy
+                = rnn.skip_dst_iter_copy() && (cell_position & last_iter);
+        if (last_iter_skip_copy) {
+            cell_dst_layer = dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0);
+            cell_src_layer
+                    = dst_iter_ + dst_iter_mdw.off(lay - 1, dir, 0, 0);
+        }
+
+        if (rnn.skip_dst_layer_copy() && (cell_position & last_layer)) {
+            // Note: for last layer and last iter, the output is in dst_layer
+            // and still need to be copied to dst_iter
+            cell_dst_layer = dst_layer_ + dst_layer_mdw.off(iter, 0, 0);
+            cell_dst_iter = last_iter_skip_copy
+                    ? dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0)
+                    : nullptr;
+            cell_src_iter = (iter != 0)
+                    ? dst_layer_ + dst_layer_mdw.off(iter - 1, 0, 0)
+                    : cell_src_iter;
+        }
+        if (rnn.skip_src_iter_copy() && (cell_position & first_iter))
+            cell_src_iter = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
+
+        if (rnn.skip_src_layer_copy() && (cell_position & first_layer))
+            cell_src_layer = src_layer_ + src_layer_mdw.off(iter, 0, 0);
+
+        // because the c state is always f32 and require no
+        // conversion, we can always skip to copy for the 1st
+        // and last iteration. The rows are reordered with variable
+        // sequence lengths, so the c state is copied in this case.
+        if (iter == 0 && src_iter_c_ && !seq_active_mb_) {
+            cell_src_iter_c = inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
+                    src_iter_c_mdw.off(lay, dir, 0, 0));
+            cell_position |= c_state_first_iter;
+        }
+        if (iter == rnn.n_iter - 1 && dst_iter_c_ && !seq_active_mb_) {
+            cell_dst_iter_c = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
+                    dst_iter_c_mdw.off(lay, dir, 0, 0));
+            cell_position |= c_state_last_iter;
+        }
+
+        // Cells computed concurrently use different scratch buffers.
+        auto cell_scratch_gates = rnn.n_iter_scratch_gates == 1
+                ? scratch_gates_
+                        + slot * rnn.scratch_gates_nld * rnn.scratch_gates_ld
+                : scratch_gates_
+                        + iter * rnn.scratch_gates_nld
+                                * rnn.scratch_gates_ld;
+        const auto cell_scratch_cell = reinterpret_cast<scratch_t *>(
+                reinterpret_cast<char *>(scratch_cell_)
+                + slot * rnn.scratch_cell_size);
+
+        dst_iter_t *proj_ht = nullptr;
+        if (rnn.is_lstm_projection) {
+            if (rnn.is_training)
+                proj_ht = &(ws_ht(lay, dir, iter, 0));
+            else
+                proj_ht = scratch_ht_
+                        + slot * rnn.scratch_ht_nld * rnn.scratch_ht_ld;
+        }
+
+        if (mb_s > 0) {
+            cell_dst_layer += mb_s * rnn.dst_layer_ld(cell_position, true);
+            if (cell_dst_iter)
+                cell_dst_iter += mb_s * rnn.dst_iter_ld(cell_position);
+            cell_src_layer += mb_s * rnn.src_layer_ld(cell_position);
+            cell_src_iter += mb_s * rnn.src_iter_ld(cell_position);
+            cell_dst_iter_c = inc_ptr(cell_dst_iter_c, rnn.dst_iter_c_dt,
+                    mb_s * rnn.dst_iter_c_ld(cell_position));
+            cell_src_iter_c = inc_ptr(cell_src_iter_c, rnn.src_iter_c_dt,
+                    mb_s * rnn.src_iter_c_ld(cell_position));
+            cell_scratch_gates += mb_s * rnn.scratch_gates_ld;
+            if (proj_ht) proj_ht += mb_s * rnn.proj_ht_ld;
+        }
+
+#if DNNL_X64
+        CHECK((this->*cell_func)(ctx, cell_rnn, cell_position,
+                cell_dst_layer,
+                cell_dst_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
+                SAFE_PTR(diff_augru_attention, iter, 0, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
+                SAFE_PTR(weights_layer, lay, dir, 0),
+                SAFE_PTR(weights_iter, lay, dir, 0),
+                SAFE_PTR(weights_projection, lay, dir),
+                SAFE_PTR(weights_peephole, lay, dir, 0),
+                w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
+                            : nullptr,
+                bias(lay, dir), cell_src_layer,
+                SAFE_PTR(augru_attention, iter, mb_s, 0), cell_src_iter,
+                cell_src_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
+                SAFE_PTR(diff_weights_layer, lay, dir, 0),
+                SAFE_PTR(diff_weights_iter, lay, dir, 0),
+                SAFE_PTR(diff_weights_projection, lay, dir, 0),
+                SAFE_PTR(diff_weights_peephole, lay, dir, 0),
+                SAFE_PTR(diff_bias, lay, dir, 0),
+                SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
+                proj_ht, scratch_diff_ht_,
+                SAFE_PTR(ws_grid, lay, dir, iter, 0), cell_scratch_cell,
+                scratch_gates_blocked_, scratch_src_layer_,
+                scratch_src_iter_, cell_dst_iter, amx_scratchpad,
+                addr_batch_global));
+#else
+        CHECK((this->*cell_func)(cell_rnn, cell_position, cell_dst_layer,
+                cell_dst_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
+                SAFE_PTR(diff_augru_attention, iter, 0, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
+                SAFE_PTR(weights_layer, lay, dir, 0),
+                SAFE_PTR(weights_iter, lay, dir, 0),
+                SAFE_PTR(weights_projection, lay, dir),
+                SAFE_PTR(weights_peephole, lay, dir, 0),
+                w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
+                            : nullptr,
+                bias(lay, dir), cell_src_layer,
+                SAFE_PTR(augru_attention, iter, mb_s, 0), cell_src_iter,
+                cell_src_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
+                SAFE_PTR(diff_weights_layer, lay, dir, 0),
+                SAFE_PTR(diff_weights_iter, lay, dir, 0),
+                SAFE_PTR(diff_weights_projection, lay, dir, 0),
+                SAFE_PTR(diff_weights_peephole, lay, dir, 0),
+                SAFE_PTR(diff_bias, lay, dir, 0),
+                SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
+                proj_ht, scratch_diff_ht_,
+                SAFE_PTR(ws_grid, lay, dir, iter, 0), cell_scratch_cell,
+                cell_dst_iter, amx_scratchpad));
+#endif
+        return dnnl_success;
+    };
+#undef SAFE_PTR
+
+    if (rnn.use_wavefront) {
+        // Cell (lay, iter) only depends on cells (lay - 1, iter) and
+        // (lay, iter - 1), so the cells of all the directions with the same
+        // lay + iter are independent and are computed concurrently. When there
+        // are more threads than cells, the minibatch rows of each cell are
+        // split between several threads, each of them computing its slice of
+        // rows single-threaded. The lbr cells keep their rows on one thread as
+        // their scratch cell is not laid out by rows of scratch gates.
+        const int nthr_max = dnnl_get_max_threads();
+        for (int w = 0; w < rnn.n_layer + rnn.n_iter - 1; w++) {
+            const int j_start = nstl::max(0, w - rnn.n_iter + 1);
+            const int n_lay = nstl::min(rnn.n_layer, w + 1) - j_start;
+            const int n_cells = rnn.n_dir * n_lay;
+            const int n_mb_chunks = rnn.is_lbr
+                    ? 1
+                    : nstl::min(rnn.mb, nstl::max(1, nthr_max / n_cells));
+            const int work_amount = n_cells * n_mb_chunks;
+            std::atomic<dnnl_status_t> st(dnnl_success);
+            parallel(nstl::min(work_amount, nthr_max), [&](int ithr, int nthr) {
+                int start {0}, end {0};
+                balance211(work_amount, nthr, ithr, start, end);
+                rnn_conf_t chunk_rnn = rnn;
+                for (int iwork = start; iwork < end; iwork++) {
+                    const int c = iwork / n_mb_chunks;
+                    const int dir = c / n_lay;
+                    const int j = j_start + c % n_lay;
+                    int mb_s {0}, mb_e {0};
+                    balance211(rnn.mb, n_mb_chunks, iwork % n_mb_chunks, mb_s,
+                            mb_e);
+                    if (mb_s == mb_e) continue;
+                    chunk_rnn.mb = mb_e - mb_s;
+                    const dnnl_status_t cell_st
+                            = compute_cell(chunk_rnn, dir, j, w - j, c, mb_s);
+                    if (cell_st != dnnl_success) st = cell_st;
+                }
+            });
+            CHECK(st);
+        }
+        return dnnl_success;
+    }
+
     // We run the grid of computation
     for_(int dir = 0; dir < rnn.n_dir; dir++)
     for (int j = 0; j < rnn.n_layer; j++) {
@@ -247,160 +478,34 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
 
         // TODO: enable merging projection gemm in bwd lstm projection
 
-        for (int i = 0; i < rnn.n_iter; i++) {
-            const int iter
-                    = (aprop == prop_kind::forward) ? i : rnn.n_iter - i - 1;
-
-            // We set parameters to the cell execution call
-
-            // dst_layer is equal to dst_iter. To avoid
-            // duplication of memory access we hence use only
-            // dst_layer and set dst_iter to nullptr, unless we
-            // cannot for one of the following condition:
-            // - in the last layer and last iteration, we need to
-            //   copy ht in two tensors (dst_layer and dst_iter)
-            dst_layer_t *cell_dst_layer
-                    = &(ws_states_layer(lay + 1, dir, iter + 1, 0));
-            dst_iter_t *cell_dst_iter = nullptr;
-            const src_layer_t *cell_src_layer
-                    = &(ws_states_layer(lay, dir, iter + 1, 0));
-            const src_iter_t *cell_src_iter
-                    = &(ws_states_iter(lay + 1, dir, iter, 0));
-
-            void *cell_dst_iter_c = const_cast<void *>(
-                    ws_states_iter_c(lay + 1, dir, iter + 1, 0));
-            const void *cell_src_iter_c
-                    = ws_states_iter_c(lay + 1, dir, iter, 0);
-
-            // the cell_position is used only when skip_data_copy is
-            // supported currently supported only for forward
-            cell_position_t cell_position = middle_cell;
-            if (iter == 0) cell_position |= first_iter;
-            if (lay == 0) cell_position |= first_layer;
-            if (iter == rnn.n_iter - 1) cell_position |= last_iter;
-            if (lay == rnn.n_layer - 1) cell_position |= last_layer;
-
-            // The dst_* paths should be before the src_* paths as
-            // the later will override cell_src_layer and
-            // cell_src_iter appropriately for 1st layer and 1st
-            // iter.
-            const bool last_iter_skip_copy
-                    = rnn.skip_dst_iter_copy() && (cell_position & last_iter);
-            if (last_iter_skip_copy) {
-                cell_dst_layer = dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0);
-                cell_src_layer
-                        = dst_iter_ + dst_iter_mdw.off(lay - 1, dir, 0, 0);
-            }
-
-            if (rnn.skip_dst_layer_copy() && (cell_position & last_layer)) {
-                // Note: for last layer and last iter, the output is in dst_layer
-                // and still need to be copied to dst_iter
-                cell_dst_layer = dst_layer_ + dst_layer_mdw.off(iter, 0, 0);
-                cell_dst_iter = last_iter_skip_copy
-                        ? dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0)
-                        : nullptr;
-                cell_src_iter = (iter != 0)
-                        ? dst_layer_ + dst_layer_mdw.off(iter - 1, 0, 0)
-                        : cell_src_iter;
-            }
-            if (rnn.skip_src_iter_copy() && (cell_position & first_iter))
-                cell_src_iter = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
-
-            if (rnn.skip_src_layer_copy() && (cell_position & first_layer))
-                cell_src_layer = src_layer_ + src_layer_mdw.off(iter, 0, 0);
-
-            // because the c state is always f32 and require no
-            // conversion, we can always skip to copy for the 1st
-            // and last iteration
-            if (iter == 0 && src_iter_c_) {
-                cell_src_iter_c = inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
-                        src_iter_c_mdw.off(lay, dir, 0, 0));
-                cell_position |= c_state_first_iter;
-            }
-            if (iter == rnn.n_iter - 1 && dst_iter_c_) {
-                cell_dst_iter_c = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
-                        dst_iter_c_mdw.off(lay, dir, 0, 0));
-                cell_position |= c_state_last_iter;
-            }
-
-            const auto cell_scratch_gates = rnn.n_iter_scratch_gates == 1
-                    ? scratch_gates_
-                    : scratch_gates_
-                            + iter * rnn.scratch_gates_nld
-                                    * rnn.scratch_gates_ld;
-
-            dst_iter_t *proj_ht = nullptr;
-            if (rnn.is_lstm_projection) {
-                if (rnn.is_training)
-                    proj_ht = &(ws_ht(lay, dir, iter, 0));
-                else
-                    proj_ht = scratch_ht_;
-            }
-
-#if DNNL_X64
-            CHECK((this->*cell_func)(ctx, rnn, cell_position, cell_dst_layer,
-                    cell_dst_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
-                    SAFE_PTR(diff_augru_attention, iter, 0, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
-                    SAFE_PTR(weights_layer, lay, dir, 0),
-                    SAFE_PTR(weights_iter, lay, dir, 0),
-                    SAFE_PTR(weights_projection, lay, dir),
-                    SAFE_PTR(weights_peephole, lay, dir, 0),
-                    w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
-                                : nullptr,
-                    bias(lay, dir), cell_src_layer,
-                    SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
-                    cell_src_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
-                    SAFE_PTR(diff_weights_layer, lay, dir, 0),
-                    SAFE_PTR(diff_weights_iter, lay, dir, 0),
-                    SAFE_PTR(diff_weights_projection, lay, dir, 0),
-                    SAFE_PTR(diff_weights_peephole, lay, dir, 0),
-                    SAFE_PTR(diff_bias, lay, dir, 0),
-                    SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
-                    proj_ht, scratch_diff_ht_,
-                    SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell_,
-                    scratch_gates_blocked_, scratch_src_layer_,
-                    scratch_src_iter_, cell_dst_iter, amx_scratchpad,
-                    addr_batch_global));
-#else
-            CHECK((this->*cell_func)(rnn, cell_position, cell_dst_layer,
-                    cell_dst_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
-                    SAFE_PTR(diff_augru_attention, iter, 0, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
-                    SAFE_PTR(weights_layer, lay, dir, 0),
-                    SAFE_PTR(weights_iter, lay, dir, 0),
-                    SAFE_PTR(weights_projection, lay, dir),
-                    SAFE_PTR(weights_peephole, lay, dir, 0),
-                    w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
-                                : nullptr,
-                    bias(lay, dir), cell_src_layer,
-                    SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
-                    cell_src_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
-                    SAFE_PTR(diff_weights_layer, lay, dir, 0),
-                    SAFE_PTR(diff_weights_iter, lay, dir, 0),
-                    SAFE_PTR(diff_weights_projection, lay, dir, 0),
-                    SAFE_PTR(diff_weights_peephole, lay, dir, 0),
-                    SAFE_PTR(diff_bias, lay, dir, 0),
-                    SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
-                    proj_ht, scratch_diff_ht_,
-                    SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell_,
-                    cell_dst_iter, amx_scratchpad));
-#endif
+        if (rnn.brgemm_fwd_persistent && !dnnl_in_parallel()) {
+            // All the iterations of the layer are computed in one parallel
+            // region. The cell kernels use the thread of the region they are
+            // called from and end with a barrier.
+            std::atomic<dnnl_status_t> st(dnnl_success);
+            parallel(nstl::min<int>(rnn.nthr, rnn.N_blocks),
+                    [&](int ithr, int nthr) {
+                        rnn_conf_t thr_rnn = rnn;
+                        if (nthr > 1) {
+                            thr_rnn.cell_ithr = ithr;
+                            thr_rnn.cell_nthr = nthr;
+                        }
+                        // A failing thread keeps going so that the others do
+                        // not wait for it at the barriers.
+                        for (int i = 0; i < rnn.n_iter; i++) {
+                            const dnnl_status_t cell_st
+                                    = compute_cell(thr_rnn, dir, j, i, 0, 0);
+                            if (cell_st != dnnl_success) st = cell_st;
+                        }
+                    });
+            CHECK(st);
+        } else {
+            for (int i = 0; i < rnn.n_iter; i++)
+                CHECK(compute_cell(rnn, dir, j, i, 0, 0));
         }
 
         CHECK(compute_merged_layer_part_if_applicable(
                 prop_kind::backward, dir, lay));
-#undef SAFE_PTR
 
         if ((aprop == prop_kind::backward) && rnn.merge_gemm_iter) {
             // This is split in 3 pieces if we skip copies.
@@ -410,6 +515,9 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
             const dst_iter_t *states_iter = nullptr;
             int states_iter_ld = 0;
             int niter_merge_gemm_iter = 0;
+            // The GRU candidate gate is handled in the cell.
+            const int n_gates_merge_gemm_iter
+                    = rnn.is_orig_gru ? rnn.n_gates - 1 : rnn.n_gates;
 
             states_iter = &(
                     ws_states_iter(lay + 1, dir, rnn.skip_src_iter_copy(), 0));
@@ -421,8 +529,8 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
             }
             niter_merge_gemm_iter = rnn.n_iter - rnn.skip_src_iter_copy();
             if (niter_merge_gemm_iter > 0) {
-                CHECK(gemm('N', 'T', rnn.n_gates * rnn.dhc, rnn.sic,
-                        rnn.mb * niter_merge_gemm_iter, 1.0,
+                CHECK(gemm('N', 'T', n_gates_merge_gemm_iter * rnn.dhc,
+                        rnn.sic, rnn.mb * niter_merge_gemm_iter, 1.0,
                         (weights_t *)scratch_gates_
                                 + rnn.skip_src_iter_copy()
                                         * rnn.scratch_gates_nld
@@ -436,8 +544,8 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
                 states_iter = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
                 states_iter_ld = rnn.src_iter_ld_;
                 niter_merge_gemm_iter = 1;
-                CHECK(gemm('N', 'T', rnn.n_gates * rnn.dhc, rnn.sic,
-                        rnn.mb * niter_merge_gemm_iter, 1.0,
+                CHECK(gemm('N', 'T', n_gates_merge_gemm_iter * rnn.dhc,
+                        rnn.sic, rnn.mb * niter_merge_gemm_iter, 1.0,
                         (weights_t *)scratch_gates_, rnn.scratch_gates_ld,
                         states_iter, states_iter_ld, 1.0,
                         &(diff_weights_iter(lay, dir, 0)),
@@ -1016,6 +1124,167 @@ RNN_DECL_COPY_RES_ITER_FWD(ref_rnn_fwd_s8s8_t)
 RNN_DECL_COPY_RES_ITER_BWD(ref_rnn_bwd_f32_t)
 RNN_DECL_COPY_RES_ITER_BWD(ref_rnn_bwd_bf16_t)
 
+/* With variable sequence lengths the rows of the workspace states are sorted
+ * by decreasing sequence length, so that the sequences still running at
+ * iteration `it` occupy the first active_mb[it] rows and the cells can work on
+ * a shrunk minibatch. Sequence b of the user minibatch is kept in the row
+ * pos[b]. Only l2r execution is supported.
+ * */
+struct seq_lengths_t {
+    const dim_t *len;
+    const dim_t *pos;
+    const dim_t *active_mb;
+};
+
+// Clamps the user sequence lengths to [0, n_iter] and sorts the rows. len and
+// pos have mb elements, active_mb and the temporary buffer next have
+// n_iter + 1 elements. A missing argument means all the sequences are full.
+static seq_lengths_t init_seq_lengths(const rnn_conf_t &rnn,
+        const int32_t *seq_lengths_, dim_t *len, dim_t *pos, dim_t *active_mb,
+        dim_t *next) {
+    for (int it = 0; it <= rnn.n_iter; it++)
+        active_mb[it] = 0;
+    for (int b = 0; b < rnn.mb; b++) {
+        len[b] = seq_lengths_
+                ? nstl::min(nstl::max(seq_lengths_[b], 0), rnn.n_iter)
+                : rnn.n_iter;
+        active_mb[len[b]]++;
+    }
+    // Counting sort: active_mb[it] becomes the number of sequences longer
+    // than it, and sequences of length l start at the row active_mb[l].
+    dim_t longer = 0;
+    for (int l = rnn.n_iter; l >= 0; l--) {
+        const dim_t n = active_mb[l];
+        active_mb[l] = longer;
+        next[l] = longer;
+        longer += n;
+    }
+    for (int b = 0; b < rnn.mb; b++)
+        pos[b] = next[len[b]]++;
+    return {len, pos, active_mb};
+}
+
+template <typename src_data_t, typename input_data_t>
+void copy_init_layer_seq_template(const rnn_conf_t &rnn,
+        const seq_lengths_t &seq, src_data_t *__restrict ws_states_layer_,
+        const input_data_t *__restrict xt_, const memory_desc_wrapper &xt_d) {
+    const AOC<src_data_t, 4> ws_states_layer(ws_states_layer_, rnn.n_dir,
+            rnn.n_iter + 1, rnn.mb, rnn.ws_states_layer_ld);
+
+    parallel_nd(rnn.n_iter, rnn.mb, [&](dim_t it, dim_t b) {
+        if (it >= seq.len[b]) return;
+        const auto *xxt = xt_ + xt_d.blk_off(it, b);
+        src_data_t *dd = &(ws_states_layer(0, it + 1, seq.pos[b], 0));
+        PRAGMA_OMP_SIMD()
+        for (int c = 0; c < rnn.slc; c++)
+            dd[c] = (src_data_t)xxt[c];
+    });
+}
+
+template <typename src_data_t, typename input_data_t>
+void copy_init_iter_seq_template(const rnn_conf_t &rnn, const rnn_pd_t *pd,
+        const seq_lengths_t &seq, src_data_t *__restrict ws_states_iter_,
+        void *__restrict ws_states_iter_c_,
+        const input_data_t *__restrict src_iter_,
+        const memory_desc_wrapper &src_iter_d,
+        const void *__restrict src_iter_c_,
+        const memory_desc_wrapper &src_iter_c_d) {
+    const AOC<src_data_t, 5> ws_states_iter(ws_states_iter_, rnn.n_layer + 1,
+            rnn.n_dir, rnn.n_iter + 1, rnn.mb, rnn.ws_states_iter_ld);
+    const auto ws_states_iter_c = rnn_utils::make_raw_aoc(ws_states_iter_c_,
+            types::data_type_size(rnn.src_iter_c_dt), rnn.n_layer + 1,
+            rnn.n_dir, rnn.n_iter + 1, rnn.mb, rnn.ws_states_iter_c_ld);
+    const bool is_lstm = pd->cell_kind() == alg_kind::vanilla_lstm;
+    const size_t c_size
+            = rnn.dhc * types::data_type_size(rnn.src_iter_c_dt);
+
+    // The c state is not read from the user memory by the cells, as the rows
+    // are reordered.
+    parallel_nd(rnn.n_layer, rnn.n_dir, rnn.mb,
+            [&](dim_t lay, dim_t dir, dim_t b) {
+                auto *dd = &ws_states_iter(lay + 1, dir, 0, seq.pos[b], 0);
+                if (src_iter_) {
+                    const auto *ss
+                            = &src_iter_[src_iter_d.blk_off(lay, dir, b, 0)];
+                    PRAGMA_OMP_SIMD()
+                    for (int s = 0; s < rnn.sic; s++)
+                        dd[s] = (src_data_t)ss[s];
+                } else {
+                    for (int s = 0; s < rnn.sic; s++)
+                        dd[s] = (src_data_t)0.f;
+                }
+                if (!is_lstm) return;
+                void *dd_c = const_cast<void *>(
+                        ws_states_iter_c(lay + 1, dir, 0, seq.pos[b], 0));
+                if (src_iter_c_)
+                    std::memcpy(dd_c,
+                            inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
+                                    src_iter_c_d.blk_off(lay, dir, b, 0)),
+                            c_size);
+                else
+                    std::memset(dd_c, 0, c_size);
+            });
+}
+
+template <typename src_data_t, typename dst_layer_dt>
+void copy_res_layer_seq_template(const rnn_conf_t &rnn,
+        const seq_lengths_t &seq, dst_layer_dt *dst_layer_,
+        const memory_desc_wrapper &dst_layer_d,
+        const src_data_t *ws_states_layer_) {
+    const AOC<const src_data_t, 5> ws_states_layer(ws_states_layer_,
+            rnn.n_layer + 1, rnn.n_dir, rnn.n_iter + 1, rnn.mb,
+            rnn.ws_states_layer_ld);
+
+    // Outputs past the end of a sequence are zeroed.
+    parallel_nd(rnn.n_iter, rnn.mb, [&](dim_t it, dim_t b) {
+        auto *dd = &dst_layer_[dst_layer_d.blk_off(it, b, 0)];
+        if (it < seq.len[b]) {
+            const auto *ss
+                    = &ws_states_layer(rnn.n_layer, 0, it + 1, seq.pos[b], 0);
+            PRAGMA_OMP_SIMD()
+            for (int s = 0; s < rnn.dlc; s++)
+                dd[s] = (dst_layer_dt)ss[s];
+        } else {
+            for (int s = 0; s < rnn.dlc; s++)
+                dd[s] = (dst_layer_dt)0.f;
+        }
+    });
+}
+
+template <typename src_data_t, typename dst_iter_dt>
+void copy_res_iter_seq_template(const rnn_conf_t &rnn,
+        const seq_lengths_t &seq, dst_iter_dt *dst_iter_,
+        const memory_desc_wrapper &dst_iter_d, void *dst_iter_c_,
+        const memory_desc_wrapper &dst_iter_c_d,
+        const src_data_t *ws_states_iter_, const void *ws_states_iter_c_) {
+    const AOC<const src_data_t, 5> ws_states_iter(ws_states_iter_,
+            rnn.n_layer + 1, rnn.n_dir, rnn.n_iter + 1, rnn.mb,
+            rnn.ws_states_iter_ld);
+    const auto ws_states_iter_c = rnn_utils::make_raw_aoc(ws_states_iter_c_,
+            types::data_type_size(rnn.src_iter_c_dt), rnn.n_layer + 1,
+            rnn.n_dir, rnn.n_iter + 1, rnn.mb, rnn.ws_states_iter_c_ld);
+    const size_t c_size
+            = rnn.dhc * types::data_type_size(rnn.dst_iter_c_dt);
+
+    // The final states of a sequence are the ones after its last step.
+    parallel_nd(rnn.n_layer, rnn.n_dir, rnn.mb,
+            [&](dim_t lay, dim_t dir, dim_t b) {
+                const dim_t it = seq.len[b];
+                const dim_t row = seq.pos[b];
+                if (dst_iter_) {
+                    const auto *ss = &ws_states_iter(lay + 1, dir, it, row, 0);
+                    auto *dd = dst_iter_ + dst_iter_d.blk_off(lay, dir, b, 0);
+                    PRAGMA_OMP_SIMD()
+                    for (int s = 0; s < rnn.dic; s++)
+                        dd[s] = (dst_iter_dt)ss[s];
+                }
+                if (dst_iter_c_)
+                    std::memcpy(inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
+                                        dst_iter_c_d.blk_off(lay, dir, b, 0)),
+                            ws_states_iter_c(lay + 1, dir, it, row, 0), c_size);
+            });
+}
+
 rnn_bias_prepare_sig_templ(copy_bias_to_scratch) {
     const AOC<T, 3> scratch_bias(
             scratch_bias_, rnn.n_layer, rnn.n_dir, rnn.n_bias * rnn.dhc);
@@ -1166,6 +1435,7 @@ void _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute_(
             = CTX_IN_MEM(const src_layer_t *, DNNL_ARG_AUGRU_ATTENTION);
     auto src_iter = CTX_IN_MEM(const char *, DNNL_ARG_SRC_ITER);
     auto src_iter_c = CTX_IN_MEM(const void *, DNNL_ARG_SRC_ITER_C);
+    auto seq_lengths = CTX_IN_MEM(const int32_t *, DNNL_ARG_SEQ_LENGTHS);
     auto layer_weights_n_comp
             = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS_LAYER);
     auto iter_weights_n_comp = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS_ITER);
@@ -1183,6 +1453,22 @@ void _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute_(
             : const_cast<char *>(CTX_IN_MEM(const char *, DNNL_ARG_DST_ITER));
     auto dst_iter_c = CTX_OUT_MEM(void *, DNNL_ARG_DST_ITER_C);
 
+    // src_iter and dst_iter can share a buffer when a sequence is processed
+    // by chunks and the states are updated in place. If the first iteration
+    // of a layer is also its last one, its cell writes dst_iter while other
+    // threads, or a later part of the cell, still read the initial states
+    // from src_iter. Those are then copied to the workspace first. The c
+    // states are read and written element-wise, so they can always alias.
+    const bool inplace_src_iter_copy = rnn.is_fwd && rnn.n_iter == 1
+            && rnn.skip_src_iter_copy() && rnn.skip_dst_iter_copy()
+            && src_iter != nullptr && src_iter == dst_iter;
+    rnn_conf_t inplace_rnn;
+    if (inplace_src_iter_copy) {
+        inplace_rnn = rnn;
+        inplace_rnn.force_src_iter_copy = true;
+    }
+    const rnn_conf_t &exec_rnn = inplace_src_iter_copy ? inplace_rnn : rnn;
+
     auto diff_dst_layer
             = CTX_IN_MEM(const gemm_acc_t *, DNNL_ARG_DIFF_DST_LAYER);
     auto diff_dst_iter = CTX_IN_MEM(const gemm_acc_t *, DNNL_ARG_DIFF_DST_ITER);
@@ -1285,18 +1571,17 @@ void _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute_(
     const memory_desc_t *weights_layer_md = pd()->weights_md(0);
     const memory_desc_t *weights_iter_md = pd()->weights_md(1);
 
-    const auto tag = rnn.n_block == 64 ? format_tag::ldgOI64o2i
-                                       : format_tag::ldgOI32o2i;
+#if DNNL_X64
     memory_desc_t wei_layer_desc;
-    dnnl_memory_desc_init_by_tag(&wei_layer_desc, weights_layer_md->ndims,
-            weights_layer_md->dims, data_type::bf16, tag);
-
     memory_desc_t wei_iter_desc;
-    dnnl_memory_desc_init_by_tag(&wei_iter_desc, weights_iter_md->ndims,
-            weights_iter_md->dims, data_type::bf16, tag);
-
-#if DNNL_X64
     if (rnn.is_bf32()) {
+        const auto tag = rnn.n_block == 64 ? format_tag::ldgOI64o2i
+                                           : format_tag::ldgOI32o2i;
+        dnnl_memory_desc_init_by_tag(&wei_layer_desc, weights_layer_md->ndims,
+                weights_layer_md->dims, data_type::bf16, tag);
+        dnnl_memory_desc_init_by_tag(&wei_iter_desc, weights_iter_md->ndims,
+                weights_iter_md->dims, data_type::bf16, tag);
+
         if (rnn.is_augru) {
             const auto bf32_augru_attention
                     = scratchpad.template get<src_layer_t>(
@@ -1360,8 +1645,28 @@ void _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute_(
 
     (this->*bias_finalization_func)(rnn, ws_bias, w_iter_comp, w_layer_comp);
 
+    seq_lengths_t seq {nullptr, nullptr, nullptr};
+    if (rnn.with_seq_lengths) {
+        dim_t *seq_buf = scratchpad.template get<dim_t>(key_rnn_seq_lengths);
+        seq = init_seq_lengths(rnn, seq_lengths, seq_buf, seq_buf + rnn.mb,
+                seq_buf + 2 * rnn.mb, seq_buf + 2 * rnn.mb + rnn.n_iter + 1);
+    }
+
     // we first need to copy the initial states and input into ws
-    if (!(rnn.skip_src_layer_copy() && rnn.is_fwd)) {
+    if (rnn.with_seq_lengths) {
+        copy_init_layer_seq_template(rnn, seq, ws_states_layer, src_layer,
+                memory_desc_wrapper(pd()->src_md(0)));
+        const auto src_iter_d = memory_desc_wrapper(pd()->src_md(1));
+        const auto src_iter_c_d = memory_desc_wrapper(pd()->src_md(2));
+        if (pd()->src_md(1)->data_type == data_type::f32)
+            copy_init_iter_seq_template(rnn, pd(), seq, ws_states_iter,
+                    ws_states_iter_c, (const float *)src_iter, src_iter_d,
+                    src_iter_c, src_iter_c_d);
+        else
+            copy_init_iter_seq_template(rnn, pd(), seq, ws_states_iter,
+                    ws_states_iter_c, (const src_iter_t *)src_iter,
+                    src_iter_d, src_iter_c, src_iter_c_d);
+    } else if (!(rnn.skip_src_layer_copy() && rnn.is_fwd)) {
         if (pd()->src_md(0)->data_type == data_type::f32)
             copy_init_layer(rnn, ws_states_layer, ws_diff_states_layer,
                     (const float *)src_layer, diff_dst_layer);
@@ -1370,7 +1675,8 @@ void _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute_(
                     src_layer, diff_dst_layer);
     }
 
-    if (!(rnn.skip_src_iter_copy() && rnn.is_fwd)) {
+    if (!rnn.with_seq_lengths
+            && !(exec_rnn.skip_src_iter_copy() && rnn.is_fwd)) {
         if (pd()->src_md(1)->data_type == data_type::f32)
             copy_init_iter(rnn, ws_states_iter,
                     static_cast<void *>(ws_states_iter_c), ws_diff_states_iter,
@@ -1388,11 +1694,11 @@ void _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute_(
 #if DNNL_X64
             ctx,
 #endif
-            rnn, ptr_wei_layer, ptr_wei_iter, ptr_wei_projection,
+            exec_rnn, ptr_wei_layer, ptr_wei_iter, ptr_wei_projection,
             weights_peephole, w_projection_comp, ptr_bias, src_layer,
             augru_attention, (const src_iter_t *)src_iter, src_iter_c,
-            (dst_layer_t *)dst_layer, (dst_iter_t *)dst_iter, dst_iter_c,
-            ws_states_layer, ws_states_iter, ws_states_iter_c,
+            seq.active_mb, (dst_layer_t *)dst_layer, (dst_iter_t *)dst_iter,
+            dst_iter_c, ws_states_layer, ws_states_iter, ws_states_iter_c,
             ws_diff_states_layer, ws_diff_states_iter, ws_diff_states_iter_c,
             ws_gates, ws_ht, ws_grid, scratch_gates, scratch_ht,
             scratch_diff_ht, scratch_cell,
@@ -1409,6 +1715,27 @@ void _ref_rnn_common_t<aprop, src_type, weights_type, acc_type>::execute_(
     );
 
     // Finally we copy the results to the result buffers
+    if (rnn.with_seq_lengths) {
+        const auto dst_layer_d = memory_desc_wrapper(pd()->dst_md(0));
+        const auto dst_iter_d = memory_desc_wrapper(pd()->dst_md(1));
+        const auto dst_iter_c_d = memory_desc_wrapper(pd()->dst_md(2));
+        if (pd()->dst_md(0)->data_type == data_type::f32)
+            copy_res_layer_seq_template(rnn, seq, (float *)dst_layer,
+                    dst_layer_d, ws_states_layer);
+        else
+            copy_res_layer_seq_template(rnn, seq, (dst_layer_t *)dst_layer,
+                    dst_layer_d, ws_states_layer);
+        if (pd()->dst_md(1)->data_type == data_type::f32)
+            copy_res_iter_seq_template(rnn, seq, (float *)dst_iter,
+                    dst_iter_d, dst_iter_c, dst_iter_c_d, ws_states_iter,
+                    ws_states_iter_c);
+        else
+            copy_res_iter_seq_template(rnn, seq, (dst_iter_t *)dst_iter,
+                    dst_iter_d, dst_iter_c, dst_iter_c_d, ws_states_iter,
+                    ws_states_iter_c);
+        return;
+    }
+
     if (!(rnn.skip_dst_layer_copy() && rnn.is_fwd)) {
         if (pd()->dst_md(0)->data_type == data_type::f32)
             copy_res_layer(rnn, (float *)dst_layer, diff_src_layer, dst_iter,
@@ -157,6 +157,18 @@ struct _ref_rnn_common_t : public primitive_t {
 
             if (!ok) return status::unimplemented;
 
+            // Variable sequence lengths are supported for unidirectional
+            // inference only: rows of finished sequences are dropped from the
+            // gemms, which requires per cell computations.
+            ok = IMPLICATION(this->with_seq_lengths(),
+                    this->desc()->prop_kind == forward_inference
+                            && this->direction()
+                                    == dnnl_unidirectional_left2right
+                            && !this->is_augru()
+                            && one_of(weights_layer_dt, data_type::f32,
+                                    data_type::bf16));
+            if (!ok) return status::unimplemented;
+
             rnn_ = zero<decltype(rnn_)>();
             rnn_.is_brgemm = false;
             ok = init_conf<class_name>(rnn_, *this->desc(), *this->attr(),
@@ -279,7 +291,7 @@ struct _ref_rnn_common_t : public primitive_t {
                                     && everyone_is(weights_type,
                                             weights_iter_dt, weights_layer_dt))
                     && this->set_default_params() == status::success
-                    && this->with_bias();
+                    && this->with_bias() && !this->with_seq_lengths();
 
             if (!ok) return status::unimplemented;
 
@@ -512,19 +524,23 @@ struct _ref_rnn_common_t : public primitive_t {
                     key_rnn_ptrs_wei_iter, ptr_wei_sz);
             scratchpad.template book<float *>(
                     key_rnn_ptrs_wei_projection, ptr_wei_sz);
+            if (rnn_.with_seq_lengths)
+                scratchpad.template book<dim_t>(key_rnn_seq_lengths,
+                        2 * rnn_.mb + 2 * (rnn_.n_iter + 1));
 
             const auto bias_dt_size = types::data_type_size(
                     this->arg_md(DNNL_ARG_BIAS)->data_type);
             scratchpad.template book<void *>(
                     key_rnn_ptrs_bia, ptr_wei_sz * bias_dt_size);
 
-            scratchpad.template book<scratch_t>(
-                    key_rnn_gates, rnn_.scratch_gates_size);
-            scratchpad.template book<ht_t>(key_rnn_ht, rnn_.scratch_ht_size);
+            scratchpad.template book<scratch_t>(key_rnn_gates,
+                    rnn_.n_wavefront_cells * rnn_.scratch_gates_size);
+            scratchpad.template book<ht_t>(key_rnn_ht,
+                    rnn_.n_wavefront_cells * rnn_.scratch_ht_size);
             scratchpad.template book<gemm_acc_t>(
                     key_rnn_diff_ht, rnn_.scratch_diff_ht_size);
-            scratchpad.template book<scratch_t>(
-                    key_rnn_cell, rnn_.scratch_cell_size);
+            scratchpad.template book<scratch_t>(key_rnn_cell,
+                    rnn_.n_wavefront_cells * rnn_.scratch_cell_size);
 
 #if DNNL_X64
             if (rnn_.is_brgemm) {
@@ -99,6 +99,27 @@ int rnn_utils::get_good_ld(int dim, int sizeof_dt) {
     return (ld % 256 == 0) ? ld + 64 / sizeof_dt : ld;
 }
 
+bool rnn_utils::use_wavefront_execution(const rnn_conf_t &rnn) {
+    if (rnn.is_brgemm || !rnn.is_fwd || rnn.is_training
+            || rnn.with_seq_lengths)
+        return false;
+
+    const int nthr = dnnl_get_max_threads();
+    const int max_wavefront_cells
+            = rnn.n_dir * nstl::min(rnn.n_layer, rnn.n_iter);
+    if (nthr == 1 || max_wavefront_cells == 1) return false;
+
+    // A cell gemm keeps about cell_macs / min_macs_per_thr threads busy.
+    // When the widest wavefront has more cells than that, computing the
+    // cells concurrently uses the machine better.
+    const dim_t min_macs_per_thr = 1 << 18;
+    const dim_t cell_macs = (dim_t)rnn.n_gates * rnn.dhc
+            * (rnn.slc + rnn.sic) * rnn.mb;
+    const dim_t cell_nthr = nstl::min<dim_t>(
+            nthr, nstl::max<dim_t>(1, cell_macs / min_macs_per_thr));
+    return max_wavefront_cells > cell_nthr;
+}
+
 void rnn_utils::set_offsets(const rnn_conf_t &rnn, size_t &ws_gates_offset,
         size_t &ws_ht_offset, size_t &ws_states_layer_offset,
         size_t &ws_states_iter_offset, size_t &ws_states_iter_c_offset,
@@ -84,8 +84,8 @@
             const float *w_proj_comp, void **bias_, \
             const src_layer_t *src_layer_, \
             const src_layer_t *augru_attention_, const src_iter_t *src_iter_, \
-            const void *src_iter_c_, dst_layer_t *dst_layer_, \
-            dst_iter_t *dst_iter_, void *dst_iter_c_, \
+            const void *src_iter_c_, const dim_t *seq_active_mb_, \
+            dst_layer_t *dst_layer_, dst_iter_t *dst_iter_, void *dst_iter_c_, \
             src_layer_t *ws_states_layer_, src_iter_t *ws_states_iter_, \
             void *ws_states_iter_c_, gemm_acc_t *ws_diff_states_layer_, \
             gemm_acc_t *ws_diff_states_iter_, \
@@ -132,8 +132,8 @@
             const float *w_proj_comp, void **bias_, \
             const src_layer_t *src_layer_, \
             const src_layer_t *augru_attention_, const src_iter_t *src_iter_, \
-            const void *src_iter_c_, dst_layer_t *dst_layer_, \
-            dst_iter_t *dst_iter_, void *dst_iter_c_, \
+            const void *src_iter_c_, const dim_t *seq_active_mb_, \
+            dst_layer_t *dst_layer_, dst_iter_t *dst_iter_, void *dst_iter_c_, \
             src_layer_t *ws_states_layer_, src_iter_t *ws_states_iter_, \
             void *ws_states_iter_c_, gemm_acc_t *ws_diff_states_layer_, \
             gemm_acc_t *ws_diff_states_iter_, \
@@ -342,6 +342,9 @@ struct rnn_conf_t {
     bool is_fwd = 0, is_training = 0, is_lbr = 0, is_lstm_peephole = 0,
          is_lstm_projection = 0, is_augru = 0, is_orig_gru = 0;
     bool use_workspace = 0;
+    // Each sequence of the minibatch has its own length, the states are kept
+    // in the workspace with the rows sorted by decreasing length.
+    bool with_seq_lengths = 0;
 
     // Size of workspace for each tensor in bytes
     // Notes:
@@ -376,6 +379,15 @@ struct rnn_conf_t {
          force_nocopy = false, use_layer_packed_gemm = false,
          use_iter_packed_gemm = false, use_projection_packed_gemm = false;
     int n_iter_scratch_gates = 0;
+    // The cells with the same layer + iteration index are computed
+    // concurrently, each of them with its own slot in the gates, ht and cell
+    // scratchpads. The threads left over are spread over the minibatch rows of
+    // the cells.
+    bool use_wavefront = false;
+    int n_wavefront_cells = 1;
+    // Set for a single execution when src_iter and dst_iter share the same
+    // buffer and a cell would overwrite the states it reads from.
+    bool force_src_iter_copy = false;
 
     inline bool is_int8_conf() const {
         return is_signed_int8_conf() || is_unsigned_int8_conf();
@@ -425,23 +437,25 @@ struct rnn_conf_t {
     inline bool is_bf32() const { return is_cell_bf16_amx() && is_f32_conf(); }
 
     inline bool skip_src_layer_copy() const {
-        return (exec_dir == l2r) && !is_bf32()
+        return (exec_dir == l2r) && !is_bf32() && !with_seq_lengths
                 && utils::one_of(dt_conf, s8s8s8f32, f32s8f32f32, s8s8s8s8,
                         f32s8f32s8, u8u8u8u8, u8u8u8f32, f32u8f32u8,
                         f32u8f32f32, all_f32, all_bf16);
     }
     inline bool skip_src_iter_copy() const {
         return (exec_dir == l2r) && (src_iter_ld_ > 0) && !is_bf32()
+                && !with_seq_lengths && !force_src_iter_copy
                 && utils::one_of(dt_conf, s8s8s8s8, s8s8s8f32, u8u8u8u8,
                         u8u8u8f32, all_f32, all_bf16);
     }
     inline bool skip_dst_layer_copy() const {
-        return (exec_dir == l2r) && !is_bf32()
+        return (exec_dir == l2r) && !is_bf32() && !with_seq_lengths
                 && utils::one_of(dt_conf, s8s8s8s8, f32s8f32s8, u8u8u8u8,
                         f32u8f32u8, all_f32, all_bf16);
     }
     inline bool skip_dst_iter_copy() const {
         return (exec_dir == l2r) && (dst_iter_ld_ > 0) && !is_bf32()
+                && !with_seq_lengths
                 && utils::one_of(dt_conf, s8s8s8s8, s8s8s8f32, u8u8u8u8,
                         u8u8u8f32, all_f32, all_bf16);
     }
@@ -595,6 +609,14 @@ struct rnn_conf_t {
     brgemm_rnn_execute_loop_order_t loop_order
             = brgemm_rnn_execute_loop_order_t::undefined;
 
+    // Small batch inference: the iterations of a layer are computed in a
+    // single parallel region, every thread keeps the same columns of the
+    // weights in its cache and the cells are separated by barriers.
+    bool brgemm_fwd_persistent = false;
+    // Thread of the persistent region computing the cell, the cell opens its
+    // own parallel region when cell_nthr is 0.
+    int cell_ithr = 0, cell_nthr = 0;
+
     // for merged layer computation in brgemm
     dim_t Mlayermerged;
     dim_t mlayermerged_block, Mlayermerged_blocks;
@@ -610,6 +632,7 @@ bool is_ldio_blocked(const memory_desc_wrapper &md);
 bool is_ldoi_blocked(const memory_desc_wrapper &md);
 
 int get_good_ld(int dim, int sizeof_dt);
+bool use_wavefront_execution(const rnn_conf_t &rnn);
 
 template <typename T>
 bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
@@ -634,6 +657,7 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
             && !memory_desc_wrapper(rd.weights_projection_desc).is_zero();
     rnn.is_augru
             = utils::one_of(rd.cell_kind, dnnl_lbr_augru, dnnl_vanilla_augru);
+    rnn.with_seq_lengths = rd.flags & dnnl_rnn_flags_variable_seq_lengths;
     rnn.bias_dt = bias_d.is_zero() ? data_type::f32 : bias_d.data_type();
     rnn.src_iter_c_dt = src_iter_c_d.is_zero() ? data_type::f32
                                                : src_iter_c_d.data_type();
@@ -800,8 +824,6 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
      * and if to merge gemm across iterations */
     const bool is_f32 = rnn.dt_conf == all_f32,
                is_bf16 = rnn.dt_conf == all_bf16;
-    const bool is_gru = utils::one_of(rd.cell_kind, alg_kind::vanilla_gru,
-            alg_kind::lbr_gru, alg_kind::vanilla_augru, alg_kind::lbr_augru);
     const bool is_inference = !rnn.is_training;
 
     // To be able to merge the GEMM on the layer input when not
@@ -812,15 +834,29 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
             = dst_layer_d.blocking_desc().strides[0]
             == (rnn.dst_layer_ld_ * rnn.mb);
 
-    rnn.merge_gemm_layer = (!rnn.is_brgemm)
+    rnn.use_wavefront = use_wavefront_execution(rnn);
+    rnn.n_wavefront_cells = rnn.use_wavefront
+            ? rnn.n_dir * nstl::min(rnn.n_layer, rnn.n_iter)
+            : 1;
+
+    // With variable sequence lengths the number of rows changes from one
+    // iteration to another, so gemms are always done per cell. The same
+    // holds with wavefront execution as a layer is computed over several
+    // wavefronts.
+    rnn.merge_gemm_layer
+            = (!rnn.is_brgemm && !rnn.with_seq_lengths && !rnn.use_wavefront)
             ? ((rnn.is_fwd && rnn.src_layer_is_trivial_stride)
                       || ((rd.prop_kind == prop_kind::backward)
                               && dst_layer_is_trivial_stride))
                     && (((rnn.is_fwd && rnn.mb < 128) || !rnn.is_fwd)
                             || rnn.is_int8_conf())
             : false;
+    // For GRU only the update and reset gates of the iteration weights are
+    // merged, the candidate gate is computed against r * h_{t-1} which is kept
+    // for a single cell. Linear-before-reset GRU computes all its iteration
+    // weights gradients from a per-cell buffer, so it is not merged.
     rnn.merge_gemm_iter = (!rnn.is_brgemm)
-            ? dst_layer_is_trivial_stride && !(rnn.is_fwd || is_gru)
+            ? dst_layer_is_trivial_stride && !(rnn.is_fwd || rnn.is_lbr)
             : false;
     rnn.force_nocopy = false;
 #if DNNL_X64
@@ -832,21 +868,21 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
     /* Decide to copy bias */
     rnn.copy_bias = rnn.is_int8_conf();
 
-    rnn.use_layer_packed_gemm = !rnn.is_brgemm
+    rnn.use_layer_packed_gemm = !rnn.is_brgemm && !rnn.with_seq_lengths
             ? utils::one_of(weights_layer_d.format_kind(), format_kind::any,
                       format_kind::rnn_packed)
                     && is_inference
                     && ((is_f32 && pack_sgemm_supported() && rnn.n_iter == 1)
                             || rnn.is_int8_conf() || is_bf16)
             : false;
-    rnn.use_iter_packed_gemm = !rnn.is_brgemm
+    rnn.use_iter_packed_gemm = !rnn.is_brgemm && !rnn.with_seq_lengths
             ? utils::one_of(weights_iter_d.format_kind(), format_kind::any,
                       format_kind::rnn_packed)
                     && is_inference
                     && ((is_f32 && pack_sgemm_supported() && rnn.mb >= 16)
                             || rnn.is_int8_conf() || is_bf16)
             : false;
-    rnn.use_projection_packed_gemm = !rnn.is_brgemm
+    rnn.use_projection_packed_gemm = !rnn.is_brgemm && !rnn.with_seq_lengths
             ? utils::one_of(weights_projection_d.format_kind(),
                       format_kind::any, format_kind::rnn_packed)
                     && is_inference
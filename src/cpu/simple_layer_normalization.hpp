@@ -37,7 +37,7 @@ namespace cpu {
 template <data_type_t data_type>
 struct simple_layer_normalization_fwd_t : public primitive_t {
     struct pd_t : public cpu_layer_normalization_fwd_pd_t {
-        pd_t(const layer_normalization_desc_t *adesc,
+        pd_t(const layer_normalization_v2_desc_t *adesc,
                 const primitive_attr_t *attr,
                 const layer_normalization_fwd_pd_t *hint_fwd_pd)
             : cpu_layer_normalization_fwd_pd_t(adesc, attr, hint_fwd_pd) {}
@@ -143,7 +143,7 @@ private:
 template <data_type_t data_type>
 struct simple_layer_normalization_bwd_t : public primitive_t {
     struct pd_t : public cpu_layer_normalization_bwd_pd_t {
-        pd_t(const layer_normalization_desc_t *adesc,
+        pd_t(const layer_normalization_v2_desc_t *adesc,
                 const primitive_attr_t *attr,
                 const layer_normalization_fwd_pd_t *hint_fwd_pd)
             : cpu_layer_normalization_bwd_pd_t(adesc, attr, hint_fwd_pd) {}
@@ -18,6 +18,7 @@
 #include "common/dnnl_thread.hpp"
 
 #include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
 
 #if DNNL_X64
 #include "cpu/x64/jit_uni_layer_normalization_kernels.hpp"
@@ -33,20 +34,25 @@ namespace lnorm_utils {
 using namespace data_type;
 
 template <>
-void stat_and_data_kernel_t<f32>::operator()(const float *src, float *dst,
+void stat_and_data_kernel_t<f32>::operator()(const float *src, void *dst_ptr,
         const float *scale, const float *shift, float *mean, float *var,
+        const void *post_ops_binary_rhs_arg_vec, const void *dst_orig,
         const size_t block_size) const {
+    float *dst = static_cast<float *>(dst_ptr);
+    const bool plain_dst = dst_dt_ == f32 && oscale_ == 1.f && !with_postops_;
     // XXX: manual unrolling for use_scaleshift_ due to clang issue.
     //      see: CLANG_WA_01_SAFE_TO_USE_OMP_SIMD
     for (size_t offset = 0; offset < block_size; offset++) {
         float v_mean, v_variance;
         if (calculate_stats_) {
             v_mean = 0;
-            PRAGMA_OMP_SIMD(reduction(+ : v_mean))
-            for (dim_t c = 0; c < C_; ++c) {
-                v_mean += src[c + C_ * offset];
+            if (!skip_mean_) {
+                PRAGMA_OMP_SIMD(reduction(+ : v_mean))
+                for (dim_t c = 0; c < C_; ++c) {
+                    v_mean += src[c + C_ * offset];
+                }
+                v_mean /= C_;
             }
-            v_mean /= C_;
 
             v_variance = 0;
             PRAGMA_OMP_SIMD(reduction(+ : v_variance))
@@ -56,12 +62,23 @@ void stat_and_data_kernel_t<f32>::operator()(const float *src, float *dst,
             }
             v_variance /= C_;
         } else {
-            v_mean = mean[offset];
+            v_mean = skip_mean_ ? 0.f : mean[offset];
             v_variance = var[offset];
         }
 
         const float inv_sqrtvar = 1. / sqrtf(v_variance + eps_);
-        if (use_scaleshift_ || (use_scale_ && use_shift_)) {
+        if (!plain_dst) {
+            // output scale, post-ops and down-conversion are applied
+            // element-wise by the reference helpers
+            for (dim_t c = 0; c < C_; ++c) {
+                const float sm = (scale ? scale[c] : 1.f) * inv_sqrtvar;
+                const float sv = shift ? shift[c] : 0.f;
+                const size_t elem = c + C_ * offset;
+                float d = (sm * (src[elem] - v_mean) + sv) * oscale_;
+                ref_post_ops_->execute(d);
+                io::store_float_value(dst_dt_, d, dst_ptr, elem);
+            }
+        } else if (use_scaleshift_ || (use_scale_ && use_shift_)) {
             PRAGMA_OMP_SIMD()
             for (dim_t c = 0; c < C_; ++c) {
                 const float sm = scale[c] * inv_sqrtvar;
@@ -106,12 +123,12 @@ void diff_ss_kernel_t<f32>::operator()(const float *src, const float *diff_dst,
         const size_t block_size) const {
     for (size_t offset = 0; offset < block_size; offset++) {
         inv_sqrtvar[offset] = 1. / sqrtf(var[offset] + eps_);
+        const float v_mean = skip_mean_ ? 0.f : mean[offset];
         PRAGMA_OMP_SIMD()
         for (dim_t c = 0; c < C_; c++) {
             const size_t elem = c + C_ * offset;
             const float dd = diff_dst[elem];
-            diff_gamma[c]
-                    += (src[elem] - mean[offset]) * dd * inv_sqrtvar[offset];
+            diff_gamma[c] += (src[elem] - v_mean) * dd * inv_sqrtvar[offset];
             diff_beta[c] += dd;
         }
     }
@@ -128,6 +145,7 @@ void diff_data_kernel_t<f32>::operator()(const float *src,
     for (size_t offset = 0; offset < block_size; offset++) {
         // reduce gamma
         dd_gamma = dd_gamma_x = 0;
+        const float v_mean = skip_mean_ ? 0.f : mean[offset];
         if (calculate_diff_stats_) {
             if (use_scaleshift_ || use_scale_) {
                 PRAGMA_OMP_SIMD(reduction(+ : dd_gamma, dd_gamma_x))
@@ -135,8 +153,7 @@ void diff_data_kernel_t<f32>::operator()(const float *src,
                     const size_t elem = c + C_ * offset;
                     const float v_diff_dst = diff_dst[elem];
                     dd_gamma += v_diff_dst * ss[c];
-                    dd_gamma_x
-                            += v_diff_dst * ss[c] * (src[elem] - mean[offset]);
+                    dd_gamma_x += v_diff_dst * ss[c] * (src[elem] - v_mean);
                 }
             } else {
                 PRAGMA_OMP_SIMD(reduction(+ : dd_gamma, dd_gamma_x))
@@ -144,10 +161,12 @@ void diff_data_kernel_t<f32>::operator()(const float *src,
                     const size_t elem = c + C_ * offset;
                     const float v_diff_dst = diff_dst[elem];
                     dd_gamma += v_diff_dst;
-                    dd_gamma_x += v_diff_dst * (src[elem] - mean[offset]);
+                    dd_gamma_x += v_diff_dst * (src[elem] - v_mean);
                 }
             }
             dd_gamma_x *= inv_sqrtvar[offset];
+            // RMS normalization has no mean term in the derivative
+            if (skip_mean_) dd_gamma = 0;
         }
 
         // calculate diff_dst
@@ -158,7 +177,7 @@ void diff_data_kernel_t<f32>::operator()(const float *src,
                 float v_diff_src = diff_dst[elem] * ss[c];
                 if (calculate_diff_stats_)
                     v_diff_src -= dd_gamma / C_
-                            + (src[elem] - mean[offset]) * dd_gamma_x
+                            + (src[elem] - v_mean) * dd_gamma_x
                                     * inv_sqrtvar[offset] / C_;
                 v_diff_src *= inv_sqrtvar[offset];
                 diff_src[elem] = v_diff_src;
@@ -170,7 +189,7 @@ void diff_data_kernel_t<f32>::operator()(const float *src,
                 float v_diff_src = diff_dst[elem];
                 if (calculate_diff_stats_)
                     v_diff_src -= dd_gamma / C_
-                            + (src[elem] - mean[offset]) * dd_gamma_x
+                            + (src[elem] - v_mean) * dd_gamma_x
                                     * inv_sqrtvar[offset] / C_;
                 v_diff_src *= inv_sqrtvar[offset];
                 diff_src[elem] = v_diff_src;
@@ -190,8 +209,9 @@ void diff_data_kernel_t<bf16>::operator()(const bfloat16_t *src,
 
 template <>
 void stat_and_data_kernel_t<bf16>::operator()(const bfloat16_t *src,
-        bfloat16_t *dst, const float *scale, const float *shift, float *mean,
-        float *var, const size_t block_size) const {
+        void *dst, const float *scale, const float *shift, float *mean,
+        float *var, const void *post_ops_binary_rhs_arg_vec,
+        const void *dst_orig, const size_t block_size) const {
     assert(!"No default stat_and_data_kernel_t operator() for bf16 input!");
 }
 
@@ -205,6 +225,20 @@ void diff_ss_kernel_t<bf16>::operator()(const bfloat16_t *src,
 
 // Interface section
 
+template <data_type_t data_type>
+bool stat_and_data_kernel_t<data_type>::post_ops_ok(
+        const layer_normalization_pd_t *pd) {
+#if DNNL_X64
+    if (x64::lnorm_utils::stat_and_data_kernel_post_ops_ok<data_type>(pd))
+        return true;
+#endif
+    // the default kernel applies post-ops with no extra inputs only
+    const auto &po = pd->attr()->post_ops_;
+    for (int i = 0; i < po.len(); i++)
+        if (!po.entry_[i].is_eltwise()) return false;
+    return true;
+}
+
 template <data_type_t data_type>
 stat_and_data_kernel_t<data_type> *stat_and_data_kernel_t<data_type>::create(
         const layer_normalization_pd_t *pd) {
@@ -17,8 +17,12 @@
 #ifndef CPU_SIMPLE_LAYER_NORMALIZATION_KERNELS_HPP
 #define CPU_SIMPLE_LAYER_NORMALIZATION_KERNELS_HPP
 
+#include <memory>
+
 #include "common/layer_normalization_pd.hpp"
 
+#include "cpu/primitive_attr_postops.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -31,8 +35,13 @@ struct stat_and_data_kernel_t {
             const layer_normalization_pd_t *pd);
     virtual ~stat_and_data_kernel_t() = default;
 
-    virtual void operator()(const data_t *src, data_t *dst, const float *scale,
+    // Returns true if the post-ops requested by pd can be applied by the
+    // kernel returned by create()
+    static bool post_ops_ok(const layer_normalization_pd_t *pd);
+
+    virtual void operator()(const data_t *src, void *dst, const float *scale,
             const float *shift, float *mean, float *var,
+            const void *post_ops_binary_rhs_arg_vec, const void *dst_orig,
             const size_t block_size) const;
 
     virtual status_t create_kernel() { return status::success; }
@@ -45,7 +54,13 @@ protected:
         , use_shift_(pd->use_shift())
         , save_stats_(pd->is_training())
         , calculate_stats_(!pd->stats_are_src())
-        , eps_(pd->desc()->layer_norm_epsilon) {}
+        , skip_mean_(pd->skip_mean())
+        , eps_(pd->desc()->layer_norm_epsilon)
+        , dst_dt_(pd->dst_md()->data_type)
+        , oscale_(pd->attr()->output_scales_.scales_[0])
+        , with_postops_(!pd->attr()->post_ops_.has_default_values())
+        , ref_post_ops_(utils::make_unique<ref_post_ops_t>(
+                  pd->attr()->post_ops_)) {}
 
     int C_;
     bool use_scaleshift_;
@@ -53,7 +68,12 @@ protected:
     bool use_shift_;
     bool save_stats_;
     bool calculate_stats_;
+    bool skip_mean_;
     const float eps_;
+    const data_type_t dst_dt_;
+    const float oscale_;
+    const bool with_postops_;
+    std::unique_ptr<ref_post_ops_t> ref_post_ops_;
 };
 
 template <data_type_t data_type>
@@ -72,10 +92,13 @@ struct diff_ss_kernel_t {
 
 protected:
     diff_ss_kernel_t(const layer_normalization_pd_t *pd)
-        : C_(pd->norm_axis()), eps_(pd->desc()->layer_norm_epsilon) {}
+        : C_(pd->norm_axis())
+        , eps_(pd->desc()->layer_norm_epsilon)
+        , skip_mean_(pd->skip_mean()) {}
 
     int C_;
     const float eps_;
+    bool skip_mean_;
 };
 
 template <data_type_t data_type>
@@ -98,7 +121,8 @@ protected:
         , calculate_diff_stats_(!pd->use_global_stats())
         , use_scaleshift_(pd->use_scaleshift())
         , use_scale_(pd->use_scale())
-        , use_shift_(pd->use_shift()) {}
+        , use_shift_(pd->use_shift())
+        , skip_mean_(pd->skip_mean()) {}
 
     int C_;
     const float eps_;
@@ -106,6 +130,7 @@ protected:
     bool use_scaleshift_;
     bool use_scale_;
     bool use_shift_;
+    bool skip_mean_;
 };
 
 } // namespace lnorm_utils
@@ -0,0 +1,97 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_TOPK_UTILS_HPP
+#define CPU_TOPK_UTILS_HPP
+
+#include <algorithm>
+#include <cmath>
+
+#include "common/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace topk_utils {
+
+// An element of the axis along with its position.
+struct entry_t {
+    float value;
+    int32_t index;
+};
+
+// Returns true when @p a precedes @p b in the output: the larger (smaller for
+// topk_min) value goes first, NaNs go after all the numbers, and the smaller
+// index goes first among equal values.
+static inline bool precedes(const entry_t &a, const entry_t &b, bool is_max) {
+    const bool a_nan = std::isnan(a.value), b_nan = std::isnan(b.value);
+    if (a_nan || b_nan) return a_nan == b_nan ? a.index < b.index : b_nan;
+    if (a.value != b.value)
+        return is_max ? a.value > b.value : a.value < b.value;
+    return a.index < b.index;
+}
+
+// The k best entries seen so far are kept in a heap with the worst of them at
+// the top.
+struct heap_t {
+    heap_t(entry_t *data, dim_t k, bool is_max)
+        : data_(data), k_(k), size_(0), cmp_(is_max) {}
+
+    bool is_full() const { return size_ == k_; }
+    const entry_t &worst() const { return data_[0]; }
+
+    // Entries are expected in the increasing order of their indices, so an
+    // entry equal to the worst one never replaces it.
+    void insert(const entry_t &e) {
+        if (!is_full()) {
+            data_[size_++] = e;
+            std::push_heap(data_, data_ + size_, cmp_);
+        } else if (cmp_(e, data_[0])) {
+            std::pop_heap(data_, data_ + size_, cmp_);
+            data_[size_ - 1] = e;
+            std::push_heap(data_, data_ + size_, cmp_);
+        }
+    }
+
+    // Orders the entries from the best to the worst. The heap is not usable
+    // afterwards.
+    void sort() { std::sort_heap(data_, data_ + size_, cmp_); }
+
+    dim_t size() const { return size_; }
+
+private:
+    struct cmp_t {
+        cmp_t(bool is_max) : is_max(is_max) {}
+        bool operator()(const entry_t &a, const entry_t &b) const {
+            return precedes(a, b, is_max);
+        }
+        bool is_max;
+    };
+
+    entry_t *data_;
+    dim_t k_;
+    dim_t size_;
+    cmp_t cmp_;
+};
+
+} // namespace topk_utils
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
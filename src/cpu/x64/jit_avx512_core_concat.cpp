@@ -0,0 +1,607 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_avx512_core_concat.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+using namespace dnnl::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_concat_call_s, field)
+
+jit_avx512_core_concat_kernel_t::jit_avx512_core_concat_kernel_t(
+        const jit_concat_conf_t &conf, data_type_t src_dt)
+    : jit_generator(jit_name())
+    , conf_(conf)
+    , src_dt_(src_dt)
+    , src_dt_size_(types::data_type_size(src_dt))
+    , dst_dt_size_(types::data_type_size(conf.dst_dt))
+    // The tail mask is computed at runtime in prepare_tail_mask(), the tail
+    // size passed to the helpers is never used on avx512.
+    , io_load_(this, conf.isa, src_dt, {false},
+              io::io_tail_conf_t {simd_w_, 1, k_tail_mask_, 0, reg_tmp_},
+              io::io_emu_bf16_conf_t {vmm_bf16_emu_1_, vmm_bf16_emu_2_,
+                      vmm_bf16_emu_3_, reg_tmp_, vmm_bf16_emu_4_},
+              io::io_saturation_conf_t {vmm_zero_saturation_.getIdx(),
+                      vmm_saturation_ubound_.getIdx(), reg_tmp_})
+    , io_store_(this, conf.isa, conf.dst_dt, {false},
+              io::io_tail_conf_t {simd_w_, 1, k_tail_mask_, 0, reg_tmp_},
+              io::io_emu_bf16_conf_t {vmm_bf16_emu_1_, vmm_bf16_emu_2_,
+                      vmm_bf16_emu_3_, reg_tmp_, vmm_bf16_emu_4_},
+              io::io_saturation_conf_t {vmm_zero_saturation_.getIdx(),
+                      vmm_saturation_ubound_.getIdx(), reg_tmp_}) {}
+
+void jit_avx512_core_concat_kernel_t::load_params() {
+    mov(reg_src_row_, ptr[reg_param_ + GET_OFF(src)]);
+    mov(reg_dst_row_, ptr[reg_param_ + GET_OFF(dst)]);
+    mov(reg_nelems_, ptr[reg_param_ + GET_OFF(nelems)]);
+    mov(reg_rows_, ptr[reg_param_ + GET_OFF(nrows)]);
+    mov(reg_src_stride_, ptr[reg_param_ + GET_OFF(src_row_stride)]);
+    mov(reg_dst_stride_, ptr[reg_param_ + GET_OFF(dst_row_stride)]);
+
+    // A plain copy works on bytes.
+    if (is_copy() && src_dt_size_ > 1)
+        shl(reg_nelems_, math::ilog2q(src_dt_size_));
+
+    if (conf_.with_scales) {
+        mov(reg_tmp_, ptr[reg_param_ + GET_OFF(scale)]);
+        vbroadcastss(vmm_scale_, ptr[reg_tmp_]);
+    }
+}
+
+void jit_avx512_core_concat_kernel_t::prepare_tail_mask() {
+    // The remaining work is less than a vector, so the shift never
+    // overflows.
+    mov(reg_tmp_, 1);
+    shlx(reg_tmp_, reg_tmp_, reg_work_);
+    sub(reg_tmp_, 1);
+    if (is_copy())
+        kmovq(k_tail_mask_, reg_tmp_);
+    else
+        kmovw(k_tail_mask_, reg_tmp_.cvt32());
+}
+
+void jit_avx512_core_concat_kernel_t::copy_block(int unroll, bool tail) {
+    const int vlen = cpu_isa_traits<avx512_core>::vlen;
+    for (int u = 0; u < unroll; u++) {
+        const auto src_addr = ptr[reg_src_ + u * vlen];
+        if (tail)
+            vmovdqu8(Vmm(u) | k_tail_mask_ | T_z, src_addr);
+        else
+            vmovdqu8(Vmm(u), src_addr);
+    }
+    for (int u = 0; u < unroll; u++) {
+        const auto dst_addr = ptr[reg_dst_ + u * vlen];
+        if (tail)
+            vmovdqu8(dst_addr | k_tail_mask_, Vmm(u));
+        else
+            vmovdqu8(dst_addr, Vmm(u));
+    }
+}
+
+void jit_avx512_core_concat_kernel_t::convert_block(int unroll, bool tail) {
+    for (int u = 0; u < unroll; u++) {
+        io_load_.load(ptr[reg_src_ + u * simd_w_ * src_dt_size_], Vmm(u), tail);
+        if (conf_.with_scales) vmulps(Vmm(u), Vmm(u), vmm_scale_);
+    }
+    for (int u = 0; u < unroll; u++)
+        io_store_.store(
+                Vmm(u), ptr[reg_dst_ + u * simd_w_ * dst_dt_size_], tail);
+}
+
+void jit_avx512_core_concat_kernel_t::process_row() {
+    const int vlen = cpu_isa_traits<avx512_core>::vlen;
+    const int step = is_copy() ? vlen : simd_w_;
+    const int src_step = is_copy() ? vlen : simd_w_ * src_dt_size_;
+    const int dst_step = is_copy() ? vlen : simd_w_ * dst_dt_size_;
+
+    auto process = [&](int unroll, bool tail) {
+        if (is_copy())
+            copy_block(unroll, tail);
+        else
+            convert_block(unroll, tail);
+    };
+
+    Label unroll_loop, single_loop, tail, end;
+
+    mov(reg_src_, reg_src_row_);
+    mov(reg_dst_, reg_dst_row_);
+    mov(reg_work_, reg_nelems_);
+
+    L(unroll_loop);
+    {
+        cmp(reg_work_, unroll_ * step);
+        jl(single_loop, T_NEAR);
+        process(unroll_, false);
+        add(reg_src_, unroll_ * src_step);
+        add(reg_dst_, unroll_ * dst_step);
+        sub(reg_work_, unroll_ * step);
+        jmp(unroll_loop, T_NEAR);
+    }
+
+    L(single_loop);
+    {
+        cmp(reg_work_, step);
+        jl(tail, T_NEAR);
+        process(1, false);
+        add(reg_src_, src_step);
+        add(reg_dst_, dst_step);
+        sub(reg_work_, step);
+        jmp(single_loop, T_NEAR);
+    }
+
+    L(tail);
+    {
+        test(reg_work_, reg_work_);
+        jz(end, T_NEAR);
+        prepare_tail_mask();
+        process(1, true);
+    }
+
+    L(end);
+}
+
+void jit_avx512_core_concat_kernel_t::generate() {
+    preamble();
+
+    if (!is_copy()) {
+        io_store_.init_bf16();
+        if (one_of(conf_.dst_dt, data_type::s8, data_type::u8, data_type::s32))
+            io_store_.init_saturate_f32();
+    }
+
+    load_params();
+
+    Label row_loop, end;
+    test(reg_rows_, reg_rows_);
+    jz(end, T_NEAR);
+    test(reg_nelems_, reg_nelems_);
+    jz(end, T_NEAR);
+
+    L(row_loop);
+    {
+        process_row();
+        add(reg_src_row_, reg_src_stride_);
+        add(reg_dst_row_, reg_dst_stride_);
+        dec(reg_rows_);
+        jnz(row_loop, T_NEAR);
+    }
+
+    L(end);
+    postamble();
+}
+
+#undef GET_OFF
+
+namespace {
+// Number of elements a work item processes, when the shape allows for it.
+constexpr dim_t work_item_size = 4096;
+
+bool is_supported_dt(data_type_t dt) {
+    using namespace data_type;
+    return one_of(dt, f32, bf16, s32, s8, u8);
+}
+} // namespace
+
+status_t jit_avx512_core_concat_t::pd_t::init(engine_t *engine) {
+    using sm = primitive_attr_t::skip_mask_t;
+
+    const bool ok = mayiuse(avx512_core)
+            && attr()->has_default_values(sm::scales)
+            && is_supported_dt(dst_md_.data_type);
+    if (!ok) return status::unimplemented;
+
+    for (int i = 0; i < n_inputs(); ++i)
+        if (!is_supported_dt(src_mds_[i].data_type))
+            return status::unimplemented;
+
+    conf_.isa = mayiuse(avx512_core_bf16) ? avx512_core_bf16 : avx512_core;
+    conf_.dst_dt = dst_md_.data_type;
+    CHECK(init_scales());
+
+    init_blocked_dst();
+    const bool is_plain = cpu_concat_pd_t::init() == status::success
+            && init_plain();
+    if (!is_plain && !init_blocked_scatter()) return status::unimplemented;
+
+    return status::success;
+}
+
+status_t jit_avx512_core_concat_t::pd_t::init_scales() {
+    const auto &sc = attr()->scales_;
+    conf_.with_scales = !sc.has_default_values();
+    scales_.resize(n_inputs(), 1.f);
+    for (int i = 0; i < n_inputs(); ++i) {
+        const auto &s = sc.get(DNNL_ARG_MULTIPLE_SRC + i);
+        if (s.mask_ != 0 || !s.defined()) return status::unimplemented;
+        scales_[i] = s.scales_[0];
+    }
+    return status::success;
+}
+
+// The default destination chosen by concat_pd_t falls back to a plain layout
+// when the inputs cannot be described as sub-memories of a blocked one. Keep
+// the blocked layout of the inputs instead, when they are blocked only over
+// the concat dimension, as the blocked scatter handles this case.
+void jit_avx512_core_concat_t::pd_t::init_blocked_dst() {
+    if (dst_md_.format_kind != format_kind::any) return;
+
+    const memory_desc_wrapper src0_d(src_mds_[0]);
+    if (!src0_d.is_blocking_desc() || src0_d.is_plain()) return;
+
+    const auto &bd = src0_d.blocking_desc();
+    if (bd.inner_nblks != 1 || bd.inner_idxs[0] != concat_dim()) return;
+
+    const bool ignore_strides = true;
+    for (int i = 1; i < n_inputs(); ++i) {
+        const memory_desc_wrapper i_d(src_mds_[i]);
+        if (!i_d.is_blocking_desc()
+                || !types::blocking_desc_is_equal(
+                        src_mds_[i], src_mds_[0], ignore_strides))
+            return;
+    }
+
+    memory_desc_t md = dst_md_;
+    if (memory_desc_init_by_blocking_desc(md, bd) == status::success)
+        dst_md_ = md;
+}
+
+bool jit_avx512_core_concat_t::pd_t::init_plain() {
+    const memory_desc_wrapper dst_d(dst_md());
+    if (!dst_d.is_blocking_desc()) return false;
+
+    const bool ignore_strides = true;
+    for (int i = 0; i < n_inputs(); ++i) {
+        const memory_desc_wrapper i_d(src_md(i));
+        const memory_desc_wrapper o_d(src_image_md(i));
+        const bool ok = i_d.is_blocking_desc() && o_d.is_blocking_desc()
+                && types::blocking_desc_is_equal(
+                        *i_d.md_, *o_d.md_, ignore_strides)
+                && types::blocking_desc_is_equal(
+                        *i_d.md_, *dst_d.md_, ignore_strides)
+                && !i_d.is_additional_buffer();
+        if (!ok) return false;
+    }
+
+    const int ndims = dst_d.ndims();
+    dims_t blocks;
+    dst_d.compute_blocks(blocks);
+
+    // Physical order of the dimensions of the destination.
+    strides_t strides;
+    dims_t outer_blocks;
+    int iperm[DNNL_MAX_NDIMS];
+    for (int d = 0; d < ndims; d++) {
+        strides[d] = dst_d.blocking_desc().strides[d];
+        outer_blocks[d] = dst_d.padded_dims()[d] / blocks[d];
+        iperm[d] = d;
+    }
+    simultaneous_sort(strides, outer_blocks, iperm, ndims,
+            [](stride_t a, stride_t b) { return b - a; });
+
+    int start = 0;
+    while (iperm[start] != concat_dim())
+        start++;
+
+    auto nelems_to_concat = [&](const memory_desc_wrapper &mdw) {
+        dim_t nelems = 1;
+        for (int p = start; p < ndims; p++)
+            nelems *= mdw.padded_dims()[iperm[p]] / blocks[iperm[p]];
+        for (int d = 0; d < ndims; d++)
+            nelems *= blocks[d];
+        return nelems;
+    };
+
+    // The part starting from the concat dimension must be dense and laid out
+    // in the same way in all the inputs.
+    const int c = concat_dim();
+    if (nelems_to_concat(dst_d) != dst_d.padded_dims()[c] / blocks[c]
+                    * dst_d.blocking_desc().strides[c])
+        return false;
+
+    nelems_.resize(n_inputs());
+    for (int i = 0; i < n_inputs(); ++i) {
+        const memory_desc_wrapper i_d(src_md(i));
+        for (int p = start; p < ndims; p++) {
+            const int d = iperm[p];
+            if (dst_d.blocking_desc().strides[d]
+                    != i_d.blocking_desc().strides[d])
+                return false;
+        }
+        nelems_[i] = nelems_to_concat(i_d);
+    }
+
+    conf_.is_blocked_scatter = false;
+    conf_.outer_ndims = nstl::max(start - 1, 0);
+    conf_.outer_size = 1;
+    for (int p = 0; p < conf_.outer_ndims; p++) {
+        conf_.outer_dims[p] = iperm[p];
+        conf_.outer_size *= dst_d.padded_dims()[iperm[p]] / blocks[iperm[p]];
+    }
+    conf_.row_dim = start > 0 ? iperm[start - 1] : -1;
+    conf_.nrows = start > 0
+            ? dst_d.padded_dims()[conf_.row_dim] / blocks[conf_.row_dim]
+            : 1;
+
+    return true;
+}
+
+bool jit_avx512_core_concat_t::pd_t::init_blocked_scatter() {
+    const memory_desc_wrapper dst_d(dst_md());
+    if (!dst_d.is_blocking_desc() || dst_d.has_runtime_dims_or_strides())
+        return false;
+
+    const int ndims = dst_d.ndims();
+    const int c = concat_dim();
+    const auto &dst_bd = dst_d.blocking_desc();
+    if (dst_bd.inner_nblks != 1 || dst_bd.inner_idxs[0] != c) return false;
+    const dim_t blk = dst_bd.inner_blks[0];
+
+    // Non-trivial dimensions other than the concat one, ordered by their
+    // strides in the destination, the largest first.
+    int dims_order[DNNL_MAX_NDIMS];
+    int nd = 0;
+    for (int d = 0; d < ndims; d++)
+        if (d != c && dst_d.dims()[d] > 1) dims_order[nd++] = d;
+    for (int i = 1; i < nd; i++)
+        for (int j = i; j > 0
+                && dst_bd.strides[dims_order[j]]
+                        > dst_bd.strides[dims_order[j - 1]];
+                j--)
+            nstl::swap(dims_order[j], dims_order[j - 1]);
+
+    int n_outer = 0;
+    while (n_outer < nd
+            && dst_bd.strides[dims_order[n_outer]] > dst_bd.strides[c])
+        n_outer++;
+
+    // Every tensor has the layout of the destination with the dimensions
+    // inside a block of channels being dense.
+    const bool ignore_strides = true;
+    auto is_compatible = [&](const memory_desc_t &md) {
+        const memory_desc_wrapper mdw(md);
+        if (!mdw.is_blocking_desc() || mdw.has_runtime_dims_or_strides()
+                || mdw.is_additional_buffer()
+                || !types::blocking_desc_is_equal(
+                        md, *dst_d.md_, ignore_strides))
+            return false;
+        for (int d = 0; d < ndims; d++)
+            if (mdw.padded_offsets()[d] != 0) return false;
+        if (mdw.padded_dims()[c] != rnd_up(mdw.dims()[c], blk)) return false;
+
+        const auto &strides = mdw.blocking_desc().strides;
+        // The strides are equal if there is a single block of channels.
+        for (int k = 0; k < n_outer; k++)
+            if (strides[dims_order[k]] < strides[c]) return false;
+        dim_t expected_stride = blk;
+        for (int k = nd - 1; k >= n_outer; k--) {
+            if (strides[dims_order[k]] != expected_stride) return false;
+            expected_stride *= mdw.dims()[dims_order[k]];
+        }
+        return strides[c] >= expected_stride;
+    };
+
+    if (!is_compatible(dst_md_)) return false;
+    nelems_.resize(n_inputs());
+    for (int i = 0; i < n_inputs(); ++i) {
+        if (!is_compatible(src_mds_[i])) return false;
+        nelems_[i] = src_mds_[i].dims[c];
+    }
+
+    conf_.is_blocked_scatter = true;
+    conf_.blk = blk;
+    conf_.outer_ndims = n_outer;
+    conf_.outer_size = 1;
+    for (int k = 0; k < n_outer; k++) {
+        conf_.outer_dims[k] = dims_order[k];
+        conf_.outer_size *= dst_d.dims()[dims_order[k]];
+    }
+    conf_.row_dim = -1;
+    conf_.nrows = 1;
+    for (int k = n_outer; k < nd; k++)
+        conf_.nrows *= dst_d.dims()[dims_order[k]];
+
+    return true;
+}
+
+status_t jit_avx512_core_concat_t::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(kernel_,
+            new kernel_t(pd()->conf_, pd()->src_md(0)->data_type)));
+    return kernel_->create_kernel();
+}
+
+status_t jit_avx512_core_concat_t::execute(const exec_ctx_t &ctx) const {
+    auto dst = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DST);
+    if (dst == nullptr) return status::success;
+
+    const auto &conf = pd()->conf_;
+    const int n = pd()->n_inputs();
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const size_t dst_dt_size = dst_d.data_type_size();
+    const auto &dst_strides = dst_d.blocking_desc().strides;
+    const int c = pd()->concat_dim();
+    const dim_t blk = conf.blk;
+
+    dims_t outer_sizes;
+    if (conf.is_blocked_scatter) {
+        for (int k = 0; k < conf.outer_ndims; k++)
+            outer_sizes[k] = dst_d.dims()[conf.outer_dims[k]];
+    } else {
+        dims_t blocks;
+        dst_d.compute_blocks(blocks);
+        for (int k = 0; k < conf.outer_ndims; k++) {
+            const int d = conf.outer_dims[k];
+            outer_sizes[k] = dst_d.padded_dims()[d] / blocks[d];
+        }
+    }
+
+    // Base pointers and the split of every input into work items.
+    std::vector<const uint8_t *> srcs(n);
+    std::vector<uint8_t *> dsts(n);
+    std::vector<dim_t> rows_per_item(n), elems_per_item(n), items(n);
+    std::vector<dim_t> c_offsets(n);
+    dim_t max_items = 0;
+    int last_input = -1;
+    dim_t c_offset = 0;
+    for (int i = 0; i < n; ++i) {
+        const memory_desc_wrapper i_d(pd()->src_md(i));
+        const auto src = CTX_IN_MEM(const uint8_t *, DNNL_ARG_MULTIPLE_SRC + i);
+        const dim_t nelems = pd()->nelems_[i];
+        c_offsets[i] = c_offset;
+        c_offset += i_d.dims()[c];
+
+        items[i] = 0;
+        if (src == nullptr || nelems == 0) {
+            srcs[i] = nullptr;
+            continue;
+        }
+        last_input = i;
+
+        if (conf.is_blocked_scatter) {
+            srcs[i] = src + i_d.offset0() * i_d.data_type_size();
+            dsts[i] = dst + dst_d.offset0() * dst_dt_size;
+            rows_per_item[i]
+                    = nstl::min(conf.nrows, div_up(work_item_size, blk));
+            elems_per_item[i] = blk;
+            items[i] = div_up(nelems, blk)
+                    * div_up(conf.nrows, rows_per_item[i]);
+        } else {
+            const memory_desc_wrapper o_d(pd()->src_image_md(i));
+            srcs[i] = src + i_d.blk_off(0) * i_d.data_type_size();
+            dsts[i] = dst + o_d.blk_off(0) * dst_dt_size;
+            if (nelems >= work_item_size) {
+                rows_per_item[i] = 1;
+                elems_per_item[i] = work_item_size;
+            } else {
+                rows_per_item[i] = nstl::min(
+                        conf.nrows, div_up(work_item_size, nelems));
+                elems_per_item[i] = nelems;
+            }
+            items[i] = div_up(conf.nrows, rows_per_item[i])
+                    * div_up(nelems, elems_per_item[i]);
+        }
+        max_items = nstl::max(max_items, items[i]);
+    }
+
+    parallel_nd(conf.outer_size, n, max_items, [&](dim_t o, dim_t i, dim_t it) {
+        if (it >= items[i]) return;
+
+        const memory_desc_wrapper i_d(pd()->src_md(i));
+        const size_t src_dt_size = i_d.data_type_size();
+        const auto &src_strides = i_d.blocking_desc().strides;
+        const auto &kernel = *kernel_;
+
+        dim_t src_off = 0, dst_off = 0;
+        for (int k = conf.outer_ndims - 1; k >= 0; k--) {
+            const int d = conf.outer_dims[k];
+            const dim_t idx = o % outer_sizes[k];
+            o /= outer_sizes[k];
+            src_off += idx * src_strides[d];
+            dst_off += idx * dst_strides[d];
+        }
+
+        jit_concat_call_s p;
+        p.scale = &pd()->scales_[i];
+
+        if (!conf.is_blocked_scatter) {
+            const dim_t nelems = pd()->nelems_[i];
+            const dim_t n_elem_chunks = div_up(nelems, elems_per_item[i]);
+            const dim_t r0 = (it / n_elem_chunks) * rows_per_item[i];
+            const dim_t e0 = (it % n_elem_chunks) * elems_per_item[i];
+            const dim_t src_row_stride
+                    = conf.row_dim >= 0 ? src_strides[conf.row_dim] : 0;
+            const dim_t dst_row_stride
+                    = conf.row_dim >= 0 ? dst_strides[conf.row_dim] : 0;
+
+            src_off += r0 * src_row_stride + e0;
+            dst_off += r0 * dst_row_stride + e0;
+            p.src = srcs[i] + src_off * src_dt_size;
+            p.dst = dsts[i] + dst_off * dst_dt_size;
+            p.nelems = nstl::min(elems_per_item[i], nelems - e0);
+            p.nrows = nstl::min(rows_per_item[i], conf.nrows - r0);
+            p.src_row_stride = src_row_stride * src_dt_size;
+            p.dst_row_stride = dst_row_stride * dst_dt_size;
+            kernel(&p);
+            return;
+        }
+
+        // A block of channels of the input lands at channel pos of a block of
+        // the destination and spills over into the next one if it does not
+        // fit there.
+        const dim_t nchannels = pd()->nelems_[i];
+        const dim_t n_row_chunks = div_up(conf.nrows, rows_per_item[i]);
+        const dim_t cb = it / n_row_chunks;
+        const dim_t r0 = (it % n_row_chunks) * rows_per_item[i];
+        const dim_t len = nstl::min(blk, nchannels - cb * blk);
+        const dim_t dst_c = c_offsets[i] + cb * blk;
+        const dim_t pos = dst_c % blk;
+        const dim_t len_head = nstl::min(len, blk - pos);
+
+        const uint8_t *src = srcs[i]
+                + (src_off + cb * src_strides[c] + r0 * blk) * src_dt_size;
+        uint8_t *dst_blk = dsts[i]
+                + (dst_off + (dst_c / blk) * dst_strides[c] + r0 * blk)
+                        * dst_dt_size;
+
+        p.nrows = nstl::min(rows_per_item[i], conf.nrows - r0);
+        p.src_row_stride = blk * src_dt_size;
+        p.dst_row_stride = blk * dst_dt_size;
+
+        p.src = src;
+        p.dst = dst_blk + pos * dst_dt_size;
+        p.nelems = len_head;
+        kernel(&p);
+
+        if (len > len_head) {
+            p.src = src + len_head * src_dt_size;
+            p.dst = dst_blk + dst_strides[c] * dst_dt_size;
+            p.nelems = len - len_head;
+            kernel(&p);
+        }
+
+        // The last block of the destination has to be padded with zeroes.
+        const dim_t c_tail = c_offset % blk;
+        if (i == last_input && cb == div_up(nchannels, blk) - 1 && c_tail) {
+            uint8_t *dst_last = dst_blk
+                    + (len > len_head ? dst_strides[c] * dst_dt_size : 0);
+            for (size_t r = 0; r < p.nrows; r++)
+                std::memset(dst_last + (r * blk + c_tail) * dst_dt_size, 0,
+                        (blk - c_tail) * dst_dt_size);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
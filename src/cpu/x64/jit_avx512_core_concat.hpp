@@ -0,0 +1,181 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_AVX512_CORE_CONCAT_HPP
+#define CPU_X64_JIT_AVX512_CORE_CONCAT_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_concat_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_concat_conf_t {
+    cpu_isa_t isa = isa_any;
+    data_type_t dst_dt = data_type::undef;
+    bool with_scales = false;
+
+    // Only the concat dimension is blocked and some inputs do not start at a
+    // block boundary of the destination, so a block of an input is scattered
+    // over two blocks of the destination.
+    bool is_blocked_scatter = false;
+    dim_t blk = 1;
+
+    // Dimensions iterated over outside of the kernel, in the physical order
+    // of the destination.
+    int outer_ndims = 0;
+    int outer_dims[DNNL_MAX_NDIMS] = {};
+    dim_t outer_size = 1;
+    // The kernel processes the contiguous part of an input row by row. The
+    // rows are either the innermost outer dimension of a plain concat,
+    // row_dim, or the dimensions inside a block of the concat dimension for
+    // the blocked scatter, which are dense with a row stride of blk.
+    int row_dim = -1;
+    dim_t nrows = 1;
+};
+
+struct jit_concat_call_s {
+    const void *src = nullptr;
+    void *dst = nullptr;
+    const float *scale = nullptr;
+    size_t nelems = 0;
+    size_t nrows = 0;
+    // Distances between consecutive rows, in bytes.
+    size_t src_row_stride = 0;
+    size_t dst_row_stride = 0;
+};
+
+// Copies nrows rows of nelems contiguous elements converting them from
+// src_dt, which is common for all the inputs, to the destination data type.
+// The elements are scaled and saturated on the way if needed, otherwise, when
+// both data types match, the rows are copied as is.
+struct jit_avx512_core_concat_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_concat_kernel_t)
+
+    jit_avx512_core_concat_kernel_t(
+            const jit_concat_conf_t &conf, data_type_t src_dt);
+
+    void operator()(const jit_concat_call_s *p) const {
+        jit_generator::operator()(p);
+    }
+
+private:
+    using Vmm = Xbyak::Zmm;
+    using reg64_t = const Xbyak::Reg64;
+
+    static constexpr int simd_w_ = 16;
+    static constexpr int unroll_ = 4;
+
+    bool is_copy() const {
+        return src_dt_ == conf_.dst_dt && !conf_.with_scales;
+    }
+
+    void load_params();
+    void copy_block(int unroll, bool tail);
+    void convert_block(int unroll, bool tail);
+    void process_row();
+    void prepare_tail_mask();
+
+    void generate() override;
+
+    const jit_concat_conf_t conf_;
+    const data_type_t src_dt_;
+    const size_t src_dt_size_;
+    const size_t dst_dt_size_;
+
+    reg64_t reg_param_ = abi_param1;
+    reg64_t reg_src_ = r8;
+    reg64_t reg_dst_ = r9;
+    reg64_t reg_work_ = r10;
+    reg64_t reg_rows_ = r11;
+    reg64_t reg_src_row_ = r12;
+    reg64_t reg_dst_row_ = r13;
+    reg64_t reg_nelems_ = r14;
+    reg64_t reg_src_stride_ = r15;
+    reg64_t reg_dst_stride_ = rbx;
+    reg64_t reg_tmp_ = rax;
+
+    const Xbyak::Opmask k_tail_mask_ = k1;
+
+    const Vmm vmm_scale_ = Vmm(4);
+    const Vmm vmm_zero_saturation_ = Vmm(5);
+    const Vmm vmm_saturation_ubound_ = Vmm(6);
+    const Vmm vmm_bf16_emu_1_ = Vmm(28);
+    const Vmm vmm_bf16_emu_2_ = Vmm(29);
+    const Vmm vmm_bf16_emu_3_ = Vmm(30);
+    const Vmm vmm_bf16_emu_4_ = Vmm(31);
+
+    io::jit_io_helper_t<Vmm> io_load_;
+    io::jit_io_helper_t<Vmm> io_store_;
+};
+
+// Concatenation with data type conversion and per-input common scales. All
+// the inputs are processed in a single parallel region, each work item being
+// a few rows of one input.
+struct jit_avx512_core_concat_t : public primitive_t {
+    struct pd_t : public cpu_concat_pd_t {
+        using cpu_concat_pd_t::cpu_concat_pd_t;
+
+        DECLARE_CONCAT_PD_T(JIT_IMPL_NAME_HELPER("jit:", conf_.isa, ""),
+                jit_avx512_core_concat_t);
+
+        status_t init(engine_t *engine);
+
+        jit_concat_conf_t conf_;
+        std::vector<float> scales_;
+        // Size of the contiguous part of each input, or the number of its
+        // channels for the blocked scatter.
+        std::vector<dim_t> nelems_;
+
+    private:
+        status_t init_scales();
+        void init_blocked_dst();
+        bool init_plain();
+        bool init_blocked_scatter();
+    };
+
+    jit_avx512_core_concat_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    using kernel_t = jit_avx512_core_concat_kernel_t;
+
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<kernel_t> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -24,6 +24,7 @@
 #include "cpu/platform.hpp"
 
 #include "cpu/x64/jit_avx512_core_f32_wino_conv_2x3.hpp"
+#include "cpu/x64/jit_conv_cost_model.hpp"
 #include "cpu/x64/jit_generator.hpp"
 #include "cpu/x64/jit_primitive_conf.hpp"
 
@@ -539,8 +540,11 @@ void jit_avx512_core_f32_wino_conv_2x3_fwd_ker_t::generate() {
 }
 
 namespace {
-bool is_winograd_faster_than_direct(const jit_conv_conf_2x3_wino_t &jcp) {
-    return jcp.mb >= 4;
+bool is_winograd_fastest(const jit_conv_conf_2x3_wino_t &jcp) {
+    // Weights come transformed in the wino format set in expect_wei_md.
+    const conv_cost_model::problem_t prb(jcp, data_type::f32, false);
+    return conv_cost_model::is_winograd_fastest(
+            prb, jcp.m, avx512_core, jcp.nthr);
 }
 } // namespace
 
@@ -611,7 +615,7 @@ status_t jit_avx512_core_f32_wino_conv_2x3_fwd_ker_t ::init_conf(
     if (!(mayiuse(avx512_core))) return status::unimplemented;
 
     if (!IMPLICATION(cd.alg_kind == alg_kind::convolution_auto,
-                is_winograd_faster_than_direct(jcp)))
+                is_winograd_fastest(jcp)))
         return status::unimplemented;
 
     if (src_d.data_type() != data_type::f32) return status::unimplemented;
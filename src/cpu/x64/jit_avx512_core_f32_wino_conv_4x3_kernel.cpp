@@ -25,6 +25,7 @@
 #include "cpu/platform.hpp"
 
 #include "cpu/x64/jit_avx512_core_f32_wino_conv_4x3_kernel.hpp"
+#include "cpu/x64/jit_conv_cost_model.hpp"
 
 #define GET_OFF(field) offsetof(jit_wino_transform_call_s, field)
 
@@ -62,36 +63,11 @@ int get_divisor_satisfying_cond(jit_conv_winograd_conf_t &jcp, int number,
 }
 
 namespace {
-bool is_winograd_faster_than_direct(const jit_conv_winograd_conf_t &jcp) {
-    /* Determines if current winograd implementation is faster than direct.
-       Following conditions are empirical and based on performance data */
-    unsigned int ncores_per_socket
-            = cpu().getNumCores(Xbyak::util::IntelCpuTopologyLevel::CoreLevel);
-    unsigned int nthreads = dnnl_get_max_threads();
-
-    if (jcp.prop_kind == prop_kind::forward_inference) {
-        return jcp.mb >= 4;
-    } else if (nthreads > ncores_per_socket) {
-        double src_dst_transforms_per_core = alpha * alpha * (jcp.ic + jcp.oc)
-                * jcp.mb * ((jcp.oh + tile_size - 1) / tile_size)
-                * ((jcp.ow + tile_size - 1) / tile_size) * sizeof(float) / 1024.
-                / 1024. / nthreads;
-        double wei_transform = alpha * alpha * jcp.ic * jcp.oc * sizeof(float)
-                / 1024. / 1024.;
-
-        if (jcp.prop_kind == prop_kind::backward_weights) {
-            if (src_dst_transforms_per_core < 0.3
-                    || (src_dst_transforms_per_core <= 28 && wei_transform < 4))
-                return false;
-            else
-                return true;
-        } else {
-            if (src_dst_transforms_per_core < 2.0 || wei_transform < 0.02)
-                return false;
-        }
-    }
-
-    return jcp.mb > 8;
+bool is_winograd_fastest(const jit_conv_winograd_conf_t &jcp) {
+    const conv_cost_model::problem_t prb(jcp, data_type::f32,
+            jcp.prop_kind != prop_kind::forward_inference);
+    return conv_cost_model::is_winograd_fastest(
+            prb, tile_size, avx512_core, jcp.nthr);
 }
 } // namespace
 
@@ -1152,7 +1128,7 @@ status_t _jit_avx512_core_f32_wino_conv_4x3_data_kernel::init_conf_common(
 
     // Checking conditions not supported by these kernels
     if (!IMPLICATION(cd.alg_kind == alg_kind::convolution_auto,
-                is_winograd_faster_than_direct(jcp)))
+                is_winograd_fastest(jcp)))
         return status::unimplemented;
 
     const bool prb_shape_ok = jcp.kh == 3 && jcp.kw == 3 && jcp.ngroups == 1
@@ -2505,7 +2481,7 @@ status_t jit_avx512_core_f32_wino_conv_4x3_bwd_weights_kernel::init_conf(
 
     // Winograd kernel works only for 3x3 convolution with stride 1
     if (!IMPLICATION(cd.alg_kind == alg_kind::convolution_auto,
-                is_winograd_faster_than_direct(jcp)))
+                is_winograd_fastest(jcp)))
         return status::unimplemented;
 
     const bool prb_shape_ok = jcp.kh == 3 && jcp.kw == 3 && jcp.ngroups == 1
@@ -0,0 +1,580 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_avx512_core_grouped_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::data_type;
+using namespace Xbyak;
+
+#define GET_OFF(field) \
+    offsetof(jit_avx512_core_grouped_conv_fwd_kernel_t::call_params_t, field)
+
+jit_avx512_core_grouped_conv_fwd_kernel_t::
+        jit_avx512_core_grouped_conv_fwd_kernel_t(
+                const jit_grouped_conv_conf_t &ajcp,
+                const memory_desc_t &dst_md, int ur_w, bool runtime_kw)
+    : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, avx512_core)
+    , jcp(ajcp)
+    , ur_w_(ur_w)
+    , runtime_kw_(runtime_kw) {
+    if (jcp.with_eltwise) {
+        using namespace binary_injector;
+        static constexpr bool preserve_gpr = true;
+        static constexpr bool preserve_vmm = true;
+        static constexpr size_t helper_vmm_idx = 31;
+        // binary post-ops are not supported, the rhs arguments are never
+        // read from the call parameters
+        rhs_arg_static_params_t rhs_arg_static_params {helper_vmm_idx, r14,
+                r15, preserve_gpr, preserve_vmm, 0 /*abi_param_offset*/,
+                memory_desc_wrapper(dst_md)};
+        static_params_t static_params {this->param1, rhs_arg_static_params};
+
+        postops_injector_ = utils::make_unique<
+                injector::jit_uni_postops_injector_t<avx512_core>>(
+                this, jcp.post_ops, static_params);
+    }
+}
+
+void jit_avx512_core_grouped_conv_fwd_kernel_t::load_data(data_type_t dt,
+        const Vmm &vmm, const Address &addr, bool mask) {
+    const Vmm vmm_in = mask ? vmm | k_load_mask | T_z : vmm;
+    switch (dt) {
+        case f32: vmovups(vmm_in, addr); break;
+        case s32: vcvtdq2ps(vmm_in, addr); break;
+        case bf16:
+            vpmovzxwd(vmm_in, addr);
+            vpslld(vmm, vmm, 16);
+            break;
+        case s8:
+            vpmovsxbd(vmm_in, addr);
+            vcvtdq2ps(vmm, vmm);
+            break;
+        case u8:
+            vpmovzxbd(vmm_in, addr);
+            vcvtdq2ps(vmm, vmm);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+void jit_avx512_core_grouped_conv_fwd_kernel_t::compute_tap(
+        reg64_t &reg_s, size_t src_off, reg64_t &reg_w, size_t wei_off) {
+    const int c = jcp.ch_per_group;
+    const size_t src_w_step = jcp.stride_w * jcp.ch * jcp.src_dsz;
+    const size_t wei_k_step = simd_w_ * jcp.wei_dsz;
+
+    // With a single group per vector the broadcast of the input channel
+    // comes for free from the memory operand of the fma.
+    const bool bcast_from_mem = c == simd_w_ && jcp.src_dt == f32;
+
+    if (!bcast_from_mem)
+        for (int u = 0; u < ur_w_; u++)
+            load_data(jcp.src_dt, vmm_src(u),
+                    ptr[reg_s + src_off + u * src_w_step], true);
+
+    for (int k = 0; k < c; k++) {
+        load_data(jcp.wei_dt, vmm_wei(), ptr[reg_w + wei_off + k * wei_k_step],
+                false);
+        for (int u = 0; u < ur_w_; u++) {
+            if (bcast_from_mem) {
+                const size_t off = src_off + u * src_w_step + k * jcp.src_dsz;
+                vfmadd231ps(vmm_acc(u), vmm_wei(), ptr_b[reg_s + off]);
+            } else {
+                vpermps(vmm_tmp(), vmm_idx(k), vmm_src(u));
+                vfmadd231ps(vmm_acc(u), vmm_tmp(), vmm_wei());
+            }
+        }
+    }
+}
+
+void jit_avx512_core_grouped_conv_fwd_kernel_t::compute_kw_loop() {
+    const int dw = jcp.dilate_w + 1;
+    const size_t src_kw_step = dw * jcp.ch * jcp.src_dsz;
+    const size_t wei_kw_step = jcp.ch_per_group * simd_w_ * jcp.wei_dsz;
+
+    if (runtime_kw_) {
+        Label kw_loop, kw_done;
+        mov(reg_kw, ptr[reg_param + GET_OFF(kw_cnt)]);
+        test(reg_kw, reg_kw);
+        jz(kw_done, T_NEAR);
+        mov(aux2_reg_src, aux_reg_src);
+        mov(aux2_reg_wei, aux_reg_wei);
+        L(kw_loop);
+        {
+            compute_tap(aux2_reg_src, 0, aux2_reg_wei, 0);
+            add(aux2_reg_src, src_kw_step);
+            add(aux2_reg_wei, wei_kw_step);
+            dec(reg_kw);
+            jnz(kw_loop, T_NEAR);
+        }
+        L(kw_done);
+    } else {
+        for (int kw = 0; kw < jcp.kw; kw++)
+            compute_tap(aux_reg_src, kw * src_kw_step, aux_reg_wei,
+                    kw * wei_kw_step);
+    }
+}
+
+void jit_avx512_core_grouped_conv_fwd_kernel_t::apply_postops() {
+    const bool is_int8 = one_of(jcp.src_dt, u8, s8);
+
+    if (jcp.with_bias) {
+        mov(reg_tmp, ptr[reg_param + GET_OFF(bias)]);
+        load_data(jcp.bia_dt, vmm_wei(), ptr[reg_tmp], true);
+        for (int u = 0; u < ur_w_; u++)
+            vaddps(vmm_acc(u), vmm_acc(u), vmm_wei());
+    }
+
+    if (is_int8) {
+        mov(reg_tmp, ptr[reg_param + GET_OFF(scales)]);
+        if (jcp.is_oc_scale)
+            vmovups(vmm_wei() | k_load_mask | T_z, ptr[reg_tmp]);
+        else
+            vbroadcastss(vmm_wei(), ptr[reg_tmp]);
+        for (int u = 0; u < ur_w_; u++)
+            vmulps(vmm_acc(u), vmm_acc(u), vmm_wei());
+    }
+
+    if (jcp.with_sum) {
+        const size_t dst_w_step = jcp.ch * jcp.dst_dsz;
+        const bool scale_one = jcp.sum_scale == 1.f;
+        if (!scale_one) {
+            mov(reg_tmp, float2int(jcp.sum_scale));
+            vpbroadcastd(vmm_wei(), reg_tmp.cvt32());
+        }
+        for (int u = 0; u < ur_w_; u++) {
+            load_data(jcp.dst_dt, vmm_tmp(), ptr[reg_dst + u * dst_w_step],
+                    true);
+            if (scale_one)
+                vaddps(vmm_acc(u), vmm_acc(u), vmm_tmp());
+            else
+                vfmadd231ps(vmm_acc(u), vmm_tmp(), vmm_wei());
+        }
+    }
+
+    if (jcp.with_eltwise) postops_injector_->compute_vector_range(0, ur_w_);
+}
+
+void jit_avx512_core_grouped_conv_fwd_kernel_t::store_dst() {
+    const size_t dst_w_step = jcp.ch * jcp.dst_dsz;
+    const Vmm vmm_lbound = vmm_wei();
+    const Vmm vmm_ubound = vmm_tmp();
+    init_saturate_f32(vmm_lbound, vmm_ubound, reg_tmp, f32, jcp.dst_dt);
+
+    for (int u = 0; u < ur_w_; u++) {
+        const Vmm vmm = vmm_acc(u);
+        const auto addr = ptr[reg_dst + u * dst_w_step];
+        saturate_f32(vmm, vmm_lbound, vmm_ubound, jcp.dst_dt);
+        switch (jcp.dst_dt) {
+            case f32: vmovups(addr | k_load_mask, vmm); break;
+            case bf16: {
+                const Ymm ymm(vmm.getIdx());
+                vcvtneps2bf16(ymm, vmm);
+                vmovdqu16(addr | k_load_mask, ymm);
+                break;
+            }
+            case s32:
+                vcvtps2dq(vmm, vmm);
+                vmovdqu32(addr | k_load_mask, vmm);
+                break;
+            case s8:
+            case u8: {
+                // a masked down-convert cannot write to memory directly
+                const Xmm xmm(vmm.getIdx());
+                vcvtps2dq(vmm, vmm);
+                if (jcp.dst_dt == s8)
+                    vpmovsdb(xmm, vmm);
+                else
+                    vpmovusdb(xmm, vmm);
+                vmovdqu8(addr | k_load_mask, xmm);
+                break;
+            }
+            default: assert(!"unsupported data type");
+        }
+    }
+}
+
+void jit_avx512_core_grouped_conv_fwd_kernel_t::prepare_table() {
+    const int c = jcp.ch_per_group;
+    align(64);
+    L(l_table);
+    // idx_k[j] selects input channel k of the group lane j belongs to
+    for (int k = 0; k < c; k++)
+        for (int j = 0; j < simd_w_; j++)
+            dd((j / c) * c + k);
+}
+
+void jit_avx512_core_grouped_conv_fwd_kernel_t::generate() {
+    const int c = jcp.ch_per_group;
+    const int dh = jcp.dilate_h + 1;
+    const int dd = jcp.dilate_d + 1;
+    const size_t src_kh_step = (size_t)dh * jcp.iw * jcp.ch * jcp.src_dsz;
+    const size_t src_kd_step
+            = (size_t)dd * jcp.ih * jcp.iw * jcp.ch * jcp.src_dsz;
+    const size_t wei_kh_step = (size_t)jcp.kw * c * simd_w_ * jcp.wei_dsz;
+    const size_t wei_kd_step = jcp.kh * wei_kh_step;
+
+    preamble();
+
+    mov(reg_src, ptr[reg_param + GET_OFF(src)]);
+    mov(reg_wei, ptr[reg_param + GET_OFF(wei)]);
+    mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+    mov(reg_tmp, ptr[reg_param + GET_OFF(load_mask)]);
+    kmovw(k_load_mask, reg_tmp.cvt32());
+
+    const bool bcast_from_mem = c == simd_w_ && jcp.src_dt == f32;
+    if (!bcast_from_mem) {
+        mov(reg_tmp, l_table);
+        for (int k = 0; k < c; k++)
+            vmovups(vmm_idx(k), ptr[reg_tmp + k * simd_w_ * sizeof(int32_t)]);
+    }
+
+    for (int u = 0; u < ur_w_; u++)
+        vpxord(vmm_acc(u), vmm_acc(u), vmm_acc(u));
+
+    Label kd_loop, kd_done;
+    mov(reg_kd, ptr[reg_param + GET_OFF(kd_cnt)]);
+    test(reg_kd, reg_kd);
+    jz(kd_done, T_NEAR);
+    L(kd_loop);
+    {
+        Label kh_loop, kh_done;
+        mov(aux_reg_src, reg_src);
+        mov(aux_reg_wei, reg_wei);
+        mov(reg_kh, ptr[reg_param + GET_OFF(kh_cnt)]);
+        test(reg_kh, reg_kh);
+        jz(kh_done, T_NEAR);
+        L(kh_loop);
+        {
+            compute_kw_loop();
+            add(aux_reg_src, src_kh_step);
+            add(aux_reg_wei, wei_kh_step);
+            dec(reg_kh);
+            jnz(kh_loop, T_NEAR);
+        }
+        L(kh_done);
+
+        add(reg_src, src_kd_step);
+        add(reg_wei, wei_kd_step);
+        dec(reg_kd);
+        jnz(kd_loop, T_NEAR);
+    }
+    L(kd_done);
+
+    apply_postops();
+    store_dst();
+
+    postamble();
+
+    if (!bcast_from_mem) prepare_table();
+    if (jcp.with_eltwise) postops_injector_->prepare_table();
+}
+
+#undef GET_OFF
+
+status_t jit_avx512_core_grouped_convolution_fwd_t::pd_t::init(
+        engine_t *engine) {
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    const auto src_dt = invariant_src_md()->data_type;
+    const auto wei_dt = invariant_wei_md()->data_type;
+    const auto bia_dt = invariant_bia_md()->data_type;
+    const auto dst_dt = invariant_dst_md()->data_type;
+
+    const bool is_f32 = everyone_is(f32, src_dt, wei_dt, dst_dt);
+    const bool is_bf16
+            = everyone_is(bf16, src_dt, wei_dt) && one_of(dst_dt, f32, bf16);
+    const bool is_int8 = one_of(src_dt, u8, s8) && wei_dt == s8
+            && one_of(dst_dt, f32, s32, s8, u8);
+
+    auto skip_mask = skip_mask_t::post_ops;
+    if (is_int8) skip_mask |= skip_mask_t::oscale;
+
+    const bool ok = is_fwd()
+            && set_default_alg_kind(alg_kind::convolution_direct)
+            && one_of(true, is_f32, is_bf16, is_int8) && mayiuse(avx512_core)
+            && IMPLICATION(is_bf16, mayiuse(avx512_core_bf16))
+            && IMPLICATION(with_bias(),
+                    bia_dt == f32 || (is_bf16 && bia_dt == bf16)
+                            || (is_int8 && one_of(bia_dt, s32, s8, u8)))
+            && attr()->has_default_values(skip_mask, dst_dt)
+            && IMPLICATION(is_int8,
+                    one_of(attr()->output_scales_.mask_, 0, 1 << 1))
+            && !has_zero_dim_memory();
+    if (!ok) return status::unimplemented;
+
+    return init_conf();
+}
+
+status_t
+jit_avx512_core_grouped_convolution_fwd_t::pd_t::init_packed_weights_md(
+        memory_desc_t &md) const {
+    const int c = jcp_.ch_per_group;
+    const int wei_ndims = ndims() + 1;
+
+    md = *invariant_wei_md();
+    blocking_desc_t blk = {};
+    blk.inner_nblks = 2;
+    blk.inner_blks[0] = 16 / c;
+    blk.inner_idxs[0] = 0;
+    blk.inner_blks[1] = c;
+    blk.inner_idxs[1] = 1;
+    // only the order of the strides matters here: groups and output
+    // channels go outermost, then the spatial dimensions, then the input
+    // channels of a group
+    blk.strides[0] = wei_ndims + 1;
+    blk.strides[1] = wei_ndims;
+    blk.strides[2] = 1;
+    for (int d = 3; d < wei_ndims; d++)
+        blk.strides[d] = wei_ndims + 2 - d;
+
+    return memory_desc_init_by_blocking_desc(md, blk);
+}
+
+status_t jit_avx512_core_grouped_convolution_fwd_t::pd_t::init_conf() {
+    using namespace format_tag;
+    auto &jcp = jcp_;
+
+    if (!with_groups() || G() == 1) return status::unimplemented;
+
+    jcp.ndims = ndims();
+    jcp.mb = MB();
+    jcp.ngroups = G();
+    jcp.ch_per_group = IC() / G();
+    if (jcp.ch_per_group != OC() / G()
+            || !one_of(jcp.ch_per_group, 2, 4, 8, 16))
+        return status::unimplemented;
+    jcp.ch = jcp.ngroups * jcp.ch_per_group;
+    jcp.nb_ch = div_up(jcp.ch, 16);
+    jcp.ch_tail = jcp.ch % 16;
+
+    const int nd = jcp.ndims;
+    jcp.id = ID();
+    jcp.ih = IH();
+    jcp.iw = IW();
+    jcp.od = OD();
+    jcp.oh = OH();
+    jcp.ow = OW();
+    jcp.kd = KD();
+    jcp.kh = KH();
+    jcp.kw = KW();
+    jcp.f_pad = padFront();
+    jcp.t_pad = padT();
+    jcp.l_pad = padL();
+    jcp.stride_d = KSD();
+    jcp.stride_h = KSH();
+    jcp.stride_w = KSW();
+    jcp.dilate_d = nd == 5 ? KDD() : 0;
+    jcp.dilate_h = nd >= 4 ? KDH() : 0;
+    jcp.dilate_w = KDW();
+
+    jcp.src_dt = invariant_src_md()->data_type;
+    jcp.wei_dt = invariant_wei_md()->data_type;
+    jcp.dst_dt = invariant_dst_md()->data_type;
+    jcp.with_bias = with_bias();
+    jcp.bia_dt = jcp.with_bias ? invariant_bia_md()->data_type : data_type::f32;
+    jcp.src_dsz = types::data_type_size(jcp.src_dt);
+    jcp.wei_dsz = types::data_type_size(jcp.wei_dt);
+    jcp.bia_dsz = types::data_type_size(jcp.bia_dt);
+    jcp.dst_dsz = types::data_type_size(jcp.dst_dt);
+
+    // Integer products are accumulated in f32, which is exact only while
+    // the sum stays within the 24-bit mantissa.
+    const bool is_int8 = one_of(jcp.src_dt, u8, s8);
+    const dim_t max_int8_terms = (1 << 24) / (UINT8_MAX * (-INT8_MIN));
+    if (is_int8
+            && (dim_t)jcp.ch_per_group * jcp.kd * jcp.kh * jcp.kw
+                    > max_int8_terms)
+        return status::unimplemented;
+
+    const auto dat_tag = utils::pick(nd - 3, nwc, nhwc, ndhwc);
+    if (src_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(src_md_, dat_tag));
+    if (dst_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(dst_md_, dat_tag));
+    if (!memory_desc_matches_tag(src_md_, dat_tag)
+            || !memory_desc_matches_tag(dst_md_, dat_tag))
+        return status::unimplemented;
+    if (jcp.with_bias && bias_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(bias_md_, x));
+
+    memory_desc_t want_wei_md;
+    CHECK(init_packed_weights_md(want_wei_md));
+    if (weights_md_.format_kind == format_kind::any)
+        weights_md_ = want_wei_md;
+    else if (weights_md_ != want_wei_md)
+        return status::unimplemented;
+
+    const auto &post_ops = attr()->post_ops_;
+    const memory_desc_wrapper dst_d(&dst_md_);
+    using namespace injector;
+    if (!post_ops_ok(post_ops_ok_args_t(avx512_core, {sum, eltwise}, post_ops,
+                &dst_d, true /*sum_at_pos_0_only*/,
+                false /*sum_requires_scale_one*/)))
+        return status::unimplemented;
+    const int sum_idx = post_ops.find(primitive_kind::sum);
+    jcp.with_sum = sum_idx != -1;
+    if (jcp.with_sum) {
+        const auto &sum = post_ops.entry_[sum_idx].sum;
+        if (!one_of(sum.dt, data_type::undef, jcp.dst_dt))
+            return status::unimplemented;
+        jcp.sum_scale = sum.scale;
+    }
+    jcp.with_eltwise = post_ops.find(primitive_kind::eltwise) != -1;
+    jcp.post_ops = post_ops;
+    jcp.is_oc_scale = attr()->output_scales_.mask_ == 1 << 1;
+
+    // two zmm registers per output point, one index register per input
+    // channel of a group, and the weights and temporary registers; zmm31 is
+    // left to the post-ops injector
+    const int max_ur_w = nstl::min(8, (29 - jcp.ch_per_group) / 2);
+    jcp.ur_w = nstl::min(max_ur_w, jcp.ow);
+
+    return status::success;
+}
+
+status_t jit_avx512_core_grouped_convolution_fwd_t::init(engine_t *engine) {
+    const auto &jcp = pd()->jcp_;
+    CHECK(safe_ptr_assign(kernel_,
+            new kernel_t(jcp, *pd()->dst_md(), jcp.ur_w, false)));
+    CHECK(kernel_->create_kernel());
+    CHECK(safe_ptr_assign(
+            kernel_single_, new kernel_t(jcp, *pd()->dst_md(), 1, true)));
+    return kernel_single_->create_kernel();
+}
+
+status_t jit_avx512_core_grouped_convolution_fwd_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    const auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto &jcp = pd()->jcp_;
+    const int c = jcp.ch_per_group;
+    const float *oscales = pd()->attr()->output_scales_.scales_;
+
+    const int nd = jcp.ndims;
+    const auto &src_str = src_d.blocking_desc().strides;
+    const auto &dst_str = dst_d.blocking_desc().strides;
+    const dim_t src_sw = src_str[nd - 1];
+    const dim_t src_sh = nd >= 4 ? src_str[nd - 2] : 0;
+    const dim_t src_sd = nd == 5 ? src_str[nd - 3] : 0;
+    const dim_t dst_sw = dst_str[nd - 1];
+    const dim_t dst_sh = nd >= 4 ? dst_str[nd - 2] : 0;
+    const dim_t dst_sd = nd == 5 ? dst_str[nd - 3] : 0;
+
+    const dim_t wei_kw_step = (dim_t)c * 16;
+    const dim_t wei_kh_step = jcp.kw * wei_kw_step;
+    const dim_t wei_kd_step = jcp.kh * wei_kh_step;
+    const dim_t wei_cb_step = jcp.kd * wei_kd_step;
+
+    const int dd = jcp.dilate_d + 1;
+    const int dh = jcp.dilate_h + 1;
+    const int dw = jcp.dilate_w + 1;
+
+    // [k_s, k_e) is the range of filter taps that hit the input for the
+    // first input point i0
+    auto tap_range = [](int i0, int dil, int k, int i, int &k_s, int &k_e) {
+        k_s = i0 >= 0 ? 0 : div_up(-i0, dil);
+        k_e = i0 >= i ? 0 : nstl::min(k, div_up(i - i0, dil));
+        k_e = nstl::max(k_s, k_e);
+    };
+
+    // output points in [ow_s, ow_e) use all the filter taps along the width
+    const int ur_w = jcp.ur_w;
+    const int last_iw = jcp.iw - 1 - (jcp.kw - 1) * dw + jcp.l_pad;
+    const int ow_s = nstl::min(jcp.ow, div_up(jcp.l_pad, jcp.stride_w));
+    const int ow_e = last_iw < 0
+            ? ow_s
+            : nstl::max(ow_s, nstl::min(jcp.ow, last_iw / jcp.stride_w + 1));
+
+    parallel_nd(jcp.mb, jcp.od, jcp.oh, jcp.nb_ch,
+            [&](dim_t n, dim_t od, dim_t oh, dim_t cb) {
+                const int id0 = od * jcp.stride_d - jcp.f_pad;
+                const int ih0 = oh * jcp.stride_h - jcp.t_pad;
+                int kd_s, kd_e, kh_s, kh_e;
+                tap_range(id0, dd, jcp.kd, jcp.id, kd_s, kd_e);
+                tap_range(ih0, dh, jcp.kh, jcp.ih, kh_s, kh_e);
+
+                const dim_t ch_off = cb * 16;
+                const char *src_row = src
+                        + (src_d.offset0() + n * src_str[0] + ch_off
+                                  + (id0 + kd_s * dd) * src_sd
+                                  + (ih0 + kh_s * dh) * src_sh)
+                                * jcp.src_dsz;
+                const char *wei_row = weights
+                        + (weights_d.offset0() + cb * wei_cb_step
+                                  + kd_s * wei_kd_step + kh_s * wei_kh_step)
+                                * jcp.wei_dsz;
+                char *dst_row = dst
+                        + (dst_d.offset0() + n * dst_str[0] + ch_off
+                                  + od * dst_sd + oh * dst_sh)
+                                * jcp.dst_dsz;
+
+                kernel_t::call_params_t p;
+                p.bias = jcp.with_bias ? bias + ch_off * jcp.bia_dsz : nullptr;
+                p.scales = oscales + (jcp.is_oc_scale ? ch_off : 0);
+                p.kd_cnt = kd_e - kd_s;
+                p.kh_cnt = kh_e - kh_s;
+                const bool is_tail = jcp.ch_tail && cb == jcp.nb_ch - 1;
+                p.load_mask = is_tail ? (1 << jcp.ch_tail) - 1 : 0xffff;
+
+                auto ker_call = [&](const kernel_t *ker, int ow) {
+                    const int iw0 = ow * jcp.stride_w - jcp.l_pad;
+                    int kw_s, kw_e;
+                    tap_range(iw0, dw, jcp.kw, jcp.iw, kw_s, kw_e);
+                    p.src = src_row + (iw0 + kw_s * dw) * src_sw * jcp.src_dsz;
+                    p.wei = wei_row + kw_s * wei_kw_step * jcp.wei_dsz;
+                    p.dst = dst_row + ow * dst_sw * jcp.dst_dsz;
+                    p.kw_cnt = kw_e - kw_s;
+                    (*ker)(&p);
+                };
+
+                int ow = 0;
+                for (; ow < ow_s; ow++)
+                    ker_call(kernel_single_.get(), ow);
+                for (; ow + ur_w <= ow_e; ow += ur_w)
+                    ker_call(kernel_.get(), ow);
+                for (; ow < jcp.ow; ow++)
+                    ker_call(kernel_single_.get(), ow);
+            });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
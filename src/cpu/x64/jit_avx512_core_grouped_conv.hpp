@@ -0,0 +1,162 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_AVX512_CORE_GROUPED_CONV_HPP
+#define CPU_X64_JIT_AVX512_CORE_GROUPED_CONV_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+#include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/jit_primitive_conf.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Forward convolution for grouped problems with a few (2, 4, 8 or 16)
+// channels per group in channels-last layout. A zmm register holds one
+// spatial point of 16 / ch_per_group consecutive groups, so no lane is spent
+// on padding a group up to the vector length. The input channels of a group
+// are broadcast within the group with vpermps, and the weights are kept in a
+// blocked layout matching the lanes of the output vector:
+// [G / (16 / c)][kd][kh][kw][ic][16 / c groups][c output channels].
+struct jit_avx512_core_grouped_conv_fwd_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_grouped_conv_fwd_kernel_t)
+
+    struct call_params_t {
+        const void *src;
+        const void *wei;
+        void *dst;
+        const void *bias;
+        const float *scales;
+        size_t kd_cnt;
+        size_t kh_cnt;
+        size_t kw_cnt;
+        size_t load_mask;
+    };
+
+    // ur_w output points are computed per call. With runtime_kw the number
+    // of filter taps along the width is read from call_params_t::kw_cnt,
+    // otherwise all jcp.kw taps are unrolled.
+    jit_avx512_core_grouped_conv_fwd_kernel_t(
+            const jit_grouped_conv_conf_t &ajcp, const memory_desc_t &dst_md,
+            int ur_w, bool runtime_kw);
+
+    const jit_grouped_conv_conf_t &jcp;
+
+private:
+    using Vmm = Xbyak::Zmm;
+    using reg64_t = const Xbyak::Reg64;
+
+    static constexpr int simd_w_ = 16;
+    const int ur_w_;
+    const bool runtime_kw_;
+
+    reg64_t reg_param = abi_param1;
+    reg64_t reg_src = r8;
+    reg64_t reg_wei = r9;
+    reg64_t aux_reg_src = r10;
+    reg64_t aux_reg_wei = r11;
+    reg64_t aux2_reg_src = r12;
+    reg64_t aux2_reg_wei = r13;
+    reg64_t reg_kd = rbx;
+    reg64_t reg_kh = rdx;
+    reg64_t reg_kw = rsi;
+    reg64_t reg_dst = rcx;
+    reg64_t reg_tmp = rbp;
+    // r14 and r15 are left to the post-ops injector
+
+    const Xbyak::Opmask k_load_mask = k2;
+
+    Vmm vmm_acc(int u) const { return Vmm(u); }
+    Vmm vmm_src(int u) const { return Vmm(ur_w_ + u); }
+    Vmm vmm_idx(int k) const { return Vmm(2 * ur_w_ + k); }
+    Vmm vmm_wei() const { return Vmm(2 * ur_w_ + jcp.ch_per_group); }
+    Vmm vmm_tmp() const { return Vmm(2 * ur_w_ + jcp.ch_per_group + 1); }
+
+    Xbyak::Label l_table;
+
+    std::unique_ptr<injector::jit_uni_postops_injector_t<avx512_core>>
+            postops_injector_;
+
+    void load_data(data_type_t dt, const Vmm &vmm, const Xbyak::Address &addr,
+            bool mask);
+    void compute_tap(reg64_t &reg_s, size_t src_off, reg64_t &reg_w,
+            size_t wei_off);
+    void compute_kw_loop();
+    void apply_postops();
+    void store_dst();
+    void prepare_table();
+
+    void generate() override;
+};
+
+struct jit_avx512_core_grouped_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        pd_t(const convolution_desc_t *adesc, const primitive_attr_t *attr,
+                const typename pd_t::base_class *hint_fwd_pd)
+            : cpu_convolution_fwd_pd_t(adesc, attr, hint_fwd_pd), jcp_() {}
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit_grouped:", avx512_core, ""),
+                jit_avx512_core_grouped_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        jit_grouped_conv_conf_t jcp_;
+
+    private:
+        status_t init_conf();
+        status_t init_packed_weights_md(memory_desc_t &md) const;
+    };
+
+    jit_avx512_core_grouped_convolution_fwd_t(const pd_t *apd)
+        : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    using kernel_t = jit_avx512_core_grouped_conv_fwd_kernel_t;
+
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // kernel_ processes jcp.ur_w output points with all the filter taps
+    // along the width, kernel_single_ processes one output point next to
+    // the left or right border.
+    std::unique_ptr<kernel_t> kernel_;
+    std::unique_ptr<kernel_t> kernel_single_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
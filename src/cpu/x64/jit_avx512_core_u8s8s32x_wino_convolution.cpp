@@ -26,6 +26,7 @@
 #include "cpu/platform.hpp"
 
 #include "cpu/x64/jit_avx512_core_u8s8s32x_wino_convolution.hpp"
+#include "cpu/x64/jit_conv_cost_model.hpp"
 #include "cpu/x64/jit_generator.hpp"
 #include "cpu/x64/jit_primitive_conf.hpp"
 
@@ -687,14 +688,13 @@ void jit_avx512_core_u8s8s32x_wino_conv_fwd_ker_t::generate() {
     postamble();
 }
 namespace {
-bool is_winograd_faster_than_direct(const jit_conv_conf_2x3_wino_t &jcp) {
-    if (jcp.has_vnni) {
-        return (jcp.mb <= jcp.nthr
-                       && (jcp.mb > 4 && jcp.ic > 64
-                               && !(jcp.oc > 128 && jcp.ih < 14)))
-                || jcp.mb > jcp.nthr;
-    }
-    return true;
+bool is_winograd_fastest(const jit_conv_conf_2x3_wino_t &jcp) {
+    // Weights are reordered to the wino format ahead of time.
+    const conv_cost_model::problem_t prb(jcp, data_type::u8, false);
+    // The kernel implements F(2x2, 3x3), jcp.m is set later in init_conf.
+    const int tile_size = 2;
+    return conv_cost_model::is_winograd_fastest(prb, tile_size,
+            jcp.has_vnni ? avx512_core_vnni : avx512_core, jcp.nthr);
 }
 } // namespace
 
@@ -747,7 +747,7 @@ status_t jit_avx512_core_u8s8s32x_wino_conv_fwd_ker_t::init_conf(
     jcp.has_vnni = mayiuse(avx512_core_vnni);
 
     if (!IMPLICATION(cd.alg_kind == alg_kind::convolution_auto,
-                is_winograd_faster_than_direct(jcp)))
+                is_winograd_fastest(jcp)))
         return status::unimplemented;
 
     // block sizes needed for GEMM kernel
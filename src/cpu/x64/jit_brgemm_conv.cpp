@@ -1904,9 +1904,11 @@ void brgemm_convolution_fwd_t<isa, use_inversion>::ker_vpad(
 template struct brgemm_convolution_fwd_t<avx512_core>;
 template struct brgemm_convolution_fwd_t<avx512_core, true>;
 template struct brgemm_convolution_fwd_t<avx512_core_vnni>;
+template struct brgemm_convolution_fwd_t<avx512_core_vnni, true>;
 template struct brgemm_convolution_fwd_t<avx512_core_bf16>;
 template struct brgemm_convolution_fwd_t<avx512_core_bf16, true>;
 template struct brgemm_convolution_fwd_t<avx512_core_bf16_amx_int8>;
+template struct brgemm_convolution_fwd_t<avx512_core_bf16_amx_int8, true>;
 template struct brgemm_convolution_fwd_t<avx512_core_bf16_amx_bf16>;
 template struct brgemm_convolution_fwd_t<avx512_core_bf16_amx_bf16, true>;
 
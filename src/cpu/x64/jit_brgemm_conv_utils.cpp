@@ -647,6 +647,8 @@ status_t brg_blocking_t::estimate_brgemm_ur() {
             is_bf32);
     CHECK(brgemm_utils::brgemm_blocking(&brg));
     ur = brg.bd_block * (is_amx(isa) ? brg.bd_block2 : 1);
+    // amx blocking may find no decomposition for a short M
+    if (ur <= 0) return status::unimplemented;
     ur_block = brg.bd_block;
     if (is_1x1 && is_amx(isa) && M > 0 && M_tail > 0) {
         brgemm_t brg_sp_tail;
@@ -1022,6 +1024,8 @@ void brg_blocking_t::iterate_ker_block(brg_blocking_t &best_brgb, int kd_block_,
     }
 
     if (exec_type == exec_vpad) {
+        // Blocking along depth showed no gain with padding along width and
+        // slowed down strided depth.
         od_block = 1;
         oh_block = 1;
     } else if (exec_type == exec_trans) {
@@ -1094,6 +1098,29 @@ void brg_blocking_t::iterate_ker_block(brg_blocking_t &best_brgb, int kd_block_,
     } else {
         od_block = 1;
         oh_block = 1;
+        // 3D: output planes of a block are computed for the same output row
+        // one after another, so the ext_kd - stride_d input planes shared by
+        // neighbouring output planes are reused from L2 instead of being
+        // reloaded after the whole output plane.
+        if (kd > 1 && stride_d < ext_kd) {
+            const auto inp_plane_size
+                    = static_cast<size_t>(src_dsz) * ic * iwp * kh;
+            const auto L2_planes = static_cast<int>(div_up(L2, 2)
+                    / nstl::max(inp_plane_size, static_cast<size_t>(1)));
+            const auto L2_od_block = (L2_planes - ext_kd) / stride_d + 1;
+            // keep enough jobs for all threads
+            const auto jobs_per_od = static_cast<dim_t>(mb) * ngroups
+                    * div_up(oc, oc_block) * oh;
+            const auto thr_od_block = static_cast<int>(
+                    div_up(od, div_up(static_cast<dim_t>(nthr), jobs_per_od)));
+            auto cur_od_block = utils::saturate(
+                    1, od, nstl::min(L2_od_block, thr_od_block));
+            for (; cur_od_block > 1; cur_od_block--) {
+                if (static_cast<float>(od) / rnd_up(od, cur_od_block) > 0.9f)
+                    break;
+            }
+            od_block = cur_od_block;
+        }
     }
 
     // --- Select ow_block ----
@@ -0,0 +1,331 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ref_deconvolution.hpp"
+
+#include "cpu/x64/jit_brgemm_deconv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace {
+status_t fwd_conv_desc_create(
+        convolution_desc_t *fwd_conv_d, const deconvolution_desc_t *deconv_d) {
+    // Deconvolution weights {[G,] OC, IC, spatial} are the weights of the
+    // equivalent forward convolution, only spatially inverted. Left and right
+    // paddings are replaced by the corresponding overflows.
+    const memory_desc_t &weights_md = deconv_d->weights_desc;
+    const int ndims_spatial = deconv_d->src_desc.ndims - 2;
+    dims_t overflow_l;
+    dims_t overflow_r;
+    dim_t ks = 1;
+    for (int i = 0; i < ndims_spatial; i++) {
+        // only unit strides are allowed for deconv-to-conv conversion
+        if (deconv_d->strides[i] != 1) return status::unimplemented;
+        const dim_t K = weights_md.dims[weights_md.ndims - ndims_spatial + i];
+        ks *= K;
+        const dim_t D = deconv_d->dilates[i];
+        const dim_t PL = deconv_d->padding[0][i]; // left padding
+        const dim_t PR = deconv_d->padding[1][i]; // right padding
+        overflow_l[i] = (K - 1) * (D + 1) - PL;
+        overflow_r[i] = (K - 1) * (D + 1) - PR;
+        if (overflow_l[i] < 0 || overflow_r[i] < 0)
+            return status::unimplemented;
+    }
+
+    CHECK(conv_desc_init(fwd_conv_d, prop_kind::forward_inference,
+            alg_kind::convolution_direct, &deconv_d->src_desc, &weights_md,
+            &deconv_d->bias_desc, &deconv_d->dst_desc, deconv_d->strides,
+            deconv_d->dilates, overflow_l, overflow_r));
+
+    // Same as for the backward by data via forward convolution: mark the
+    // descriptor to get a separate primitive cache entry for the version of
+    // forward convolution with spatial inversion of weights.
+    const bool with_spatial_inversion = ks > 1;
+    if (with_spatial_inversion) {
+        fwd_conv_d->diff_src_desc = fwd_conv_d->src_desc;
+        fwd_conv_d->diff_dst_desc = fwd_conv_d->dst_desc;
+    }
+    return status::success;
+}
+} // namespace
+
+template <cpu_isa_t isa>
+template <bool use_inversion>
+status_t brgemm_deconvolution_fwd_t<isa>::pd_t::create_conv_pd(
+        std::shared_ptr<primitive_desc_t> &conv_pd,
+        const convolution_desc_t *conv_d, const primitive_attr_t *attr,
+        engine_t *engine, bool regular_conv_ok) {
+    primitive_desc_t *pd;
+    do {
+        // try creating fwd 1x1 conv prim desc
+        using fwd_1x1_conv_pd_t =
+                typename brgemm_1x1_convolution_fwd_t<isa>::pd_t;
+        status_t s = primitive_desc_t::create<fwd_1x1_conv_pd_t>(&pd,
+                reinterpret_cast<const op_desc_t *>(conv_d), attr, engine,
+                nullptr);
+        if (s == status::success) break;
+        if (!regular_conv_ok) return status::unimplemented;
+
+        // try creating fwd conv prim desc
+        using fwd_conv_pd_t =
+                typename brgemm_convolution_fwd_t<isa, use_inversion>::pd_t;
+        CHECK(primitive_desc_t::create<fwd_conv_pd_t>(&pd,
+                reinterpret_cast<const op_desc_t *>(conv_d), attr, engine,
+                nullptr));
+    } while (false);
+    conv_pd.reset(pd);
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using namespace utils;
+
+    const bool ok = is_fwd()
+            && desc()->alg_kind == alg_kind::deconvolution_direct
+            && !has_zero_dim_memory();
+    if (!ok) return status::unimplemented;
+
+    convolution_desc_t fwd_conv_d = convolution_desc_t();
+    CHECK(fwd_conv_desc_create(&fwd_conv_d, desc()));
+
+    // The compensations for padded areas are computed by the brgemm
+    // convolution without inversion of weights, which only matters for the
+    // regular convolution.
+    const bool is_int8 = one_of(src_md_.data_type, s8, u8);
+    const bool is_amx = brgemm_convolution_utils::is_amx(isa);
+    const bool comp_ok = IMPLICATION(is_int8,
+            attr()->zero_points_.has_default_values(DNNL_ARG_SRC)
+                    && (src_md_.data_type == u8 || is_amx));
+
+    constexpr bool use_inversion = true; // invert weights' spatial indices
+    CHECK(create_conv_pd<use_inversion>(
+            conv_pd_, &fwd_conv_d, attr(), engine, comp_ok));
+
+    if (weights_md_.format_kind == format_kind::any)
+        weights_md_ = *conv_pd_->weights_md();
+    if (src_md_.format_kind == format_kind::any)
+        src_md_ = *conv_pd_->src_md();
+    if (dst_md_.format_kind == format_kind::any)
+        dst_md_ = *conv_pd_->dst_md();
+    if (bias_md_.format_kind == format_kind::any)
+        bias_md_ = *conv_pd_->weights_md(1);
+
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(memory_tracking::names::key_nested,
+            conv_pd_->scratchpad_registry());
+
+    return attr_.set_default_formats(dst_md(0));
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_fwd_t<isa>::init(engine_t *engine) {
+    return pd()->conv_pd_->create_primitive(conv_p_, engine);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_fwd_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    // Arguments of the deconvolution and of the equivalent convolution,
+    // including the ones of attributes, coincide.
+    exec_args_t conv_args(ctx.args());
+    exec_ctx_t conv_ctx(ctx, std::move(conv_args));
+
+    nested_scratchpad_t ns(ctx, memory_tracking::names::key_nested, conv_p_);
+    conv_ctx.set_scratchpad_grantor(ns.grantor());
+    return conv_p_->execute(conv_ctx);
+}
+
+template struct brgemm_deconvolution_fwd_t<avx512_core>;
+template struct brgemm_deconvolution_fwd_t<avx512_core_vnni>;
+template struct brgemm_deconvolution_fwd_t<avx512_core_bf16>;
+template struct brgemm_deconvolution_fwd_t<avx512_core_bf16_amx_int8>;
+template struct brgemm_deconvolution_fwd_t<avx512_core_bf16_amx_bf16>;
+
+template <cpu_isa_t isa>
+status_t brgemm_deconvolution_bwd_data_t<isa>::pd_t::init_convolution(
+        engine_t *engine) {
+    if (desc()->alg_kind != alg_kind::deconvolution_direct
+            || has_zero_dim_memory())
+        return status::unimplemented;
+
+    convolution_desc_t fwd_conv_d = convolution_desc_t();
+    CHECK(conv_descr_create(desc(), &fwd_conv_d));
+    using fwd_pd_t = typename brgemm_deconvolution_fwd_t<isa>::pd_t;
+    return fwd_pd_t::template create_conv_pd<false>(
+            conv_pd_, &fwd_conv_d, attr(), engine);
+}
+
+template struct brgemm_deconvolution_bwd_data_t<avx512_core>;
+template struct brgemm_deconvolution_bwd_data_t<avx512_core_bf16>;
+template struct brgemm_deconvolution_bwd_data_t<avx512_core_bf16_amx_bf16>;
+
+status_t brgemm_deconvolution_bwd_weights_t::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    using namespace format_tag;
+    using namespace utils;
+
+    const auto src_type = desc()->src_desc.data_type;
+    const auto dwei_type = desc()->diff_weights_desc.data_type;
+    const auto ddst_type = desc()->diff_dst_desc.data_type;
+    const bool ok = desc()->prop_kind == prop_kind::backward_weights
+            && desc()->alg_kind == alg_kind::deconvolution_direct
+            && one_of(dwei_type, f32, bf16)
+            && everyone_is(bf16, src_type, ddst_type)
+            && IMPLICATION(with_bias(),
+                    one_of(desc()->diff_bias_desc.data_type, f32, bf16))
+            && attr()->has_default_values() && !has_zero_dim_memory();
+    if (!ok) return status::unimplemented;
+
+    // The diff bias of deconvolution is reduced over the source of the
+    // convolution, so the convolution is created without bias.
+    convolution_desc_t bwd_w_conv_d = convolution_desc_t();
+    CHECK(conv_descr_create(desc(), &bwd_w_conv_d));
+
+    primitive_desc_t *pd;
+    using bwd_w_conv_pd_t = typename brgemm_convolution_bwd_weights_t::pd_t;
+    CHECK(primitive_desc_t::create<bwd_w_conv_pd_t>(&pd,
+            reinterpret_cast<const op_desc_t *>(&bwd_w_conv_d), attr(), engine,
+            nullptr));
+    conv_pd_.reset(pd);
+
+    if (diff_weights_md_.format_kind == format_kind::any)
+        CHECK(weights_axes_permutation(&diff_weights_md_,
+                conv_pd_->diff_weights_md(), with_groups()));
+    if (src_md_.format_kind == format_kind::any)
+        src_md_ = *conv_pd_->diff_dst_md();
+    if (diff_dst_md_.format_kind == format_kind::any)
+        diff_dst_md_ = *conv_pd_->src_md();
+    if (diff_bias_md_.format_kind == format_kind::any)
+        CHECK(memory_desc_init_by_tag(diff_bias_md_, x));
+
+    const bool diff_dst_ok = IMPLICATION(with_bias(),
+            memory_desc_matches_tag(
+                    diff_dst_md_, pick(ndims() - 3, nwc, nhwc, ndhwc)));
+    if (!diff_dst_ok) return status::unimplemented;
+
+    nthr_ = dnnl_get_max_threads();
+    init_scratchpad();
+
+    return status::success;
+}
+
+void brgemm_deconvolution_bwd_weights_t::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(key_nested, conv_pd_->scratchpad_registry());
+    if (with_bias()) scratchpad.book<float>(key_deconv_bias, nthr_ * OC());
+}
+
+status_t brgemm_deconvolution_bwd_weights_t::init(engine_t *engine) {
+    return pd()->conv_pd_->create_primitive(conv_p_, engine);
+}
+
+template <data_type_t dbia_type, data_type_t ddst_type>
+void brgemm_deconvolution_bwd_weights_t::compute_diff_bias(
+        const exec_ctx_t &ctx) const {
+    using dbia_data_t = typename prec_traits<dbia_type>::type;
+    using ddst_data_t = typename prec_traits<ddst_type>::type;
+
+    auto diff_bias = CTX_OUT_MEM(dbia_data_t *, DNNL_ARG_DIFF_BIAS);
+    auto diff_dst = CTX_IN_MEM(const ddst_data_t *, DNNL_ARG_DIFF_DST);
+
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+    diff_dst += diff_dst_d.offset0();
+
+    const dim_t OC = pd()->OC();
+    const dim_t nrows = pd()->MB() * pd()->OD() * pd()->OH() * pd()->OW();
+    const int nthr = pd()->nthr_;
+
+    float *partial = ctx.get_scratchpad_grantor().template get<float>(
+            memory_tracking::names::key_deconv_bias);
+
+    // Every thread reduces its own chunk of channels-last rows, so the diff
+    // destination is read once and with unit stride.
+    parallel_nd(nthr, [&](dim_t ithr) {
+        dim_t start {0}, end {0};
+        balance211(nrows, (dim_t)nthr, ithr, start, end);
+        float *acc = partial + ithr * OC;
+
+        PRAGMA_OMP_SIMD()
+        for (dim_t oc = 0; oc < OC; ++oc)
+            acc[oc] = 0.f;
+
+        for (dim_t r = start; r < end; ++r) {
+            const ddst_data_t *row = diff_dst + r * OC;
+            PRAGMA_OMP_SIMD()
+            for (dim_t oc = 0; oc < OC; ++oc)
+                acc[oc] += static_cast<float>(row[oc]);
+        }
+    });
+
+    constexpr dim_t oc_blk = 16;
+    parallel_nd(utils::div_up(OC, oc_blk), [&](dim_t ocb) {
+        const dim_t oc_s = ocb * oc_blk;
+        const dim_t oc_e = nstl::min(OC, oc_s + oc_blk);
+        float db[oc_blk] = {0};
+        for (int ithr = 0; ithr < nthr; ++ithr) {
+            const float *acc = partial + ithr * OC;
+            PRAGMA_OMP_SIMD()
+            for (dim_t oc = oc_s; oc < oc_e; ++oc)
+                db[oc - oc_s] += acc[oc];
+        }
+        for (dim_t oc = oc_s; oc < oc_e; ++oc)
+            diff_bias[oc] = static_cast<dbia_data_t>(db[oc - oc_s]);
+    });
+}
+
+status_t brgemm_deconvolution_bwd_weights_t::execute(
+        const exec_ctx_t &ctx) const {
+    using namespace data_type;
+
+    const auto &args = ctx.args();
+    exec_args_t conv_args;
+    conv_args[DNNL_ARG_DIFF_DST] = args.at(DNNL_ARG_SRC);
+    conv_args[DNNL_ARG_SRC] = args.at(DNNL_ARG_DIFF_DST);
+    conv_args[DNNL_ARG_DIFF_WEIGHTS] = args.at(DNNL_ARG_DIFF_WEIGHTS);
+    exec_ctx_t conv_ctx(ctx, std::move(conv_args));
+
+    nested_scratchpad_t ns(ctx, memory_tracking::names::key_nested, conv_p_);
+    conv_ctx.set_scratchpad_grantor(ns.grantor());
+    CHECK(conv_p_->execute(conv_ctx));
+
+    if (!pd()->with_bias()) return status::success;
+
+    const auto dbia_type = pd()->diff_weights_md(1)->data_type;
+    if (dbia_type == f32)
+        compute_diff_bias<f32, bf16>(ctx);
+    else
+        compute_diff_bias<bf16, bf16>(ctx);
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
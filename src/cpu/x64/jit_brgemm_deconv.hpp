@@ -0,0 +1,160 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_DECONV_HPP
+#define CPU_X64_JIT_BRGEMM_DECONV_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_deconvolution_pd.hpp"
+#include "cpu/ref_deconvolution.hpp"
+
+#include "cpu/x64/jit_brgemm_1x1_conv.hpp"
+#include "cpu/x64/jit_brgemm_conv.hpp"
+#include "cpu/x64/jit_brgemm_conv_bwd_w.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Deconvolution with unit strides is a forward convolution of the source with
+// spatially inverted weights. The inversion is handled by the brgemm
+// convolution on-the-fly, so bias and post-ops are applied in the brgemm
+// kernels epilogue instead of a separate pass over the destination. Strided
+// deconvolution is not supported: every stride phase would write a non-dense
+// slice of the destination, which the brgemm convolution cannot address.
+template <cpu_isa_t isa>
+struct brgemm_deconvolution_fwd_t : public primitive_t {
+
+    struct pd_t : public cpu_deconvolution_fwd_pd_t {
+        pd_t(const deconvolution_desc_t *adesc, const primitive_attr_t *attr,
+                const typename pd_t::hint_class *hint_fwd_pd)
+            : cpu_deconvolution_fwd_pd_t(adesc, attr, hint_fwd_pd) {}
+
+        ~pd_t() = default;
+
+        DECLARE_COMMON_PD_T(conv_pd_->name(), brgemm_deconvolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // Creates the brgemm forward convolution a deconvolution is mapped
+        // onto: the 1x1 convolution is tried first, then the regular one if
+        // allowed.
+        template <bool use_inversion>
+        static status_t create_conv_pd(
+                std::shared_ptr<primitive_desc_t> &conv_pd,
+                const convolution_desc_t *conv_d, const primitive_attr_t *attr,
+                engine_t *engine, bool regular_conv_ok = true);
+
+        std::shared_ptr<primitive_desc_t> conv_pd_;
+    };
+
+    brgemm_deconvolution_fwd_t(const pd_t *apd) : primitive_t(apd) {};
+
+    ~brgemm_deconvolution_fwd_t() = default;
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const {
+        return static_cast<const pd_t *>(primitive_t::pd().get());
+    }
+    std::shared_ptr<primitive_t> conv_p_;
+};
+
+// Backward by data of deconvolution is a forward convolution of the diff
+// destination with transposed weights, strides and paddings are kept as is.
+// Only the choice of the convolution differs from the reference version: the
+// brgemm convolutions are created directly instead of iterating over the whole
+// convolution list. Data types and attributes are checked by the reference
+// version, so only f32 and bf16 without post-ops are supported.
+template <cpu_isa_t isa>
+struct brgemm_deconvolution_bwd_data_t : public ref_deconvolution_bwd_data_t {
+
+    struct pd_t : public ref_deconvolution_bwd_data_t::pd_t {
+        using ref_deconvolution_bwd_data_t::pd_t::pd_t;
+
+        DECLARE_COMMON_PD_T(conv_pd_->name(), brgemm_deconvolution_bwd_data_t);
+
+        status_t init_convolution(engine_t *engine) override;
+    };
+
+    brgemm_deconvolution_bwd_data_t(const pd_t *apd)
+        : ref_deconvolution_bwd_data_t(apd) {};
+};
+
+// Backward by weights of deconvolution is a backward by weights of the
+// convolution with swapped source and diff destination. The diff bias of
+// deconvolution is reduced over the channels-last diff destination right
+// after the convolution, with a unit-stride pass over the channels instead of
+// a strided per-channel loop. The reduction is not fused into the convolution
+// kernels, as they only read the convolution source through transposition
+// buffers. Only bf16 source and diff destination are supported, on AMX-capable
+// CPUs where the brgemm backward by weights convolution is available.
+struct brgemm_deconvolution_bwd_weights_t : public primitive_t {
+
+    struct pd_t : public cpu_deconvolution_bwd_weights_pd_t {
+        pd_t(const deconvolution_desc_t *adesc, const primitive_attr_t *attr,
+                const deconvolution_fwd_pd_t *hint_fwd_pd)
+            : cpu_deconvolution_bwd_weights_pd_t(adesc, attr, hint_fwd_pd) {}
+
+        ~pd_t() = default;
+
+        DECLARE_COMMON_PD_T(
+                conv_pd_->name(), brgemm_deconvolution_bwd_weights_t);
+
+        status_t init(engine_t *engine);
+
+        std::shared_ptr<primitive_desc_t> conv_pd_;
+        int nthr_ = 0;
+
+    private:
+        void init_scratchpad();
+    };
+
+    brgemm_deconvolution_bwd_weights_t(const pd_t *apd) : primitive_t(apd) {};
+
+    ~brgemm_deconvolution_bwd_weights_t() = default;
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const {
+        return static_cast<const pd_t *>(primitive_t::pd().get());
+    }
+
+    template <data_type_t dbia_type, data_type_t ddst_type>
+    void compute_diff_bias(const exec_ctx_t &ctx) const;
+
+    std::shared_ptr<primitive_t> conv_p_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
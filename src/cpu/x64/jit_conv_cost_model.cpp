@@ -0,0 +1,336 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include <cstring>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+#include "cpu/x64/jit_conv_cost_model.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace conv_cost_model {
+
+using namespace dnnl::impl::utils;
+
+namespace {
+// Sustained per-core bandwidths, in bytes per cycle.
+constexpr double l2_bandwidth = 32.;
+constexpr double mem_bandwidth = 4.;
+// Fraction of the peak reached by the register-blocked direct kernels, the
+// brgemm kernels with and without AMX, the GEMM after im2col, the inner
+// product and the small GEMMs on transformed tiles.
+constexpr double direct_efficiency = 0.85;
+constexpr double brgemm_efficiency = 0.9;
+constexpr double amx_efficiency = 0.5;
+constexpr double gemm_efficiency = 0.8;
+constexpr double ip_efficiency = 0.9;
+constexpr double winograd_gemm_efficiency = 0.75;
+// Vector additions and multiplications issued per cycle in the transforms.
+constexpr double vec_ops_per_cycle = 2.;
+// Number of tiles a Winograd GEMM processes before reloading the transformed
+// weights.
+constexpr int tiles_per_block = 32;
+// Minimal predicted speedup for Winograd to be chosen.
+constexpr double winograd_margin = 1.2;
+// Core frequency used to turn cycles into seconds.
+constexpr double nominal_frequency = 2.e9;
+
+const double infinity = nstl::numeric_limits<double>::infinity();
+
+bool is_int8(data_type_t dt) {
+    return one_of(dt, data_type::s8, data_type::u8);
+}
+
+int f32_lanes(cpu_isa_t isa) {
+    if (is_superset(isa, avx512_core)) return 16;
+    if (is_superset(isa, avx)) return 8;
+    return 4;
+}
+
+double macs_per_cycle(cpu_isa_t isa, data_type_t dt) {
+    const int lanes = f32_lanes(isa);
+    if (dt == data_type::bf16) {
+        // vdpbf16ps does 2 MACs per 32-bit lane, bf16 is converted to f32
+        // otherwise.
+        return is_superset(isa, avx512_core_bf16) ? 2. * 2 * lanes
+                                                  : 2. * lanes;
+    }
+    if (!is_int8(dt)) {
+        // Two FMA ports; sse41 issues a multiplication and an addition.
+        return is_superset(isa, avx2) ? 2. * lanes : lanes;
+    }
+    // vpdpbusd does 4 MACs per 32-bit lane, without VNNI it is emulated with
+    // three instructions.
+    const double macs = 2. * 4 * lanes;
+    return is_superset(isa, avx512_core_vnni) ? macs : macs / 3.;
+}
+
+// Number of work items processed by the slowest thread.
+double per_thread(dim_t work, int nthr) {
+    return (double)div_up(work, nthr);
+}
+
+double total_macs(const problem_t &prb) {
+    return (double)prb.mb * prb.g * prb.oc * prb.ic * prb.kh * prb.kw
+            * prb.oh * prb.ow;
+}
+
+// Activations are streamed once, weights are reused from cache.
+double io_cycles(const problem_t &prb, int simd_w, int nthr) {
+    const dim_t ic = prb.g * rnd_up(prb.ic, simd_w);
+    const dim_t oc = prb.g * rnd_up(prb.oc, simd_w);
+    const size_t sz = types::data_type_size(prb.src_dt);
+    const double bytes = (double)sz
+            * ((double)prb.mb
+                            * (ic * prb.ih * prb.iw + oc * prb.oh * prb.ow)
+                    + (double)ic * rnd_up(prb.oc, simd_w) * prb.kh * prb.kw);
+    return bytes / (mem_bandwidth * nthr);
+}
+
+// Blocked direct and brgemm kernels split the work over minibatch, groups,
+// output channel blocks and output rows.
+double blocked_cycles(
+        const problem_t &prb, double mpc, int simd_w, int nthr) {
+    const dim_t ic = rnd_up(prb.ic, simd_w);
+    const dim_t oc = rnd_up(prb.oc, simd_w);
+    const dim_t ks = (dim_t)prb.kh * prb.kw;
+
+    const dim_t work = (dim_t)prb.mb * prb.g * (oc / simd_w) * prb.oh;
+    const double macs_per_item = (double)prb.ow * simd_w * ic * ks;
+    const double compute = per_thread(work, nthr) * macs_per_item / mpc;
+
+    return nstl::max(compute, io_cycles(prb, simd_w, nthr));
+}
+} // namespace
+
+problem_t::problem_t(const convolution_pd_t *pd)
+    : src_dt(pd->invariant_src_md()->data_type)
+    , with_wei_transform(
+              pd->desc()->prop_kind != prop_kind::forward_inference)
+    , mb(pd->MB())
+    , g(pd->G())
+    , ic(pd->IC() / pd->G())
+    , oc(pd->OC() / pd->G())
+    , ih(pd->ID() * pd->IH())
+    , iw(pd->IW())
+    , oh(pd->OD() * pd->OH())
+    , ow(pd->OW())
+    , kh(pd->KD() * pd->KH())
+    , kw(pd->KW())
+    , sh(pd->KSH())
+    , sw(pd->KSW()) {}
+
+double direct_cycles(const problem_t &prb, cpu_isa_t isa, int nthr) {
+    return blocked_cycles(prb,
+            macs_per_cycle(isa, prb.src_dt) * direct_efficiency,
+            f32_lanes(isa), nthr);
+}
+
+double brgemm_cycles(const problem_t &prb, cpu_isa_t isa, int nthr) {
+    if (!is_superset(isa, avx512_core)) return infinity;
+
+    // A tile multiplication does 512 bf16 or 1024 int8 MACs per cycle.
+    double mpc = macs_per_cycle(isa, prb.src_dt) * brgemm_efficiency;
+    if (prb.src_dt == data_type::bf16
+            && is_superset(isa, avx512_core_bf16_amx_bf16))
+        mpc = 512. * amx_efficiency;
+    else if (is_int8(prb.src_dt)
+            && is_superset(isa, avx512_core_bf16_amx_int8))
+        mpc = 1024. * amx_efficiency;
+
+    return blocked_cycles(prb, mpc, f32_lanes(isa), nthr);
+}
+
+double gemm_cycles(const problem_t &prb, cpu_isa_t isa, int nthr) {
+    const double compute = total_macs(prb) / nthr
+            / (macs_per_cycle(isa, prb.src_dt) * gemm_efficiency);
+    const double memory = io_cycles(prb, 1, nthr);
+
+    // The column buffer of an image and group is written and read back
+    // once, it stays in L2 if it fits there.
+    const bool is_1x1 = prb.kh == 1 && prb.kw == 1 && prb.sh == 1
+            && prb.sw == 1 && prb.ih == prb.oh && prb.iw == prb.ow;
+    double im2col = 0.;
+    if (!is_1x1) {
+        const size_t sz = types::data_type_size(prb.src_dt);
+        const double col_bytes = (double)sz * prb.ic * prb.kh * prb.kw
+                * prb.oh * prb.ow;
+        const double bw = col_bytes <= platform::get_per_core_cache_size(2)
+                ? l2_bandwidth
+                : mem_bandwidth;
+        im2col = 2. * col_bytes * per_thread((dim_t)prb.mb * prb.g, nthr)
+                / bw;
+    }
+
+    return nstl::max(compute, memory) + im2col;
+}
+
+double ip_cycles(const problem_t &prb, cpu_isa_t isa, int nthr) {
+    const bool is_ip = prb.g == 1 && prb.oh == 1 && prb.ow == 1
+            && prb.kh == prb.ih && prb.kw == prb.iw;
+    if (!is_ip) return infinity;
+
+    const double compute = total_macs(prb) / nthr
+            / (macs_per_cycle(isa, prb.src_dt) * ip_efficiency);
+    return nstl::max(compute, io_cycles(prb, 1, nthr));
+}
+
+double winograd_cycles(
+        const problem_t &prb, int tile_size, cpu_isa_t isa, int nthr) {
+    const int simd_w = f32_lanes(isa);
+    const dim_t ic = rnd_up(prb.ic, simd_w);
+    const dim_t oc = rnd_up(prb.oc, simd_w);
+    const int m = tile_size;
+    const int alpha = m + prb.kh - 1;
+    const double alpha2 = (double)alpha * alpha;
+    const dim_t tiles
+            = (dim_t)prb.mb * div_up(prb.oh, m) * div_up(prb.ow, m);
+
+    // Products in the transformed domain: alpha^2 GEMMs split over tiles and
+    // output channel blocks.
+    const double gemm = per_thread(tiles * (oc / simd_w), nthr) * alpha2 * ic
+            * simd_w
+            / (macs_per_cycle(isa, prb.src_dt) * winograd_gemm_efficiency);
+
+    // B^T d B takes about alpha^3 vector operations per tile and input
+    // channel block, A^T M A takes m * alpha * (alpha + m) per tile and output
+    // channel block and G g G^T alpha * kw * (alpha + kh) per channel pair.
+    const double src_trans = per_thread(tiles * (ic / simd_w), nthr) * alpha2
+            * alpha / vec_ops_per_cycle;
+    const double dst_trans = per_thread(tiles * (oc / simd_w), nthr) * m
+            * alpha * (alpha + m) / vec_ops_per_cycle;
+    const double wei_trans = prb.with_wei_transform
+            ? per_thread(ic * oc / simd_w, nthr) * alpha * prb.kw
+                    * (alpha + prb.kh) / vec_ops_per_cycle
+            : 0.;
+
+    // The transformed source and accumulators are written and read back
+    // once. They stay in L2 if the share of a thread fits there.
+    const double l2_size = platform::get_per_core_cache_size(2);
+    const size_t sz = types::data_type_size(prb.src_dt);
+    const double buf_bytes
+            = alpha2 * tiles * ((double)ic * sz + (double)oc * sizeof(float));
+    const double buf_bw
+            = buf_bytes / nthr <= l2_size ? l2_bandwidth : mem_bandwidth;
+    const double buf_traffic = 2. * buf_bytes / (buf_bw * nthr);
+
+    // Every thread goes through all the transformed weights for each block
+    // of its tiles, they come from L2 only if they fit there.
+    const double wei_bytes = alpha2 * ic * oc * sz;
+    const double wei_bw = wei_bytes <= l2_size ? l2_bandwidth : mem_bandwidth;
+    const double wei_traffic = wei_bytes
+            * div_up(div_up(tiles, nthr), tiles_per_block) / wei_bw;
+
+    return nstl::max(gemm, wei_traffic) + src_trans + dst_trans + wei_trans
+            + buf_traffic;
+}
+
+double cycles(const problem_t &prb, alg_t alg, cpu_isa_t isa, int nthr) {
+    switch (alg) {
+        case alg_t::direct: return direct_cycles(prb, isa, nthr);
+        case alg_t::brgemm: return brgemm_cycles(prb, isa, nthr);
+        case alg_t::gemm: return gemm_cycles(prb, isa, nthr);
+        case alg_t::ip: return ip_cycles(prb, isa, nthr);
+        case alg_t::winograd: {
+            // Only 3x3 unit-stride f32 and int8 kernels exist: F(4x4, 3x3)
+            // for f32 on avx512_core and F(2x2, 3x3) otherwise.
+            const bool ok = prb.g == 1 && prb.kh == 3 && prb.kw == 3
+                    && prb.sh == 1 && prb.sw == 1
+                    && prb.src_dt != data_type::bf16
+                    && is_superset(isa, is_int8(prb.src_dt) ? avx512_core
+                                                            : avx2);
+            if (!ok) return infinity;
+            const int tile_size
+                    = !is_int8(prb.src_dt) && is_superset(isa, avx512_core)
+                    ? 4
+                    : 2;
+            return winograd_cycles(prb, tile_size, isa, nthr);
+        }
+    }
+    assert(!"unknown algorithm");
+    return infinity;
+}
+
+int rank(const problem_t &prb, cpu_isa_t isa, int nthr, alg_t order[n_algs]) {
+    const alg_t algs[n_algs] = {alg_t::direct, alg_t::brgemm, alg_t::gemm,
+            alg_t::ip, alg_t::winograd};
+    double costs[n_algs];
+    int n = 0;
+    for (const auto alg : algs) {
+        const double c = cycles(prb, alg, isa, nthr);
+        if (c == infinity) continue;
+        // Insertion keeps the earlier algorithm first on ties.
+        int i = n++;
+        for (; i > 0 && costs[i - 1] > c; --i) {
+            costs[i] = costs[i - 1];
+            order[i] = order[i - 1];
+        }
+        costs[i] = c;
+        order[i] = alg;
+    }
+    return n;
+}
+
+bool is_winograd_fastest(
+        const problem_t &prb, int tile_size, cpu_isa_t isa, int nthr) {
+    const double best_other = nstl::min(
+            nstl::min(direct_cycles(prb, isa, nthr),
+                    brgemm_cycles(prb, isa, nthr)),
+            nstl::min(gemm_cycles(prb, isa, nthr), ip_cycles(prb, isa, nthr)));
+    return winograd_margin * winograd_cycles(prb, tile_size, isa, nthr)
+            < best_other;
+}
+
+double time_estimate(const convolution_pd_t *pd) {
+    const char *name = pd->name();
+    cpu_isa_t isa = get_max_cpu_isa();
+    alg_t alg = alg_t::direct;
+    if (std::strncmp(name, "ip:", 3) == 0)
+        alg = alg_t::ip;
+    else if (std::strstr(name, "wino"))
+        alg = alg_t::winograd;
+    else if (std::strncmp(name, "br", 2) == 0)
+        alg = alg_t::brgemm;
+    else if (std::strstr(name, "gemm"))
+        alg = alg_t::gemm;
+    else if (std::strncmp(name, "ref", 3) == 0)
+        isa = isa_any;
+
+    const problem_t prb(pd);
+    const int nthr = dnnl_get_max_threads();
+    double c = cycles(prb, alg, isa, nthr);
+    // The implementation may go beyond what the model knows about, e.g. a
+    // direct kernel for a shape the inner product estimate rejects.
+    if (c == infinity) c = direct_cycles(prb, isa, nthr);
+    return c / nominal_frequency;
+}
+
+} // namespace conv_cost_model
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,126 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_CONV_COST_MODEL_HPP
+#define CPU_X64_JIT_CONV_COST_MODEL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/convolution_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Analytical cost model used to resolve alg_kind::convolution_auto and to
+// answer query::time_estimate_f64 for convolutions.
+//
+// The estimates are expressed in core cycles of the slowest thread and take
+// into account the arithmetic throughput of the ISA, the traffic of the
+// intermediate buffers against the per-core cache sizes reported by
+// platform::get_per_core_cache_size() and the load balance across threads.
+// The absolute values are rough; only their ratio is meaningful.
+namespace conv_cost_model {
+
+struct problem_t {
+    problem_t() = default;
+    // Takes the shape from a Winograd jit configuration, the spatial depth
+    // and groups are always trivial there.
+    template <typename conf_t>
+    problem_t(const conf_t &jcp, data_type_t src_dt, bool with_wei_transform)
+        : src_dt(src_dt)
+        , with_wei_transform(with_wei_transform)
+        , mb(jcp.mb)
+        , g(1)
+        , ic(jcp.ic)
+        , oc(jcp.oc)
+        , ih(jcp.ih)
+        , iw(jcp.iw)
+        , oh(jcp.oh)
+        , ow(jcp.ow)
+        , kh(jcp.kh)
+        , kw(jcp.kw)
+        , sh(jcp.stride_h)
+        , sw(jcp.stride_w) {}
+    // Takes the shape from a convolution descriptor, the spatial depth is
+    // folded into the height.
+    problem_t(const convolution_pd_t *pd);
+
+    data_type_t src_dt = data_type::f32;
+    // Winograd weights are transformed on every call rather than reordered
+    // into a wino format ahead of time.
+    bool with_wei_transform = false;
+    int mb = 0, g = 1, ic = 0, oc = 0; // ic and oc are per group
+    int ih = 0, iw = 0, oh = 0, ow = 0;
+    int kh = 0, kw = 0;
+    int sh = 1, sw = 1;
+};
+
+enum class alg_t { direct, brgemm, gemm, ip, winograd };
+const int n_algs = 5;
+
+// Direct convolution with register blocking over output channels and width.
+double direct_cycles(const problem_t &prb, cpu_isa_t isa, int nthr);
+
+// Batch-reduce GEMM over the kernel positions, available starting with
+// avx512_core and using the AMX tiles for bf16 and int8 when present.
+double brgemm_cycles(const problem_t &prb, cpu_isa_t isa, int nthr);
+
+// im2col followed by a GEMM per image and group.
+double gemm_cycles(const problem_t &prb, cpu_isa_t isa, int nthr);
+
+// Inner product, applicable only when the kernel covers the whole unpadded
+// source and the output is a single point.
+double ip_cycles(const problem_t &prb, cpu_isa_t isa, int nthr);
+
+// Winograd convolution F(m x m, kh x kw) computed as alpha * alpha
+// independent GEMMs on transformed tiles, alpha = m + kh - 1.
+double winograd_cycles(
+        const problem_t &prb, int tile_size, cpu_isa_t isa, int nthr);
+
+// Returns the estimate for the algorithm or infinity if the algorithm does
+// not apply to the problem. Winograd uses the output tile size of the jit
+// implementation available on the ISA.
+double DNNL_API cycles(
+        const problem_t &prb, alg_t alg, cpu_isa_t isa, int nthr);
+
+// Fills `order` with the applicable algorithms from the predicted fastest to
+// the predicted slowest and returns their number.
+int DNNL_API rank(
+        const problem_t &prb, cpu_isa_t isa, int nthr, alg_t order[n_algs]);
+
+// Returns true if Winograd with the given output tile size is predicted to
+// be noticeably faster than every other algorithm on the same ISA. Ties are
+// resolved against Winograd as the other algorithms are numerically exact.
+bool is_winograd_fastest(
+        const problem_t &prb, int tile_size, cpu_isa_t isa, int nthr);
+
+// Estimated execution time, in seconds, of the convolution `pd` on the
+// current machine. The algorithm is deduced from the implementation name.
+double time_estimate(const convolution_pd_t *pd);
+
+} // namespace conv_cost_model
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
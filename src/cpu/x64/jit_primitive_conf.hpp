@@ -800,6 +800,35 @@ struct jit_brdgmm_conv_conf_t {
     cpu_isa_t isa;
 };
 
+struct jit_grouped_conv_conf_t {
+    int ndims;
+    int mb, ngroups, ch_per_group;
+    int ch, nb_ch, ch_tail;
+    int id, ih, iw, od, oh, ow;
+    int f_pad, t_pad, l_pad;
+    int kd, kh, kw;
+    int stride_d, stride_h, stride_w;
+    int dilate_d, dilate_h, dilate_w;
+    int ur_w;
+
+    bool with_bias;
+    bool with_sum;
+    bool with_eltwise;
+    bool is_oc_scale;
+    float sum_scale;
+    post_ops_t post_ops;
+
+    data_type_t src_dt;
+    data_type_t wei_dt;
+    data_type_t bia_dt;
+    data_type_t dst_dt;
+
+    size_t src_dsz;
+    size_t wei_dsz;
+    size_t bia_dsz;
+    size_t dst_dsz;
+};
+
 enum conv_brgemm_loop_order_t {
     loop_ndhwgc,
     loop_ngcdhw,
@@ -1017,6 +1046,28 @@ struct jit_reduction_conf_t {
     dim_t idle_size = 0;
     dim_t reduce_size = 0;
 
+    // The source is processed as a dense [outer_size][reduce_size][inner_size]
+    // tensor and the destination as a dense [outer_size][inner_size] one.
+    // With inner_size == 1 the reduction is done within vector registers,
+    // otherwise a call of the kernel accumulates inner_block consecutive
+    // elements over the rows of the reduced dimension.
+    dim_t outer_size = 0;
+    dim_t inner_size = 0;
+    dim_t inner_block = 0;
+    // Number of the reduced elements mean is computed over.
+    dim_t div_size = 0;
+
+    float p = 0.f;
+    float eps = 0.f;
+
+    // With nsplit > 1 the reduced dimension is split into chunks which are
+    // reduced independently into an f32 scratchpad, and then the chunks are
+    // reduced by a second kernel. The first one takes |x|^p of the source
+    // but does not finalize the result; the second one does the opposite.
+    dim_t nsplit = 1;
+    bool transform_src = true;
+    bool finalize = true;
+
     bool is_saturation_needed = false;
 
     post_ops_t post_ops = post_ops_t();
@@ -1030,6 +1081,10 @@ struct jit_reduction_conf_t {
 struct jit_reduction_call_s {
     const void *src = nullptr;
     void *dst = nullptr;
+    // Indices of the values stored to dst by an arg reduction which is not
+    // finalized.
+    void *dst_idx = nullptr;
+    size_t reduce_work = 0;
     const void *post_ops_binary_rhs_arg_vec = nullptr;
     const void *dst_orig = nullptr;
 };
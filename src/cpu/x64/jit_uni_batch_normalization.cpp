@@ -90,6 +90,10 @@ struct jit_bnorm_t : public jit_generator {
     bool is_spatial_thr_;
     bool is_nspc_;
     bool is_bf16_;
+    bool stats_one_pass_;
+    // offset from rbuf1 to the partial sums of squares used by the one-pass
+    // statistics computation
+    size_t sqsum_offt_;
 
     Reg64 reg_param = abi_param1;
 
@@ -576,6 +580,52 @@ struct jit_bnorm_t : public jit_generator {
         }
     }
 
+    // Accumulates sum(src - shift) and sum((src - shift)^2) in a single pass
+    // over src. The shift is a per-channel src value stored in the mean buffer
+    // by the driver; it keeps the sum of squares well conditioned.
+    void mean_var_channels() {
+        Label ch_label;
+        L(ch_label);
+        {
+            uni_vmovups_maybe_tail(vmean, mean_ptr());
+            uni_vmovups(Vmm(0), vmmword[reg_rbuf1 + reg_coff]);
+            uni_vmovups(Vmm(1), vmmword[reg_rbuf1 + reg_coff + sqsum_offt_]);
+            spat_loop(
+                    spat_size, unroll_blocks, unroll_regs,
+                    [=](size_t base_reg) {
+                        Vmm vsum = Vmm(base_reg * 3);
+                        Vmm vsqsum = Vmm(base_reg * 3 + 1);
+                        if (base_reg) {
+                            uni_vpxor(vsum, vsum, vsum);
+                            uni_vpxor(vsqsum, vsqsum, vsqsum);
+                        }
+                    },
+                    [=](size_t base_reg, size_t i) {
+                        Vmm vsum = Vmm(base_reg * 3);
+                        Vmm vsqsum = Vmm(base_reg * 3 + 1);
+                        Vmm vdata = Vmm(base_reg * 3 + 2);
+                        size_t offt = i * vlen_spat_data_;
+                        uni_vmovups_spat_data(
+                                vdata, vmmword[reg_src + reg_soff + offt]);
+                        uni_vsubps(vdata, vdata, vmean);
+                        uni_vaddps(vsum, vsum, vdata);
+                        uni_vfmadd231ps(vsqsum, vdata, vdata);
+                    },
+                    [=](size_t base_reg) {
+                        if (base_reg) {
+                            uni_vaddps(Vmm(0), Vmm(0), Vmm(base_reg * 3));
+                            uni_vaddps(Vmm(1), Vmm(1), Vmm(base_reg * 3 + 1));
+                        }
+                    });
+            uni_vmovups(vmmword[reg_rbuf1 + reg_coff], Vmm(0));
+            uni_vmovups(vmmword[reg_rbuf1 + reg_coff + sqsum_offt_], Vmm(1));
+
+            add(reg_coff, vlen);
+            cmp(reg_coff, reg_coff_max);
+            jl(ch_label);
+        }
+    }
+
     void mean_variance_nspc(
             const int num_ch_blks, int num_spat_pts, bool compute_mean) {
 
@@ -607,10 +657,34 @@ struct jit_bnorm_t : public jit_generator {
             }
         };
 
+        auto mean_variance_compute = [=](int num_ch_blks, int num_spat_pts) {
+            for (int spat_pt = 0; spat_pt < num_spat_pts; ++spat_pt) {
+                for (int ch_idx = 0; ch_idx < num_ch_blks; ++ch_idx) {
+                    const int offt = ch_idx * vlen_spat_data_;
+                    const Vmm vsrc = vtmp;
+                    const Vmm vsqsum_ch = Vmm(ch_idx + num_ch_blks);
+                    const Vmm vshift_ch = Vmm(ch_idx + 2 * num_ch_blks);
+                    uni_vmovups_spat_data(
+                            vsrc, vmmword[reg_src + reg_soff_nspc + offt]);
+                    uni_vsubps(vsrc, vsrc, vshift_ch);
+                    uni_vaddps(Vmm(ch_idx), Vmm(ch_idx), vsrc);
+                    uni_vfmadd231ps(vsqsum_ch, vsrc, vsrc);
+                }
+                add(reg_soff_nspc, spat_step);
+            }
+        };
+
+        const bool one_pass = stats_one_pass_ && compute_mean;
         for (int idx = 0; idx < num_ch_blks; ++idx) {
             const int coff = idx * vlen;
             uni_vmovups(Vmm(idx), vmmword[reg_rbuf1 + reg_coff + coff]);
-            if (!compute_mean) {
+            if (one_pass) {
+                const Vmm vsqsum_ch = Vmm(idx + num_ch_blks);
+                const Vmm vshift_ch = Vmm(idx + 2 * num_ch_blks);
+                uni_vmovups(vsqsum_ch,
+                        vmmword[reg_rbuf1 + reg_coff + coff + sqsum_offt_]);
+                uni_vmovups_maybe_tail(vshift_ch, mean_ptr(coff));
+            } else if (!compute_mean) {
                 // pre-load mean to avoid extra data movement during variance
                 const Vmm vmean_ch = Vmm(idx + num_ch_blks);
                 uni_vmovups_maybe_tail(vmean_ch, mean_ptr(coff));
@@ -634,8 +708,12 @@ struct jit_bnorm_t : public jit_generator {
         Label spatial;
         L(spatial);
         {
-            compute_mean ? mean_compute(num_ch_blks, num_spat_pts)
-                         : variance_compute(num_ch_blks, num_spat_pts);
+            if (one_pass)
+                mean_variance_compute(num_ch_blks, num_spat_pts);
+            else if (compute_mean)
+                mean_compute(num_ch_blks, num_spat_pts);
+            else
+                variance_compute(num_ch_blks, num_spat_pts);
             sub(reg_ctr, num_spat_pts);
             jnz(spatial, T_NEAR);
         }
@@ -643,6 +721,9 @@ struct jit_bnorm_t : public jit_generator {
         for (int idx = 0; idx < num_ch_blks; ++idx) {
             const int coff = idx * vlen;
             uni_vmovups(vmmword[reg_rbuf1 + reg_coff + coff], Vmm(idx));
+            if (one_pass)
+                uni_vmovups(vmmword[reg_rbuf1 + reg_coff + coff + sqsum_offt_],
+                        Vmm(idx + num_ch_blks));
         }
     }
 
@@ -751,7 +832,9 @@ struct jit_bnorm_t : public jit_generator {
         mov(reg_coff_max_fwd_copy, reg_coff_max);
 
         Label ch_unroll_label[5];
-        const int max_ch_unroll = 4;
+        // one-pass statistics keep sums, sums of squares and shifts in
+        // registers, so fewer channel blocks fit at once
+        const int max_ch_unroll = stats_one_pass_ && compute_mean ? 3 : 4;
 
         // TODO: Spatial and channel unrolling decisions should be made during
         // initialization depending on the problem size
@@ -822,6 +905,55 @@ struct jit_bnorm_t : public jit_generator {
         }
     }
 
+    // Reduces the shifted partial sums of all threads:
+    //   mean = shift + S1 / n, var = max(S2 / n - (S1 / n)^2, 0)
+    void mean_variance_reduction() {
+        Label no_reduction;
+        barrier();
+        {
+            mov(reg_tmp, ptr[rsp + stack_off_N_ithr]);
+            cmp(reg_tmp, 0);
+            jne(no_reduction);
+            mov(reg_nnthr, ptr[rsp + stack_off_N_nthr]);
+            xor_(reg_coff, reg_coff);
+            Label reduction_channels;
+            L(reduction_channels);
+            {
+                mov(reg_roff, reg_coff);
+                uni_vpxor(Vmm(1), Vmm(1), Vmm(1));
+                uni_vpxor(Vmm(2), Vmm(2), Vmm(2));
+                mov(reg_ctr, reg_nnthr);
+                Label reduction_thrs;
+                L(reduction_thrs);
+                {
+                    uni_vaddps(Vmm(1), Vmm(1), vmmword[reg_rbuf1 + reg_roff]);
+                    uni_vaddps(Vmm(2), Vmm(2),
+                            vmmword[reg_rbuf1 + reg_roff + sqsum_offt_]);
+                    add(reg_roff, reg_coff_max);
+                    sub(reg_ctr, 1);
+                    jnz(reduction_thrs);
+                }
+                uni_vdivps(Vmm(1), Vmm(1), vchan_size);
+                uni_vdivps(Vmm(2), Vmm(2), vchan_size);
+                uni_vmulps(Vmm(3), Vmm(1), Vmm(1));
+                uni_vsubps(Vmm(2), Vmm(2), Vmm(3));
+                uni_vpxor(Vmm(3), Vmm(3), Vmm(3));
+                uni_vmaxps(Vmm(2), Vmm(2), Vmm(3));
+                uni_vmovups_maybe_tail(var_ptr(), Vmm(2));
+
+                uni_vmovups_maybe_tail(vmean, mean_ptr());
+                uni_vaddps(Vmm(1), Vmm(1), vmean);
+                uni_vmovups_maybe_tail(mean_ptr(), Vmm(1));
+
+                add(reg_coff, isa == sse41 ? vlen / 2 : vlen);
+                cmp(reg_coff, reg_coff_max);
+                jl(reduction_channels);
+            }
+        }
+        L(no_reduction);
+        barrier();
+    }
+
     void compute_mean_variance() {
         uni_vpxor(Vmm(0), Vmm(0), Vmm(0));
         xor_(reg_coff, reg_coff);
@@ -829,6 +961,9 @@ struct jit_bnorm_t : public jit_generator {
         L(zero_rbuf);
         {
             uni_vmovups(vmmword[reg_rbuf1 + reg_coff], Vmm(0));
+            if (stats_one_pass_)
+                uni_vmovups(
+                        vmmword[reg_rbuf1 + reg_coff + sqsum_offt_], Vmm(0));
             add(reg_coff, isa == sse41 ? vlen / 2 : vlen);
             cmp(reg_coff, reg_coff_max);
             jne(zero_rbuf);
@@ -844,14 +979,17 @@ struct jit_bnorm_t : public jit_generator {
 
             if (isa == sse41) mov(reg_tmp_off, reg_soff);
 
-            is_nspc_ ? compute_mean_variance_nspc() : mean_channels();
+            if (is_nspc_)
+                compute_mean_variance_nspc();
+            else
+                stats_one_pass_ ? mean_var_channels() : mean_channels();
 
             if (isa == sse41) {
                 mov(reg_soff, reg_tmp_off);
                 add(reg_src, vlen / 2);
                 mov(reg_coff, vlen / 2);
 
-                mean_channels();
+                stats_one_pass_ ? mean_var_channels() : mean_channels();
 
                 sub(reg_src, vlen / 2);
             }
@@ -871,6 +1009,11 @@ struct jit_bnorm_t : public jit_generator {
 
         if (is_nspc_) mov(reg_src, ptr[rsp + stack_off_src]); // comeback
 
+        if (stats_one_pass_) {
+            mean_variance_reduction();
+            return;
+        }
+
         Label no_mean_reduction;
         barrier();
         {
@@ -1746,7 +1889,7 @@ struct jit_bnorm_t : public jit_generator {
         }
     }
 
-    jit_bnorm_t(const batch_normalization_pd_t *bdesc)
+    jit_bnorm_t(const batch_normalization_pd_t *bdesc, int nthr)
         : jit_generator(jit_name()), bdesc_(bdesc) {
         static_assert(isa == sse41 || isa == avx2 || isa == avx512_core,
                 "unsupported isa");
@@ -1763,6 +1906,10 @@ struct jit_bnorm_t : public jit_generator {
                 bdesc_, is_nspc_, simd_w, dt_size);
         vlen_spat_data_ = vlen / (1 + is_bf16_); // 32B of BF16 -> 64B of FP32
 
+        stats_one_pass_ = bnorm_utils::use_stats_one_pass(bdesc_);
+        const dim_t C_PADDED = src_d.padded_dims()[1];
+        sqsum_offt_ = C_PADDED * nthr * sizeof(acc_data_t);
+
         unroll_blocks = isa == avx512_core && !is_spatial_thr_ ? 4 : 1;
         unroll_regs = isa == avx512_core && !is_spatial_thr_ ? 4 : 1;
     }
@@ -1812,7 +1959,7 @@ namespace bnorm_impl {
 template <cpu_isa_t isa>
 struct driver_t : public c_compatible {
     driver_t(const batch_normalization_pd_t *bdesc, int nthr)
-        : bdesc_(bdesc), ker_(bdesc_) {
+        : bdesc_(bdesc), ker_(bdesc_, nthr) {
         const dim_t C_PADDED = get_c_padded(bdesc_);
 
         const memory_desc_wrapper src_d(bdesc_->src_md());
@@ -1837,7 +1984,9 @@ struct driver_t : public c_compatible {
         auto sbuf_sz = use_tmp_stats(bdesc) * 2 * C_PADDED;
         auto pbuf_sz = (use_tmp_diff_scale(bdesc) + use_tmp_diff_shift(bdesc))
                 * C_PADDED;
-        auto rbuf_sz = (bdesc->is_fwd() ? 1 : 2) * C_PADDED * nthr;
+        const bool two_rbufs
+                = bdesc->is_bwd() || bnorm_utils::use_stats_one_pass(bdesc);
+        auto rbuf_sz = (two_rbufs ? 2 : 1) * C_PADDED * nthr;
 
         scratchpad.book<acc_data_t>(key_bnorm_tmp_stats, sbuf_sz);
         scratchpad.book<acc_data_t>(key_bnorm_tmp_diff_ss, pbuf_sz);
@@ -2101,6 +2250,15 @@ struct driver_t : public c_compatible {
         }
     }
 
+    // One-pass statistics read the per-channel shift from the mean buffer
+    void init_stats_shift(const void *src, acc_data_t *mean,
+            const memory_tracking::grantor_t &scratchpad) {
+        if (!bnorm_utils::use_stats_one_pass(bdesc_)) return;
+        auto sbuf = scratchpad.get<acc_data_t>(key_bnorm_tmp_stats);
+        bnorm_utils::init_stats_shift(
+                bdesc_, src, use_tmp_stats(bdesc_) ? sbuf : mean);
+    }
+
     status_t create_kernel() { return ker_.create_kernel(); }
 
 private:
@@ -2239,6 +2397,7 @@ status_t jit_uni_batch_normalization_fwd_t<isa>::execute(
     auto scratchpad = ctx.get_scratchpad_grantor();
 
     bnorm_driver_->init_barriers(scratchpad);
+    bnorm_driver_->init_stats_shift(src, mean, scratchpad);
     const int nthr = pd()->nthr_;
 
     parallel(nthr, [&](const int ithr, const int nthr) {
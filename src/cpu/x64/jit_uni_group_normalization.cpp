@@ -0,0 +1,783 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/jit_uni_group_normalization.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace memory_tracking::names;
+using namespace Xbyak;
+using namespace Xbyak::util;
+
+namespace gnorm_impl {
+
+/* Common part of the statistics and the apply kernels.
+ *
+ * Channels-innermost layouts are processed as `work` rows of `row_len`
+ * elements, every element of a row belonging to its own channel. For ncsp a
+ * kernel call processes `work` contiguous spatial points of one channel and the
+ * per-channel values are broadcast. */
+template <cpu_isa_t isa>
+struct jit_gnorm_base_t : public jit_generator {
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    jit_gnorm_base_t(const char *name, bool is_ncsp, dim_t row_len,
+            data_type_t dt)
+        : jit_generator(name)
+        , is_ncsp_(is_ncsp)
+        , row_len_(row_len)
+        , is_bf16_(dt == data_type::bf16)
+        , dt_size_(types::data_type_size(dt)) {}
+
+protected:
+    static constexpr int simd_w_ = cpu_isa_traits<isa>::vlen / sizeof(float);
+    // number of vectors processed at once
+    static constexpr int unroll_ = isa == avx512_core ? 8 : 4;
+
+    const bool is_ncsp_;
+    const dim_t row_len_;
+    const bool is_bf16_;
+    const size_t dt_size_;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_tmp = rax;
+
+    // Loads `simd_w_` or a single element (the rest of the vector is zeroed)
+    // converting it to f32
+    void load_src(const Vmm &vmm, const Address &addr, bool scalar) {
+        const Xmm xmm(vmm.getIdx());
+        if (is_bf16_) {
+            if (scalar) {
+                movzx(reg_tmp.cvt32(), addr);
+                shl(reg_tmp.cvt32(), 16);
+                vmovd(xmm, reg_tmp.cvt32());
+            } else {
+                vpmovzxwd(vmm, addr);
+                vpslld(vmm, vmm, 16);
+            }
+        } else {
+            if (scalar)
+                uni_vmovss(xmm, addr);
+            else
+                uni_vmovups(vmm, addr);
+        }
+    }
+
+    Address data_ptr(const Reg64 &reg, dim_t elems) {
+        const dim_t off = elems * dt_size_;
+        return is_bf16_ ? word[reg + off] : dword[reg + off];
+    }
+    Address vdata_ptr(const Reg64 &reg, dim_t elems) {
+        return ptr[reg + elems * dt_size_];
+    }
+};
+
+template <cpu_isa_t isa>
+struct jit_stat_kernel_t : public jit_gnorm_base_t<isa> {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_stat_kernel_t)
+
+    using base_t = jit_gnorm_base_t<isa>;
+    using Vmm = typename base_t::Vmm;
+
+    struct call_params_t {
+        const void *src;
+        // values subtracted from src before accumulation
+        const float *shift;
+        // sums of (src - shift) and of (src - shift)^2
+        float *sum;
+        float *sqsum;
+        size_t work;
+    };
+
+    jit_stat_kernel_t(bool is_ncsp, dim_t row_len, data_type_t dt)
+        : base_t(jit_name(), is_ncsp, row_len, dt) {}
+
+    void operator()(const call_params_t *p) { jit_generator::operator()(p); }
+
+private:
+    using base_t::is_ncsp_;
+    using base_t::reg_param;
+    using base_t::row_len_;
+    using base_t::simd_w_;
+    using base_t::unroll_;
+
+    const Reg64 reg_src = r8;
+    const Reg64 reg_shift = r9;
+    const Reg64 reg_sum = r10;
+    const Reg64 reg_sqsum = r11;
+    const Reg64 reg_work = r12;
+    const Reg64 reg_ptr = r13;
+    const Reg64 reg_cnt = r14;
+
+    Vmm vmm_sum(int i) { return Vmm(i); }
+    Vmm vmm_sqsum(int i) { return Vmm(unroll_ + i); }
+    Vmm vmm_shift(int i) { return Vmm(2 * unroll_ + i); }
+    Vmm vmm_data() { return Vmm(3 * unroll_); }
+
+    void accumulate(int i, const Vmm &vmm_sh, const Address &addr,
+            bool scalar) {
+        const Vmm v = vmm_data();
+        this->load_src(v, addr, scalar);
+        // keep the unused lanes of a scalar zero
+        if (scalar)
+            this->vsubss(Xmm(v.getIdx()), Xmm(v.getIdx()),
+                    Xmm(vmm_sh.getIdx()));
+        else
+            this->uni_vsubps(v, v, vmm_sh);
+        this->uni_vaddps(vmm_sum(i), vmm_sum(i), v);
+        this->uni_vfmadd231ps(vmm_sqsum(i), v, v);
+    }
+
+    // Accumulates `n` vectors (or scalars) of a row starting from element
+    // `e_start` over all rows
+    void compute_rows(dim_t e_start, int n, bool scalar) {
+        const int step = scalar ? 1 : simd_w_;
+        for (int i = 0; i < n; i++) {
+            const auto off = (e_start + i * step) * sizeof(float);
+            this->uni_vpxor(vmm_sum(i), vmm_sum(i), vmm_sum(i));
+            this->uni_vpxor(vmm_sqsum(i), vmm_sqsum(i), vmm_sqsum(i));
+            if (scalar)
+                this->uni_vmovss(
+                        Xmm(vmm_shift(i).getIdx()), ptr[reg_shift + off]);
+            else
+                this->uni_vmovups(vmm_shift(i), ptr[reg_shift + off]);
+        }
+
+        Label row_loop;
+        this->mov(reg_ptr, reg_src);
+        this->mov(reg_cnt, reg_work);
+        this->L(row_loop);
+        {
+            for (int i = 0; i < n; i++) {
+                const dim_t e = e_start + i * step;
+                accumulate(i, vmm_shift(i),
+                        scalar ? this->data_ptr(reg_ptr, e)
+                               : this->vdata_ptr(reg_ptr, e),
+                        scalar);
+            }
+            this->add(reg_ptr, row_len_ * this->dt_size_);
+            this->dec(reg_cnt);
+            this->jnz(row_loop, this->T_NEAR);
+        }
+
+        for (int i = 0; i < n; i++) {
+            const auto off = (e_start + i * step) * sizeof(float);
+            if (scalar) {
+                this->uni_vmovss(ptr[reg_sum + off], Xmm(vmm_sum(i).getIdx()));
+                this->uni_vmovss(
+                        ptr[reg_sqsum + off], Xmm(vmm_sqsum(i).getIdx()));
+            } else {
+                this->uni_vmovups(ptr[reg_sum + off], vmm_sum(i));
+                this->uni_vmovups(ptr[reg_sqsum + off], vmm_sqsum(i));
+            }
+        }
+    }
+
+    void generate_rows() {
+        const dim_t n_vecs = row_len_ / simd_w_;
+        for (dim_t v = 0; v < n_vecs; v += unroll_)
+            compute_rows(v * simd_w_, nstl::min<dim_t>(unroll_, n_vecs - v),
+                    false);
+        for (dim_t e = n_vecs * simd_w_; e < row_len_; e += unroll_)
+            compute_rows(e, nstl::min<dim_t>(unroll_, row_len_ - e), true);
+    }
+
+    // Horizontal sum of the vector, the result is in the lowest lane
+    void reduce(const Vmm &vmm, const Vmm &vmm_aux) {
+        if (isa == avx512_core) {
+            this->vextractf64x4(Ymm(vmm_aux.getIdx()), Zmm(vmm.getIdx()), 1);
+            this->vaddps(Ymm(vmm.getIdx()), Ymm(vmm.getIdx()),
+                    Ymm(vmm_aux.getIdx()));
+        }
+        const Xmm xmm(vmm.getIdx()), xmm_aux(vmm_aux.getIdx());
+        this->vextractf128(xmm_aux, Ymm(vmm.getIdx()), 1);
+        this->vaddps(xmm, xmm, xmm_aux);
+        this->vhaddps(xmm, xmm, xmm);
+        this->vhaddps(xmm, xmm, xmm);
+    }
+
+    void generate_ncsp() {
+        const auto vlen_data = simd_w_ * this->dt_size_;
+        const Vmm vmm_sh = vmm_shift(0);
+
+        this->uni_vbroadcastss(vmm_sh, ptr[reg_shift]);
+        for (int i = 0; i < unroll_; i++) {
+            this->uni_vpxor(vmm_sum(i), vmm_sum(i), vmm_sum(i));
+            this->uni_vpxor(vmm_sqsum(i), vmm_sqsum(i), vmm_sqsum(i));
+        }
+
+        Label unroll_loop, vec_loop, scalar_loop, done;
+        this->mov(reg_ptr, reg_src);
+        this->mov(reg_cnt, reg_work);
+
+        this->L(unroll_loop);
+        {
+            this->cmp(reg_cnt, unroll_ * simd_w_);
+            this->jl(vec_loop, this->T_NEAR);
+            for (int i = 0; i < unroll_; i++)
+                accumulate(i, vmm_sh,
+                        this->vdata_ptr(reg_ptr, i * simd_w_), false);
+            this->add(reg_ptr, unroll_ * vlen_data);
+            this->sub(reg_cnt, unroll_ * simd_w_);
+            this->jmp(unroll_loop);
+        }
+
+        this->L(vec_loop);
+        {
+            this->cmp(reg_cnt, simd_w_);
+            this->jl(scalar_loop, this->T_NEAR);
+            accumulate(0, vmm_sh, this->vdata_ptr(reg_ptr, 0), false);
+            this->add(reg_ptr, vlen_data);
+            this->sub(reg_cnt, simd_w_);
+            this->jmp(vec_loop);
+        }
+
+        this->L(scalar_loop);
+        {
+            this->cmp(reg_cnt, 0);
+            this->jle(done, this->T_NEAR);
+            accumulate(0, vmm_sh, this->data_ptr(reg_ptr, 0), true);
+            this->add(reg_ptr, this->dt_size_);
+            this->dec(reg_cnt);
+            this->jmp(scalar_loop);
+        }
+        this->L(done);
+
+        for (int i = 1; i < unroll_; i++) {
+            this->uni_vaddps(vmm_sum(0), vmm_sum(0), vmm_sum(i));
+            this->uni_vaddps(vmm_sqsum(0), vmm_sqsum(0), vmm_sqsum(i));
+        }
+        reduce(vmm_sum(0), vmm_sum(1));
+        reduce(vmm_sqsum(0), vmm_sum(1));
+        this->uni_vmovss(ptr[reg_sum], Xmm(vmm_sum(0).getIdx()));
+        this->uni_vmovss(ptr[reg_sqsum], Xmm(vmm_sqsum(0).getIdx()));
+    }
+
+    void generate() override {
+        this->preamble();
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        this->mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        this->mov(reg_shift, ptr[reg_param + PARAM_OFF(shift)]);
+        this->mov(reg_sum, ptr[reg_param + PARAM_OFF(sum)]);
+        this->mov(reg_sqsum, ptr[reg_param + PARAM_OFF(sqsum)]);
+        this->mov(reg_work, ptr[reg_param + PARAM_OFF(work)]);
+#undef PARAM_OFF
+        if (is_ncsp_)
+            generate_ncsp();
+        else
+            generate_rows();
+        this->postamble();
+    }
+};
+
+template <cpu_isa_t isa>
+struct jit_apply_kernel_t : public jit_gnorm_base_t<isa> {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_apply_kernel_t)
+
+    using base_t = jit_gnorm_base_t<isa>;
+    using Vmm = typename base_t::Vmm;
+
+    struct call_params_t {
+        const void *src;
+        void *dst;
+        // dst = src * scale + shift
+        const float *scale;
+        const float *shift;
+        size_t work;
+    };
+
+    jit_apply_kernel_t(bool is_ncsp, dim_t row_len, data_type_t dt,
+            const post_ops_t &post_ops)
+        : base_t(jit_name(), is_ncsp, row_len, dt) {
+        for (int i = 0; i < post_ops.len(); i++) {
+            const auto &e = post_ops.entry_[i];
+            assert(e.is_eltwise());
+            eltwise_injectors_.emplace_back(
+                    new jit_uni_eltwise_injector_f32<isa>(this, e.eltwise,
+                            true, reg_table, Opmask(1)));
+        }
+        if (this->is_bf16_ && !mayiuse(avx512_core_bf16))
+            bf16_emu_ = utils::make_unique<bf16_emulation_t>(this,
+                    bf16_emu_reserved_1, bf16_emu_reserved_2,
+                    bf16_emu_reserved_3, reg_bf16_tmp, bf16_emu_reserved_4);
+    }
+
+    void operator()(const call_params_t *p) { jit_generator::operator()(p); }
+
+private:
+    using base_t::is_ncsp_;
+    using base_t::reg_param;
+    using base_t::row_len_;
+    using base_t::simd_w_;
+    using base_t::unroll_;
+
+    const Reg64 reg_src = r8;
+    const Reg64 reg_dst = r9;
+    const Reg64 reg_scale = r10;
+    const Reg64 reg_shift = r11;
+    const Reg64 reg_work = r12;
+    const Reg64 reg_cnt = r13;
+    const Reg64 reg_table = rbx;
+    const Reg64 reg_bf16_tmp = r15;
+
+    const Zmm bf16_emu_reserved_1 = Zmm(28);
+    const Zmm bf16_emu_reserved_2 = Zmm(29);
+    const Zmm bf16_emu_reserved_3 = Zmm(30);
+    const Zmm bf16_emu_reserved_4 = Zmm(31);
+
+    std::vector<std::unique_ptr<jit_uni_eltwise_injector_f32<isa>>>
+            eltwise_injectors_;
+    std::unique_ptr<bf16_emulation_t> bf16_emu_;
+
+    Vmm vmm_data(int i) { return Vmm(i); }
+    Vmm vmm_scale() { return Vmm(unroll_); }
+    Vmm vmm_shift() { return Vmm(unroll_ + 1); }
+
+    void store_dst(const Reg64 &reg, dim_t elems, const Vmm &vmm,
+            bool scalar) {
+        const Xmm xmm(vmm.getIdx());
+        if (this->is_bf16_) {
+            const Ymm ymm(vmm.getIdx());
+            if (bf16_emu_)
+                bf16_emu_->vcvtneps2bf16(ymm, Zmm(vmm.getIdx()));
+            else
+                this->vcvtneps2bf16(ymm, Zmm(vmm.getIdx()));
+            if (scalar)
+                this->vpextrw(this->data_ptr(reg, elems), xmm, 0);
+            else
+                this->vmovdqu16(this->vdata_ptr(reg, elems), ymm);
+        } else {
+            if (scalar)
+                this->uni_vmovss(this->data_ptr(reg, elems), xmm);
+            else
+                this->uni_vmovups(this->vdata_ptr(reg, elems), vmm);
+        }
+    }
+
+    void apply_post_ops(int n) {
+        for (auto &inj : eltwise_injectors_)
+            inj->compute_vector_range(0, n);
+    }
+
+    // Transforms `n` vectors (or scalars) starting from element `e_start`
+    // of the current row
+    void compute_row(dim_t e_start, int n, bool scalar) {
+        const int step = scalar ? 1 : simd_w_;
+        for (int i = 0; i < n; i++) {
+            const dim_t e = e_start + i * step;
+            const auto off = e * sizeof(float);
+            const Vmm v = vmm_data(i);
+            this->load_src(v,
+                    scalar ? this->data_ptr(reg_src, e)
+                           : this->vdata_ptr(reg_src, e),
+                    scalar);
+            if (scalar) {
+                this->uni_vmovss(Xmm(vmm_scale().getIdx()),
+                        ptr[reg_scale + off]);
+                this->uni_vmovss(Xmm(vmm_shift().getIdx()),
+                        ptr[reg_shift + off]);
+            } else {
+                this->uni_vmovups(vmm_scale(), ptr[reg_scale + off]);
+                this->uni_vmovups(vmm_shift(), ptr[reg_shift + off]);
+            }
+            this->uni_vfmadd213ps(v, vmm_scale(), vmm_shift());
+        }
+        apply_post_ops(n);
+        for (int i = 0; i < n; i++)
+            store_dst(reg_dst, e_start + i * step, vmm_data(i), scalar);
+    }
+
+    void generate_rows() {
+        const dim_t n_vecs = row_len_ / simd_w_;
+        Label row_loop;
+        this->mov(reg_cnt, reg_work);
+        this->L(row_loop);
+        {
+            for (dim_t v = 0; v < n_vecs; v += unroll_)
+                compute_row(v * simd_w_,
+                        nstl::min<dim_t>(unroll_, n_vecs - v), false);
+            for (dim_t e = n_vecs * simd_w_; e < row_len_; e += unroll_)
+                compute_row(e, nstl::min<dim_t>(unroll_, row_len_ - e), true);
+            this->add(reg_src, row_len_ * this->dt_size_);
+            this->add(reg_dst, row_len_ * this->dt_size_);
+            this->dec(reg_cnt);
+            this->jnz(row_loop, this->T_NEAR);
+        }
+    }
+
+    // Transforms `n` vectors (or a scalar) of a channel with the broadcast
+    // scale and shift
+    void compute_ncsp(int n, bool scalar) {
+        for (int i = 0; i < n; i++) {
+            const Vmm v = vmm_data(i);
+            this->load_src(v,
+                    scalar ? this->data_ptr(reg_src, 0)
+                           : this->vdata_ptr(reg_src, i * simd_w_),
+                    scalar);
+            this->uni_vfmadd213ps(v, vmm_scale(), vmm_shift());
+        }
+        apply_post_ops(n);
+        for (int i = 0; i < n; i++)
+            store_dst(reg_dst, i * simd_w_, vmm_data(i), scalar);
+    }
+
+    void generate_ncsp() {
+        const auto vlen_data = simd_w_ * this->dt_size_;
+        this->uni_vbroadcastss(vmm_scale(), ptr[reg_scale]);
+        this->uni_vbroadcastss(vmm_shift(), ptr[reg_shift]);
+
+        Label unroll_loop, vec_loop, scalar_loop, done;
+        this->mov(reg_cnt, reg_work);
+
+        this->L(unroll_loop);
+        {
+            this->cmp(reg_cnt, unroll_ * simd_w_);
+            this->jl(vec_loop, this->T_NEAR);
+            compute_ncsp(unroll_, false);
+            this->add(reg_src, unroll_ * vlen_data);
+            this->add(reg_dst, unroll_ * vlen_data);
+            this->sub(reg_cnt, unroll_ * simd_w_);
+            this->jmp(unroll_loop);
+        }
+
+        this->L(vec_loop);
+        {
+            this->cmp(reg_cnt, simd_w_);
+            this->jl(scalar_loop, this->T_NEAR);
+            compute_ncsp(1, false);
+            this->add(reg_src, vlen_data);
+            this->add(reg_dst, vlen_data);
+            this->sub(reg_cnt, simd_w_);
+            this->jmp(vec_loop);
+        }
+
+        this->L(scalar_loop);
+        {
+            this->cmp(reg_cnt, 0);
+            this->jle(done, this->T_NEAR);
+            compute_ncsp(1, true);
+            this->add(reg_src, this->dt_size_);
+            this->add(reg_dst, this->dt_size_);
+            this->dec(reg_cnt);
+            this->jmp(scalar_loop);
+        }
+        this->L(done);
+    }
+
+    void generate() override {
+        this->preamble();
+        if (bf16_emu_) bf16_emu_->init_vcvtneps2bf16();
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        this->mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        this->mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+        this->mov(reg_scale, ptr[reg_param + PARAM_OFF(scale)]);
+        this->mov(reg_shift, ptr[reg_param + PARAM_OFF(shift)]);
+        this->mov(reg_work, ptr[reg_param + PARAM_OFF(work)]);
+#undef PARAM_OFF
+        if (is_ncsp_)
+            generate_ncsp();
+        else
+            generate_rows();
+        this->postamble();
+
+        for (auto &inj : eltwise_injectors_)
+            inj->prepare_table();
+    }
+};
+
+} // namespace gnorm_impl
+
+using namespace data_type;
+using namespace format_tag;
+using namespace utils;
+
+template <cpu_isa_t isa>
+status_t jit_uni_group_normalization_fwd_t<isa>::pd_t::init(
+        engine_t *engine) {
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+    const auto src_dt = src_md()->data_type;
+
+    bool ok = mayiuse(isa) && is_fwd() && !has_zero_dim_memory()
+            && one_of(src_dt, f32, bf16) && dst_md()->data_type == src_dt
+            && IMPLICATION(src_dt == bf16, isa == avx512_core)
+            && stat_md()->data_type == f32 && check_scale_shift_data_type()
+            && attr()->has_default_values(skip_mask_t::post_ops)
+            && set_default_formats_common();
+    if (!ok) return status::unimplemented;
+
+    const auto &po = attr()->post_ops_;
+    for (int i = 0; i < po.len(); i++)
+        if (!po.entry_[i].is_eltwise()
+                || !eltwise_injector::is_supported(
+                        isa, po.entry_[i].eltwise.alg))
+            return status::unimplemented;
+
+    const int nd = ndims();
+    const auto ncsp_tag = pick(nd - 3, ncw, nchw, ncdhw);
+    const auto nspc_tag = pick(nd - 3, nwc, nhwc, ndhwc);
+    const auto blk16_tag = pick(nd - 3, nCw16c, nChw16c, nCdhw16c);
+    const auto blk8_tag = pick(nd - 3, nCw8c, nChw8c, nCdhw8c);
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    const auto tag = src_d.matches_one_of_tag(
+            ncsp_tag, nspc_tag, blk16_tag, blk8_tag);
+    if (tag == format_tag::undef || dst_d.matches_one_of_tag(tag) != tag)
+        return status::unimplemented;
+
+    constexpr dim_t simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    is_ncsp_ = tag == ncsp_tag;
+    if (tag == ncsp_tag) {
+        c_blk_ = 1;
+        nb_c_ = C();
+    } else if (tag == nspc_tag) {
+        c_blk_ = C();
+        nb_c_ = 1;
+    } else {
+        c_blk_ = tag == blk16_tag ? 16 : 8;
+        // padded channels would be polluted by the post-ops
+        if (c_blk_ % simd_w != 0 || C() % c_blk_ != 0)
+            return status::unimplemented;
+        nb_c_ = C() / c_blk_;
+    }
+
+    init_work_split();
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_group_normalization_fwd_t<isa>::pd_t::init_work_split() {
+    constexpr dim_t simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    const int nthr = dnnl_get_max_threads();
+    const dim_t SP = D() * H() * W();
+    const dim_t n_units = MB() * nb_c_;
+
+    // Enough chunks to occupy all threads. For the channels-innermost layouts
+    // the statistics kernel walks through the rows of a chunk once per group
+    // of vectors, so the chunk is also kept within the L2 cache.
+    dim_t n_chunks = nstl::min(SP, div_up((dim_t)nthr, n_units));
+    if (!is_ncsp_) {
+        const dim_t row_size
+                = c_blk_ * types::data_type_size(src_md()->data_type);
+        const dim_t max_rows = nstl::max((dim_t)1,
+                (dim_t)platform::get_per_core_cache_size(2) / 2 / row_size);
+        n_chunks = nstl::max(n_chunks, div_up(SP, max_rows));
+    }
+    sp_chunk_ = div_up(SP, n_chunks);
+    // avoid scalar tails in the middle of a channel
+    if (is_ncsp_) sp_chunk_ = nstl::min(SP, rnd_up(sp_chunk_, simd_w));
+    n_sp_chunks_ = div_up(SP, sp_chunk_);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_group_normalization_fwd_t<isa>::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    if (!stats_are_src()) {
+        scratchpad.template book<float>(key_gnorm_shift, MB() * C());
+        scratchpad.template book<float>(
+                key_gnorm_reduction, 2 * MB() * n_sp_chunks_ * C());
+    }
+    if (stats_are_tmp()) {
+        scratchpad.template book<float>(key_gnorm_tmp_mean, MB() * G());
+        scratchpad.template book<float>(key_gnorm_tmp_var, MB() * G());
+    }
+    scratchpad.template book<float>(key_gnorm_affine, 2 * MB() * C());
+}
+
+template <cpu_isa_t isa>
+jit_uni_group_normalization_fwd_t<isa>::jit_uni_group_normalization_fwd_t(
+        const pd_t *apd)
+    : primitive_t(apd) {}
+
+template <cpu_isa_t isa>
+jit_uni_group_normalization_fwd_t<
+        isa>::~jit_uni_group_normalization_fwd_t() = default;
+
+template <cpu_isa_t isa>
+status_t jit_uni_group_normalization_fwd_t<isa>::init(engine_t *engine) {
+    const auto dt = pd()->src_md()->data_type;
+    if (!pd()->stats_are_src()) {
+        CHECK(safe_ptr_assign(stat_kernel_,
+                new gnorm_impl::jit_stat_kernel_t<isa>(
+                        pd()->is_ncsp_, pd()->c_blk_, dt)));
+        CHECK(stat_kernel_->create_kernel());
+    }
+    CHECK(safe_ptr_assign(apply_kernel_,
+            new gnorm_impl::jit_apply_kernel_t<isa>(pd()->is_ncsp_,
+                    pd()->c_blk_, dt, pd()->attr()->post_ops_)));
+    return apply_kernel_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_group_normalization_fwd_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper stat_d(pd()->stat_md());
+    const size_t dt_size = src_d.data_type_size();
+
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC)
+            + src_d.offset0() * dt_size;
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST) + dst_d.offset0() * dt_size;
+    auto scale = pd()->use_scale() ? CTX_IN_MEM(const float *, DNNL_ARG_SCALE)
+                                   : nullptr;
+    auto shift = pd()->use_shift() ? CTX_IN_MEM(const float *, DNNL_ARG_SHIFT)
+                                   : nullptr;
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    float *mean, *variance;
+    if (pd()->stats_are_src()) {
+        mean = const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_MEAN));
+        variance = const_cast<float *>(
+                CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE));
+    } else if (pd()->stats_are_tmp()) {
+        mean = scratchpad.template get<float>(key_gnorm_tmp_mean);
+        variance = scratchpad.template get<float>(key_gnorm_tmp_var);
+    } else {
+        mean = CTX_OUT_MEM(float *, DNNL_ARG_MEAN);
+        variance = CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE);
+    }
+
+    const bool is_ncsp = pd()->is_ncsp_;
+    const dim_t N = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t G = pd()->G();
+    const dim_t C_per_G = C / G;
+    const dim_t SP = pd()->D() * pd()->H() * pd()->W();
+    const dim_t c_blk = pd()->c_blk_;
+    const dim_t nb_c = pd()->nb_c_;
+    const dim_t sp_chunk = pd()->sp_chunk_;
+    const dim_t n_sp_chunks = pd()->n_sp_chunks_;
+    const float eps = pd()->desc()->group_norm_epsilon;
+
+    // offset of the spatial point `sp` of the channel (ncsp) or of the block
+    // of channels `cb`
+    const auto data_off = [&](dim_t n, dim_t cb, dim_t sp) {
+        return is_ncsp ? (n * C + cb) * SP + sp
+                       : ((n * nb_c + cb) * SP + sp) * c_blk;
+    };
+    const auto load_f32 = [&](dim_t off) {
+        return src_d.data_type() == bf16
+                ? (float)reinterpret_cast<const bfloat16_t *>(src)[off]
+                : reinterpret_cast<const float *>(src)[off];
+    };
+
+    float *scales = scratchpad.template get<float>(key_gnorm_affine);
+    float *shifts = scales + N * C;
+
+    if (!pd()->stats_are_src()) {
+        float *ch_shift = scratchpad.template get<float>(key_gnorm_shift);
+        float *sum = scratchpad.template get<float>(key_gnorm_reduction);
+        float *sqsum = sum + N * n_sp_chunks * C;
+
+        // The first value of every channel is close enough to the mean to
+        // keep the shifted sums well conditioned
+        parallel_nd(N, C, [&](dim_t n, dim_t c) {
+            ch_shift[n * C + c] = load_f32(
+                    data_off(n, c / c_blk, 0) + (is_ncsp ? 0 : c % c_blk));
+        });
+
+        parallel_nd(N, nb_c, n_sp_chunks, [&](dim_t n, dim_t cb, dim_t k) {
+            const dim_t sp = k * sp_chunk;
+            const dim_t c = cb * c_blk;
+            const dim_t red_off = (n * n_sp_chunks + k) * C + c;
+            typename gnorm_impl::jit_stat_kernel_t<isa>::call_params_t p;
+            p.src = src + data_off(n, cb, sp) * dt_size;
+            p.shift = &ch_shift[n * C + c];
+            p.sum = &sum[red_off];
+            p.sqsum = &sqsum[red_off];
+            p.work = nstl::min(sp_chunk, SP - sp);
+            (*stat_kernel_)(&p);
+        });
+
+        parallel_nd(N, G, [&](dim_t n, dim_t g) {
+            // Channel statistics are combined into the group ones with the
+            // parallel variance formula. The channel means are kept in the
+            // affine buffer until it is filled below.
+            float *ch_mean = &scales[n * C];
+            float group_mean = 0, m2 = 0;
+            for (dim_t c = g * C_per_G; c < (g + 1) * C_per_G; c++) {
+                float s = 0, sq = 0;
+                for (dim_t k = 0; k < n_sp_chunks; k++) {
+                    s += sum[(n * n_sp_chunks + k) * C + c];
+                    sq += sqsum[(n * n_sp_chunks + k) * C + c];
+                }
+                ch_mean[c] = ch_shift[n * C + c] + s / SP;
+                m2 += nstl::max(0.f, sq - s * s / SP);
+                group_mean += ch_mean[c];
+            }
+            group_mean /= C_per_G;
+            for (dim_t c = g * C_per_G; c < (g + 1) * C_per_G; c++) {
+                const float d = ch_mean[c] - group_mean;
+                m2 += SP * d * d;
+            }
+            mean[stat_d.off(n, g)] = group_mean;
+            variance[stat_d.off(n, g)] = m2 / (C_per_G * SP);
+        });
+    }
+
+    parallel_nd(N, G, [&](dim_t n, dim_t g) {
+        const float v_mean = mean[stat_d.off(n, g)];
+        const float inv_sqrtvar = 1.f / sqrtf(variance[stat_d.off(n, g)] + eps);
+        for (dim_t c = g * C_per_G; c < (g + 1) * C_per_G; c++) {
+            const float sm = (scale ? scale[c] : 1.f) * inv_sqrtvar;
+            scales[n * C + c] = sm;
+            shifts[n * C + c] = (shift ? shift[c] : 0.f) - v_mean * sm;
+        }
+    });
+
+    parallel_nd(N, nb_c, n_sp_chunks, [&](dim_t n, dim_t cb, dim_t k) {
+        const dim_t sp = k * sp_chunk;
+        const dim_t c = cb * c_blk;
+        const dim_t off = data_off(n, cb, sp) * dt_size;
+        typename gnorm_impl::jit_apply_kernel_t<isa>::call_params_t p;
+        p.src = src + off;
+        p.dst = dst + off;
+        p.scale = &scales[n * C + c];
+        p.shift = &shifts[n * C + c];
+        p.work = nstl::min(sp_chunk, SP - sp);
+        (*apply_kernel_)(&p);
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_group_normalization_fwd_t<avx512_core>;
+template struct jit_uni_group_normalization_fwd_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,110 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_GROUP_NORMALIZATION_HPP
+#define CPU_X64_JIT_UNI_GROUP_NORMALIZATION_HPP
+
+#include <assert.h>
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_group_normalization_pd.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace gnorm_impl {
+template <cpu_isa_t isa>
+struct jit_stat_kernel_t;
+template <cpu_isa_t isa>
+struct jit_apply_kernel_t;
+} // namespace gnorm_impl
+
+/* Forward group normalization for layouts where either channels are the
+ * innermost dimension (nspc and nCx8c/nCx16c) or every channel is a contiguous
+ * run of spatial points (ncsp).
+ *
+ * Statistics are computed in a single pass over src: similarly to the jit
+ * batch normalization, every thread accumulates per-channel partial sums over
+ * a chunk of spatial points, which are then reduced per (mb, group). The sums
+ * are shifted by the first value of the channel to avoid the cancellation of
+ * the naive E[x^2] - E[x]^2 formula. The second pass applies the per-channel
+ * affine transformation dst = src * A + B together with eltwise post-ops. */
+template <cpu_isa_t isa>
+struct jit_uni_group_normalization_fwd_t : public primitive_t {
+    struct pd_t : public cpu_group_normalization_fwd_pd_t {
+        pd_t(const group_normalization_desc_t *adesc,
+                const primitive_attr_t *attr,
+                const group_normalization_fwd_pd_t *hint_fwd_pd)
+            : cpu_group_normalization_fwd_pd_t(adesc, attr, hint_fwd_pd) {}
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:",
+                        (src_md()->data_type == data_type::bf16)
+                                ? (mayiuse(avx512_core_bf16)
+                                                ? avx512_core_bf16
+                                                : bf16_emulation_t::get_isa())
+                                : isa,
+                        ""),
+                jit_uni_group_normalization_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // true for ncsp: a kernel call processes a contiguous run of spatial
+        // points of a single channel
+        bool is_ncsp_;
+        // number of channels in a row of the channels-innermost layouts
+        dim_t c_blk_;
+        dim_t nb_c_;
+        // spatial points processed by a single kernel call
+        dim_t sp_chunk_;
+        dim_t n_sp_chunks_;
+
+    private:
+        void init_work_split();
+        void init_scratchpad();
+    };
+
+    jit_uni_group_normalization_fwd_t(const pd_t *apd);
+    ~jit_uni_group_normalization_fwd_t();
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<gnorm_impl::jit_stat_kernel_t<isa>> stat_kernel_;
+    std::unique_ptr<gnorm_impl::jit_apply_kernel_t<isa>> apply_kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -17,6 +17,7 @@
 #include "cpu/x64/jit_uni_layer_normalization_kernels.hpp"
 #include "common/bfloat16.hpp"
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
 #include "cpu/x64/jit_generator.hpp"
 namespace dnnl {
@@ -49,6 +50,10 @@ struct jit_transfer_t<f32> {
     std::unique_ptr<bf16_emulation_t> bf16_emu_;
 
 protected:
+    // Converts saturated f32 values to int8 and stores them
+    void store_int8(data_type_t dt, Ymm &vmm_dst, Reg64 reg_dst, int nelems,
+            size_t offt_elems);
+
     jit_generator &gen_;
     const int simd_w_;
 };
@@ -67,6 +72,9 @@ struct jit_transfer_t<bf16> : jit_transfer_t<f32> {
     void store(Zmm &zmm_dst, Reg64 reg_dst, int nelems, size_t offt_elems);
 
 private:
+    void store_int8(data_type_t dt, Zmm &zmm_dst, Reg64 reg_dst, int nelems,
+            size_t offt_elems);
+
     const bool emulate_bf16_;
     const Reg64 reg_tmp_ = r15;
     const Zmm bf16_emu_reserv_1_ = Zmm(28);
@@ -111,6 +119,25 @@ void jit_transfer_t<f32>::store<f32>(
         assert(!"unsupported nelems");
 }
 
+void jit_transfer_t<f32>::store_int8(data_type_t dt, Ymm &vmm_dst,
+        Reg64 reg_dst, int nelems, size_t offt_elems) {
+    assert(utils::one_of(nelems, 1, simd_w_));
+    gen_.vcvtps2dq(vmm_dst, vmm_dst);
+    gen_.store_data(dt, vmm_dst, reg_dst, offt_elems, nelems);
+}
+
+template <>
+void jit_transfer_t<f32>::store<s8>(
+        Ymm &vmm_dst, Reg64 reg_dst, int nelems, size_t offt_elems) {
+    store_int8(s8, vmm_dst, reg_dst, nelems, offt_elems);
+}
+
+template <>
+void jit_transfer_t<f32>::store<u8>(
+        Ymm &vmm_dst, Reg64 reg_dst, int nelems, size_t offt_elems) {
+    store_int8(u8, vmm_dst, reg_dst, nelems, offt_elems);
+}
+
 template <>
 void jit_transfer_t<bf16>::load<f32>(
         Zmm &zmm_src, Reg64 reg_src, int nelems, size_t offt_elems) {
@@ -163,6 +190,37 @@ void jit_transfer_t<bf16>::store<bf16>(
         assert(!"unsupported nelems");
 }
 
+void jit_transfer_t<bf16>::store_int8(data_type_t dt, Zmm &zmm_dst,
+        Reg64 reg_dst, int nelems, size_t offt_elems) {
+    gen_.vcvtps2dq(zmm_dst, zmm_dst);
+    if (nelems == 1) {
+        const Xmm xmm_dst = Xmm(zmm_dst.getIdx());
+        if (dt == s8)
+            gen_.vpmovsdb(xmm_dst, zmm_dst);
+        else
+            gen_.vpmovusdb(xmm_dst, zmm_dst);
+        gen_.vpextrb(byte[reg_dst + offt_elems], xmm_dst, 0);
+    } else if (nelems == simd_w_) {
+        if (dt == s8)
+            gen_.vpmovsdb(xword[reg_dst + offt_elems], zmm_dst);
+        else
+            gen_.vpmovusdb(xword[reg_dst + offt_elems], zmm_dst);
+    } else
+        assert(!"unsupported nelems");
+}
+
+template <>
+void jit_transfer_t<bf16>::store<s8>(
+        Zmm &zmm_dst, Reg64 reg_dst, int nelems, size_t offt_elems) {
+    store_int8(s8, zmm_dst, reg_dst, nelems, offt_elems);
+}
+
+template <>
+void jit_transfer_t<bf16>::store<u8>(
+        Zmm &zmm_dst, Reg64 reg_dst, int nelems, size_t offt_elems) {
+    store_int8(u8, zmm_dst, reg_dst, nelems, offt_elems);
+}
+
 template <data_type_t data_type>
 struct jit_stat_and_data_kernel_t : stat_and_data_kernel_t<data_type>,
                                     public jit_generator {
@@ -171,12 +229,20 @@ struct jit_stat_and_data_kernel_t : stat_and_data_kernel_t<data_type>,
     jit_stat_and_data_kernel_t(const layer_normalization_pd_t *pd);
 
     using data_t = typename prec_traits<data_type>::type;
-    void operator()(const data_t *src, data_t *dst, const float *scale,
+    void operator()(const data_t *src, void *dst, const float *scale,
             const float *shift, float *mean, float *var,
+            const void *post_ops_binary_rhs_arg_vec, const void *dst_orig,
             const size_t block_size) const override;
 
     status_t create_kernel() override { return jit_generator::create_kernel(); }
 
+    static constexpr cpu_isa_t isa = data_type == bf16 ? avx512_core : avx2;
+    static const bcast_set_t &enabled_bcast_strategy() {
+        static const bcast_set_t supported = {broadcasting_strategy_t::scalar,
+                broadcasting_strategy_t::no_broadcast};
+        return supported;
+    }
+
 private:
     jit_transfer_t<data_type> jit_transfer_;
     static constexpr int unroll_factor_ = 8;
@@ -189,17 +255,23 @@ private:
     using stat_and_data_kernel_t<data_type>::use_shift_;
     using stat_and_data_kernel_t<data_type>::save_stats_;
     using stat_and_data_kernel_t<data_type>::calculate_stats_;
+    using stat_and_data_kernel_t<data_type>::skip_mean_;
     using stat_and_data_kernel_t<data_type>::eps_;
+    using stat_and_data_kernel_t<data_type>::dst_dt_;
+    using stat_and_data_kernel_t<data_type>::oscale_;
+    using stat_and_data_kernel_t<data_type>::with_postops_;
 
     struct ker_args_t {
         const data_t *src;
-        data_t *dst;
+        void *dst;
         const float *scale;
         const float *shift;
         const float *mean;
         const float *var;
         size_t block_size;
         float eps;
+        const void *post_ops_binary_rhs_arg_vec;
+        const void *dst_orig;
     };
 
     void generate() override;
@@ -209,6 +281,8 @@ private:
 
     void reduce();
 
+    void store_dst(int nelems, size_t offt_elems);
+
     const Xbyak::Reg64 reg_param = abi_param1;
     const Xbyak::Reg64 reg_src = rdx;
     const Xbyak::Reg64 reg_dst = rax;
@@ -219,6 +293,9 @@ private:
     const Xbyak::Reg64 reg_eps = r10;
     const Xbyak::Reg64 reg_tmp = r11;
     const Xbyak::Reg64 reg_shift = r12;
+    const Xbyak::Reg64 reg_po_helper_1 = r13;
+    const Xbyak::Reg64 reg_po_helper_2 = r14;
+    const Xbyak::Opmask k_tail_mask = Xbyak::Opmask(2);
 
     Vmm vmm_ones = Vmm(8);
     Vmm vmm_eps = Vmm(9);
@@ -229,9 +306,18 @@ private:
     Vmm vmm_mean = Vmm(15);
     Vmm vmm_src = vmm_inv_sqrtvar;
     Vmm vmm_dst = vmm_data;
+    // Vmm(0) - Vmm(7) are reduction accumulators and are free when dst is
+    // computed
+    Vmm vmm_oscale = Vmm(4);
+    Vmm vmm_sat_lbound = Vmm(5);
+    Vmm vmm_sat_ubound = Vmm(6);
+    static constexpr size_t vmm_po_helper_idx = 7;
 
     Xmm xmm_return_value = Xmm(0);
     Xmm xmm_tmp = Xmm(14);
+
+    std::unique_ptr<injector::jit_uni_postops_injector_t<isa, Vmm>>
+            postops_injector_;
 };
 
 template <data_type_t data_type>
@@ -241,12 +327,47 @@ jit_stat_and_data_kernel_t<data_type>::jit_stat_and_data_kernel_t(
     , jit_generator(jit_name())
     , jit_transfer_ {*this} {
     assert(data_type == bf16 ? mayiuse(avx512_core) : mayiuse(avx2));
+
+    if (with_postops_) {
+        static constexpr bool preserve_gpr = true;
+        static constexpr bool preserve_vmm = true;
+        static constexpr bool use_exact_tail_scalar_bcast = false;
+        // only the scalar remainder needs masking
+        static constexpr size_t tail_size = 1;
+
+        const memory_desc_wrapper dst_d(pd->dst_md());
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        const binary_injector::rhs_arg_static_params_t rhs_sp
+                = isa == avx512_core
+                ? binary_injector::rhs_arg_static_params_t {vmm_po_helper_idx,
+                        reg_po_helper_1, reg_po_helper_2, preserve_gpr,
+                        preserve_vmm, PARAM_OFF(post_ops_binary_rhs_arg_vec),
+                        PARAM_OFF(dst_orig), dst_d, tail_size, k_tail_mask,
+                        use_exact_tail_scalar_bcast}
+                : binary_injector::rhs_arg_static_params_t {vmm_po_helper_idx,
+                        reg_po_helper_1, reg_po_helper_2, preserve_gpr,
+                        preserve_vmm, PARAM_OFF(post_ops_binary_rhs_arg_vec),
+                        PARAM_OFF(dst_orig), dst_d, tail_size,
+                        use_exact_tail_scalar_bcast};
+#undef PARAM_OFF
+        const binary_injector::static_params_t bsp {
+                reg_param, enabled_bcast_strategy(), rhs_sp};
+
+        static constexpr bool save_state = true;
+        const eltwise_injector::static_params_t esp {
+                save_state, reg_po_helper_1};
+
+        postops_injector_ = utils::make_unique<
+                injector::jit_uni_postops_injector_t<isa, Vmm>>(
+                this, pd->attr()->post_ops_, bsp, esp);
+    }
 }
 
 template <data_type_t data_type>
 void jit_stat_and_data_kernel_t<data_type>::operator()(const data_t *src,
-        data_t *dst, const float *scale, const float *shift, float *mean,
-        float *var, const size_t block_size) const {
+        void *dst, const float *scale, const float *shift, float *mean,
+        float *var, const void *post_ops_binary_rhs_arg_vec,
+        const void *dst_orig, const size_t block_size) const {
     ker_args_t args;
     args.src = src;
     args.dst = dst;
@@ -256,13 +377,36 @@ void jit_stat_and_data_kernel_t<data_type>::operator()(const data_t *src,
     args.block_size = block_size * C_ * types::data_type_size(data_type);
     args.eps = eps_;
     args.var = var;
+    args.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec;
+    args.dst_orig = dst_orig;
     jit_generator::operator()(&args);
 }
 
+template <data_type_t data_type>
+void jit_stat_and_data_kernel_t<data_type>::store_dst(
+        int nelems, size_t offt_elems) {
+    switch (dst_dt_) {
+        case s8:
+            jit_transfer_.template store<s8>(
+                    vmm_dst, reg_dst, nelems, offt_elems);
+            break;
+        case u8:
+            jit_transfer_.template store<u8>(
+                    vmm_dst, reg_dst, nelems, offt_elems);
+            break;
+        default:
+            jit_transfer_.template store<data_type>(
+                    vmm_dst, reg_dst, nelems, offt_elems);
+    }
+}
+
 template <data_type_t data_type>
 void jit_stat_and_data_kernel_t<data_type>::generate() {
-    const auto c_size = C_ * types::data_type_size(data_type);
+    const auto c_src_size = C_ * types::data_type_size(data_type);
+    const auto c_dst_size = C_ * types::data_type_size(dst_dt_);
     static const auto float_size = types::data_type_size(f32);
+    const bool with_oscale = oscale_ != 1.f;
+    const bool is_int8_dst = utils::one_of(dst_dt_, s8, u8);
 
     preamble();
     if (jit_transfer_.bf16_emu_) jit_transfer_.bf16_emu_->init_vcvtneps2bf16();
@@ -280,6 +424,11 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
     // float value of 1
     static constexpr float one = 1.0;
 
+    if (with_postops_ && isa == avx512_core) {
+        mov(reg_tmp, 1);
+        kmovw(k_tail_mask, reg_tmp.cvt32());
+    }
+
     const auto calculate_dst = [=](int nelems, size_t offt_elems) {
         if (use_scaleshift_ || use_scale_) {
             jit_transfer_.template load<f32>(
@@ -291,7 +440,7 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
         }
         jit_transfer_.template load<data_type>(
                 vmm_data, reg_src, nelems, offt_elems);
-        vsubps(vmm_data, vmm_data, vmm_mean);
+        if (!skip_mean_) vsubps(vmm_data, vmm_data, vmm_mean);
         vmulps(vmm_data, vmm_data, vmm_inv_sqrtvar);
         if (use_scaleshift_ || (use_scale_ && use_shift_))
             vfmadd213ps(vmm_data, vmm_gamma, vmm_beta);
@@ -299,8 +448,19 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
             if (use_scale_) vmulps(vmm_data, vmm_data, vmm_gamma);
             if (use_shift_) vaddps(vmm_data, vmm_data, vmm_beta);
         }
-        jit_transfer_.template store<data_type>(
-                vmm_data, reg_dst, nelems, offt_elems);
+        if (with_oscale) vmulps(vmm_data, vmm_data, vmm_oscale);
+        if (with_postops_) {
+            binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
+            const int vmm_idx = vmm_data.getIdx();
+            rhs_arg_params.vmm_idx_to_out_reg.emplace(vmm_idx, reg_dst);
+            rhs_arg_params.vmm_idx_to_out_elem_off_val.emplace(
+                    vmm_idx, offt_elems * types::data_type_size(dst_dt_));
+            if (nelems == 1) rhs_arg_params.vmm_tail_idx_.emplace(vmm_idx);
+            postops_injector_->compute_vector(vmm_idx, rhs_arg_params);
+        }
+        if (is_int8_dst)
+            saturate_f32(vmm_data, vmm_sat_lbound, vmm_sat_ubound, dst_dt_);
+        store_dst(nelems, offt_elems);
     };
 
     // add block_start to block_size to define block_end
@@ -319,13 +479,21 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
         jle(end, T_NEAR);
 
         if (calculate_stats_) {
-            // compute mean
-            compute([&](Vmm vmm_dst) { vaddps(vmm_dst, vmm_dst, vmm_src); });
-            if (save_stats_) vmovss(ptr[reg_mean], xmm_return_value);
-            vbroadcastss(vmm_mean, xmm_return_value);
+            if (skip_mean_) {
+                // RMS normalization: the mean is not subtracted and is
+                // reported as zero
+                uni_vpxor(vmm_mean, vmm_mean, vmm_mean);
+                if (save_stats_) mov(dword[reg_mean], 0);
+            } else {
+                // compute mean
+                compute([&](Vmm vmm_dst) {
+                    vaddps(vmm_dst, vmm_dst, vmm_src);
+                });
+                if (save_stats_) vmovss(ptr[reg_mean], xmm_return_value);
+                vbroadcastss(vmm_mean, xmm_return_value);
+            }
 
             //compute var
-            vbroadcastss(vmm_mean, xmm_return_value);
             compute([&](Vmm vmm_dst) {
                 vsubps(vmm_src, vmm_mean, vmm_src);
                 vfmadd231ps(vmm_dst, vmm_src, vmm_src);
@@ -334,8 +502,10 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
             vbroadcastss(vmm_inv_sqrtvar, xmm_return_value);
         } else {
             // read mean and var from input
-            vmovss(xmm_tmp, dword[reg_mean]);
-            vbroadcastss(vmm_mean, xmm_tmp);
+            if (!skip_mean_) {
+                vmovss(xmm_tmp, dword[reg_mean]);
+                vbroadcastss(vmm_mean, xmm_tmp);
+            }
             vmovss(xmm_tmp, dword[reg_var]);
             vbroadcastss(vmm_inv_sqrtvar, xmm_tmp);
         }
@@ -345,6 +515,16 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
         vsqrtps(vmm_inv_sqrtvar, vmm_inv_sqrtvar);
         vdivps(vmm_inv_sqrtvar, vmm_ones, vmm_inv_sqrtvar);
 
+        // constants of the dst part live in the reduction registers
+        if (with_oscale) {
+            mov(reg_tmp, float2int(oscale_));
+            vmovq(xmm_tmp, reg_tmp);
+            vbroadcastss(vmm_oscale, xmm_tmp);
+        }
+        if (is_int8_dst)
+            init_saturate_f32(
+                    vmm_sat_lbound, vmm_sat_ubound, reg_tmp, f32, dst_dt_);
+
         // calculate dst
         for (int i = 0; i < C_vecs; i++)
             calculate_dst(simd_w, i * simd_w);
@@ -352,8 +532,8 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
         for (int i = utils::rnd_dn(C_, simd_w); i < C_; i++)
             calculate_dst(1, i);
 
-        add(reg_src, c_size);
-        add(reg_dst, c_size);
+        add(reg_src, c_src_size);
+        add(reg_dst, c_dst_size);
         add(reg_mean, float_size);
         add(reg_var, float_size);
         jmp(unroll_loop);
@@ -361,6 +541,8 @@ void jit_stat_and_data_kernel_t<data_type>::generate() {
     L(end);
 
     postamble();
+
+    if (with_postops_) postops_injector_->prepare_table();
 }
 
 template <data_type_t data_type>
@@ -459,6 +641,7 @@ private:
             Xbyak::Ymm>::type;
     using diff_ss_kernel_t<data_type>::C_;
     using diff_ss_kernel_t<data_type>::eps_;
+    using diff_ss_kernel_t<data_type>::skip_mean_;
 
     struct ker_args_t {
         const data_t *src;
@@ -555,7 +738,7 @@ void jit_diff_ss_kernel_t<data_type>::generate() {
         jit_transfer_.template load<data_type>(
                 vmm_src, reg_src, nelems, offt_elems);
         vaddps(vmm_dbeta, vmm_dbeta, vmm_ddst);
-        vsubps(vmm_src, vmm_src, vmm_mean);
+        if (!skip_mean_) vsubps(vmm_src, vmm_src, vmm_mean);
         vmulps(vmm_src, vmm_src, vmm_inv_sqrtvar);
         vfmadd231ps(vmm_dgamma, vmm_src, vmm_ddst);
         jit_transfer_.template store<f32>(
@@ -573,8 +756,10 @@ void jit_diff_ss_kernel_t<data_type>::generate() {
         cmp(reg_block_end, reg_src);
         jle(end, T_NEAR);
 
-        vmovss(xmm_tmp, dword[reg_mean]);
-        vbroadcastss(vmm_mean, xmm_tmp);
+        if (!skip_mean_) {
+            vmovss(xmm_tmp, dword[reg_mean]);
+            vbroadcastss(vmm_mean, xmm_tmp);
+        }
         vmovss(xmm_tmp, dword[reg_inv_sqrtvar]);
         vbroadcastss(vmm_inv_sqrtvar, xmm_tmp);
 
@@ -621,6 +806,7 @@ private:
     using diff_data_kernel_t<data_type>::use_scaleshift_;
     using diff_data_kernel_t<data_type>::use_scale_;
     using diff_data_kernel_t<data_type>::use_shift_;
+    using diff_data_kernel_t<data_type>::skip_mean_;
 
     struct ker_args_t {
         const data_t *src;
@@ -719,8 +905,11 @@ void jit_diff_data_kernel_t<data_type>::generate() {
         }
         jit_transfer_.template load<data_type>(
                 vmm_src, reg_src, nelems, offt_elems);
-        vaddps(vmm_dd_gamma, vmm_dd_gamma, vmm_ddst);
-        vsubps(vmm_src, vmm_src, vmm_mean);
+        // RMS normalization has no mean term in the derivative
+        if (!skip_mean_) {
+            vaddps(vmm_dd_gamma, vmm_dd_gamma, vmm_ddst);
+            vsubps(vmm_src, vmm_src, vmm_mean);
+        }
         vfmadd231ps(vmm_dd_gamma_x, vmm_ddst, vmm_src);
     };
 
@@ -735,7 +924,7 @@ void jit_diff_data_kernel_t<data_type>::generate() {
         if (calculate_diff_stats_) {
             jit_transfer_.template load<data_type>(
                     vmm_src, reg_src, nelems, offt_elems);
-            vsubps(vmm_src, vmm_src, vmm_mean);
+            if (!skip_mean_) vsubps(vmm_src, vmm_src, vmm_mean);
             vmulps(vmm_src, vmm_src, vmm_inv_sqrtvar);
             vfmadd213ps(vmm_src, vmm_dd_gamma_x, vmm_dd_gamma);
             vdivps(vmm_src, vmm_src, vmm_C);
@@ -758,8 +947,10 @@ void jit_diff_data_kernel_t<data_type>::generate() {
         vmovss(xmm_tmp, dword[reg_inv_sqrtvar]);
         vbroadcastss(vmm_inv_sqrtvar, xmm_tmp);
         if (calculate_diff_stats_) {
-            vmovss(xmm_tmp, dword[reg_mean]);
-            vbroadcastss(vmm_mean, xmm_tmp);
+            if (!skip_mean_) {
+                vmovss(xmm_tmp, dword[reg_mean]);
+                vbroadcastss(vmm_mean, xmm_tmp);
+            }
 
             uni_vpxor(vmm_dd_gamma, vmm_dd_gamma, vmm_dd_gamma);
             uni_vpxor(vmm_dd_gamma_x, vmm_dd_gamma_x, vmm_dd_gamma_x);
@@ -840,6 +1031,21 @@ stat_and_data_kernel_t<f32> *stat_and_data_kernel_create(
     return mayiuse(avx2) ? new jit_stat_and_data_kernel_t<f32>(pd) : nullptr;
 }
 
+template <data_type_t d_type>
+bool stat_and_data_kernel_post_ops_ok(const layer_normalization_pd_t *pd) {
+    using kernel_t = jit_stat_and_data_kernel_t<d_type>;
+    if (!mayiuse(kernel_t::isa)) return false;
+    const memory_desc_wrapper dst_d(pd->dst_md());
+    return injector::post_ops_ok({kernel_t::isa,
+            {injector::eltwise, injector::binary}, pd->attr()->post_ops_,
+            &dst_d, false, false, false, kernel_t::enabled_bcast_strategy()});
+}
+
+template bool stat_and_data_kernel_post_ops_ok<f32>(
+        const layer_normalization_pd_t *pd);
+template bool stat_and_data_kernel_post_ops_ok<bf16>(
+        const layer_normalization_pd_t *pd);
+
 template <>
 diff_ss_kernel_t<bf16> *diff_ss_kernel_create(
         const layer_normalization_pd_t *pd) {
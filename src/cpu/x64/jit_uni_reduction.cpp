@@ -14,6 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <vector>
+
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+
 #include "jit_uni_reduction.hpp"
 
 namespace dnnl {
@@ -31,6 +38,81 @@ static cpu_isa_t get_supported_isa() {
     return isa_any;
 }
 
+// Must match the vector length of the kernels created by get_proper_kernel().
+static dim_t get_simd_w(const jit_reduction_conf_t &conf) {
+    using namespace data_type;
+    if (is_superset(conf.isa, avx512_core)) return 16;
+    if (is_superset(conf.isa, avx))
+        return utils::one_of(conf.src_type, s8, u8)
+                        || utils::one_of(conf.dst_type, s8, u8)
+                ? 4
+                : 8;
+    return 4;
+}
+
+template <cpu_isa_t isa, typename Vmm = typename cpu_isa_traits<isa>::Vmm>
+static status_t create_kernel(
+        std::unique_ptr<jit_uni_reduction_kernel_base_t> &kernel,
+        const memory_desc_t *dst_md, const jit_reduction_conf_t &conf,
+        dim_t block) {
+    if (block == 0)
+        return safe_ptr_assign(
+                kernel, new jit_uni_reduction_kernel_t<isa, Vmm>(conf, dst_md));
+    return safe_ptr_assign(kernel,
+            new jit_uni_reduction_vertical_kernel_t<isa, Vmm>(
+                    conf, dst_md, block));
+}
+
+// A dimension of the physical layout: the logical dimension it belongs to
+// and its size.
+struct phys_dim_t {
+    int dim;
+    dim_t size;
+};
+
+// Returns the physical dimensions of a dense memory descriptor without
+// padding, from the outermost to the innermost one. Dimensions of size 1 are
+// skipped.
+static bool get_phys_dims(
+        const memory_desc_wrapper &mdw, std::vector<phys_dim_t> &pdims) {
+    if (!mdw.is_blocking_desc() || !mdw.is_dense()
+            || mdw.has_runtime_dims_or_strides()
+            || mdw.nelems(true) != mdw.nelems())
+        return false;
+
+    const auto &bd = mdw.blocking_desc();
+    dims_t blocks;
+    mdw.compute_blocks(blocks);
+
+    std::vector<std::pair<dim_t, int>> outer; // (stride, dim)
+    for (int d = 0; d < mdw.ndims(); d++)
+        if (mdw.padded_dims()[d] / blocks[d] > 1)
+            outer.emplace_back(bd.strides[d], d);
+    std::sort(outer.begin(), outer.end(),
+            [](const std::pair<dim_t, int> &a, const std::pair<dim_t, int> &b) {
+                return a.first > b.first;
+            });
+
+    pdims.clear();
+    dim_t stride = 1;
+    for (int i = 0; i < bd.inner_nblks; i++)
+        stride *= bd.inner_blks[i];
+    for (auto it = outer.rbegin(); it != outer.rend(); ++it) {
+        if (it->first != stride) return false;
+        stride *= mdw.padded_dims()[it->second] / blocks[it->second];
+    }
+
+    for (const auto &o : outer) {
+        const int d = o.second;
+        pdims.push_back({d, mdw.padded_dims()[d] / blocks[d]});
+    }
+    for (int i = 0; i < bd.inner_nblks; i++)
+        if (bd.inner_blks[i] > 1)
+            pdims.push_back({(int)bd.inner_idxs[i], bd.inner_blks[i]});
+
+    return true;
+}
+
 status_t jit_uni_reduction_t::pd_t::init(engine_t *engine) {
     using namespace alg_kind;
     using namespace data_type;
@@ -54,17 +136,48 @@ status_t jit_uni_reduction_t::pd_t::init(engine_t *engine) {
             && attr_.set_default_formats(dst_md(0)) == status::success;
     if (!ok) return status::unimplemented;
 
-    const auto src_mdw = memory_desc_wrapper(src_md());
+    // Reducing an empty source into a non-empty destination only fills it
+    // with the initial values, which the kernels do not handle.
+    const memory_desc_wrapper src_d(src_md()), dst_d(dst_md());
+    if (src_d.has_zero_dim() && !dst_d.has_zero_dim())
+        return status::unimplemented;
+
+    conf_.alg = desc()->alg_kind;
+    conf_.p = desc()->p;
+    conf_.eps = desc()->eps;
+    // Only the powers which do not need a generic pow() are supported.
+    const bool is_lp = utils::one_of(conf_.alg, reduction_norm_lp_max,
+            reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
+            reduction_norm_lp_power_p_sum);
+    if (is_lp && !utils::one_of(conf_.p, 1.f, 2.f))
+        return status::unimplemented;
+
+    if (!init_shape()) return status::unimplemented;
+
+    // Indices are tracked as f32 values in the kernels.
+    if (is_arg_alg()
+            && (!attr()->has_default_values()
+                    || conf_.reduce_size > (dim_t(1) << 24)))
+        return status::unimplemented;
+
     const auto dst_mdw = memory_desc_wrapper(dst_md());
 
+    // In the vertical kernel a vector of dst values may span several
+    // channels, so only the broadcasts not depending on them are accepted.
+    const bool is_plain = memory_desc_matches_one_of_tag(
+                                  *dst_md(), x, nc, ncw, nchw, ncdhw)
+            != format_tag::undef;
     const std::vector<injector::post_op_type> accepted_post_ops
             = {injector::sum, injector::eltwise, injector::binary};
     static constexpr bool sum_at_0_pos_only = false;
     static constexpr bool sum_requires_scale_one = false;
     static constexpr bool sum_requires_zp_zero = true;
-    const bcast_set_t accepted_broadcasts
-            = {broadcasting_strategy_t::scalar, broadcasting_strategy_t::per_oc,
+    const bcast_set_t accepted_broadcasts = conf_.inner_size == 1 && is_plain
+            ? bcast_set_t {broadcasting_strategy_t::scalar,
+                    broadcasting_strategy_t::per_oc,
                     broadcasting_strategy_t::per_oc_spatial,
+                    broadcasting_strategy_t::no_broadcast}
+            : bcast_set_t {broadcasting_strategy_t::scalar,
                     broadcasting_strategy_t::no_broadcast};
     injector::post_ops_ok_args_t post_ops_args(conf_.isa, accepted_post_ops,
             attr()->post_ops_, &dst_mdw, sum_at_0_pos_only,
@@ -88,117 +201,381 @@ status_t jit_uni_reduction_t::pd_t::init(engine_t *engine) {
     conf_.with_postops
             = conf_.with_eltwise || conf_.with_binary || conf_.with_sum;
 
-    const format_tag_t src_md_desired_format = memory_desc_matches_one_of_tag(
-            *src_md(), x, nc, ncw, nchw, ncdhw);
-    const format_tag_t dst_md_desired_format = memory_desc_matches_one_of_tag(
-            *dst_md(), x, nc, ncw, nchw, ncdhw);
-    if (src_md_desired_format != dst_md_desired_format
-            || src_md_desired_format == format_tag::undef)
-        return status::unimplemented;
+    conf_.is_saturation_needed = utils::one_of(conf_.dst_type, s32, s8, u8);
+
+    init_split();
+    init_scratchpad();
+
+    return status::success;
+}
+
+// Describes src as a dense [outer][reduce][inner] tensor, which is possible
+// when the reduced dimensions are adjacent in its physical layout and dst
+// keeps the layout of the rest of the dimensions.
+bool jit_uni_reduction_t::pd_t::init_shape() {
+    const auto src_mdw = memory_desc_wrapper(src_md());
+    const auto dst_mdw = memory_desc_wrapper(dst_md());
+
+    std::vector<phys_dim_t> src_pdims, dst_pdims;
+    if (!get_phys_dims(src_mdw, src_pdims)
+            || !get_phys_dims(dst_mdw, dst_pdims))
+        return false;
 
-    const int ndims = src_mdw.ndims();
     const auto &src_dims = src_mdw.dims();
     const auto &dst_dims = dst_mdw.dims();
+    bool with_reduced_dims = false;
+    for (int d = 0; d < src_mdw.ndims(); d++)
+        with_reduced_dims = with_reduced_dims || src_dims[d] != dst_dims[d];
+    if (!with_reduced_dims) return false;
+
+    dim_t outer = 1, reduce = 1, inner = 1;
+    bool reduce_started = false, reduce_finished = false;
+    int last_reduced_dim = -1;
+    std::vector<phys_dim_t> kept_pdims;
+    for (const auto &pd : src_pdims) {
+        if (src_dims[pd.dim] != dst_dims[pd.dim]) {
+            if (reduce_finished) return false;
+            // The kernels compute indices in the physical order of the
+            // reduced elements, which has to match the logical one.
+            if (is_arg_alg() && pd.dim <= last_reduced_dim) return false;
+            last_reduced_dim = pd.dim;
+            reduce_started = true;
+            reduce *= pd.size;
+        } else {
+            reduce_finished = reduce_started;
+            (reduce_started ? inner : outer) *= pd.size;
+            kept_pdims.push_back(pd);
+        }
+    }
 
-    conf_.is_saturation_needed = utils::one_of(conf_.dst_type, s32, s8, u8);
+    if (kept_pdims.size() != dst_pdims.size()) return false;
+    for (size_t i = 0; i < kept_pdims.size(); i++)
+        if (kept_pdims[i].dim != dst_pdims[i].dim
+                || kept_pdims[i].size != dst_pdims[i].size)
+            return false;
+
+    conf_.outer_size = outer;
+    conf_.reduce_size = reduce;
+    conf_.inner_size = inner;
+    conf_.idle_size = outer * inner;
+    conf_.div_size = reduce;
+    conf_.inner_block = inner == 1
+            ? 0
+            : nstl::min(inner,
+                    kernel_t::max_vertical_unroll * get_simd_w(conf_));
+
+    return true;
+}
 
-    int num_of_reduced_dims = 0;
-    conf_.idle_size = dst_mdw.nelems();
-    conf_.reduce_size = 1;
-    for (int d = ndims - 1; d >= 0; --d) {
-        if (src_dims[d] != dst_dims[d]) {
-            num_of_reduced_dims++;
-            conf_.reduce_size *= src_dims[d];
-        } else
-            break;
+// Splits the reduced dimension between threads when there are not enough
+// independent outputs to keep all of them busy.
+void jit_uni_reduction_t::pd_t::init_split() {
+    // Minimal number of source elements reduced by a kernel call for a chunk.
+    static constexpr dim_t min_chunk_size = 4096;
+    const int nthr = dnnl_get_max_threads();
+
+    partial_conf_ = conf_;
+    partial_conf_.dst_type = data_type::f32;
+    partial_conf_.dst_dt_size = sizeof(float);
+    partial_conf_.finalize = false;
+    partial_conf_.is_saturation_needed = false;
+    partial_conf_.post_ops = post_ops_t();
+    partial_conf_.with_postops = partial_conf_.with_eltwise
+            = partial_conf_.with_binary = partial_conf_.with_sum = false;
+    partial_conf_.sum_scales = std::queue<float>();
+    const dim_t max_block
+            = kernel_t::max_vertical_unroll * get_simd_w(partial_conf_);
+
+    // Arg reductions are not split. A trailing one is done over rows of
+    // max_block elements instead, the results for the lanes of which are
+    // merged in reduce_trailing_arg().
+    if (is_arg_alg()) {
+        if (conf_.inner_size == 1) {
+            partial_conf_.reduce_size = conf_.reduce_size / max_block;
+            partial_conf_.inner_size = max_block;
+            partial_conf_.inner_block = max_block;
+            partial_conf_.idle_size = conf_.outer_size * max_block;
+        }
+        return;
     }
 
-    if (num_of_reduced_dims == 0) return status::unimplemented;
-
-    for (int d = 0; d < ndims - num_of_reduced_dims; ++d)
-        if (src_dims[d] != dst_dims[d]) return status::unimplemented;
+    // The first stage reduces rows of row_size elements vertically. A
+    // trailing reduction is cut into rows of a few vectors for that.
+    dim_t rows = conf_.reduce_size;
+    dim_t row_size = conf_.inner_size;
+    if (conf_.inner_size == 1) {
+        const dim_t simd_w = get_simd_w(partial_conf_);
+        row_size = conf_.reduce_size % max_block == 0 ? max_block
+                : conf_.reduce_size % simd_w == 0     ? simd_w
+                                                      : 0;
+        if (row_size == 0) return;
+        rows = conf_.reduce_size / row_size;
+    }
+    const dim_t block = nstl::min(row_size, max_block);
+
+    const dim_t work = conf_.outer_size * utils::div_up(row_size, block);
+    if (work >= nthr) return;
+
+    const dim_t min_chunk_rows = utils::div_up(min_chunk_size, block);
+    dim_t nsplit = nstl::min<dim_t>(
+            utils::div_up(nthr, work), rows / min_chunk_rows);
+    if (nsplit < 2) return;
+    nsplit = utils::div_up(rows, utils::div_up(rows, nsplit));
+
+    partial_conf_.reduce_size = rows;
+    partial_conf_.inner_size = row_size;
+    partial_conf_.inner_block = block;
+    partial_conf_.idle_size = conf_.outer_size * row_size;
+    partial_conf_.nsplit = nsplit;
+
+    conf_.src_type = data_type::f32;
+    conf_.src_dt_size = sizeof(float);
+    conf_.transform_src = false;
+    conf_.reduce_size = conf_.inner_size == 1 ? nsplit * row_size : nsplit;
+    conf_.nsplit = nsplit;
+    if (conf_.inner_size > 1)
+        conf_.inner_block = nstl::min(conf_.inner_size,
+                kernel_t::max_vertical_unroll * get_simd_w(conf_));
+}
 
-    conf_.alg = desc()->alg_kind;
-    if (utils::one_of(conf_.alg, reduction_norm_lp_max, reduction_norm_lp_sum,
-                reduction_norm_lp_power_p_max, reduction_norm_lp_power_p_sum))
-        return status::unimplemented;
+void jit_uni_reduction_t::pd_t::init_scratchpad() {
+    if (conf_.nsplit == 1) return;
 
-    return status::success;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book<float>(memory_tracking::names::key_reduction,
+            conf_.outer_size * conf_.nsplit * partial_conf_.inner_size);
 }
 
 status_t jit_uni_reduction_t::init(engine_t *engine) {
-    using namespace format_tag;
-
     const memory_desc_t *dst_md = pd()->dst_md();
     const jit_reduction_conf_t &conf = pd()->get_conf();
+    const bool is_trailing_arg = pd()->is_arg_alg() && conf.inner_size == 1;
 
-    CHECK(get_proper_kernel(dst_md, conf));
-    CHECK(kernel_->create_kernel());
+    if (!is_trailing_arg)
+        CHECK(create_kernels(kernel_, kernel_tail_, dst_md, conf));
+    if (conf.nsplit > 1 || is_trailing_arg)
+        CHECK(create_kernels(partial_kernel_, partial_kernel_tail_, dst_md,
+                pd()->get_partial_conf()));
 
     return status::success;
 }
 
-status_t jit_uni_reduction_t::execute(const exec_ctx_t &ctx) const {
-    const auto src = CTX_IN_MEM(const uint8_t *, DNNL_ARG_SRC);
-    auto dst = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DST);
+status_t jit_uni_reduction_t::create_kernels(std::unique_ptr<kernel_t> &kernel,
+        std::unique_ptr<kernel_t> &kernel_tail, const memory_desc_t *dst_md,
+        const jit_reduction_conf_t &conf) {
+    if (conf.inner_size == 1) {
+        CHECK(get_proper_kernel(kernel, dst_md, conf, 0));
+        return kernel->create_kernel();
+    }
 
-    const dim_t idle_size = pd()->get_conf().idle_size;
-    const dim_t reduce_size = pd()->get_conf().reduce_size;
-    const std::size_t src_dt_size = pd()->get_conf().src_dt_size;
-    const std::size_t dst_dt_size = pd()->get_conf().dst_dt_size;
-    const auto &post_ops = pd()->attr()->post_ops_;
-    const auto &post_ops_binary_rhs_arg_vec
-            = binary_injector::prepare_binary_args(post_ops, ctx);
+    CHECK(get_proper_kernel(kernel, dst_md, conf, conf.inner_block));
+    CHECK(kernel->create_kernel());
+
+    const dim_t tail = conf.inner_size % conf.inner_block;
+    if (tail > 0) {
+        CHECK(get_proper_kernel(kernel_tail, dst_md, conf, tail));
+        CHECK(kernel_tail->create_kernel());
+    }
+
+    return status::success;
+}
+
+void jit_uni_reduction_t::reduce(const jit_reduction_conf_t &conf,
+        const kernel_t *kernel, const kernel_t *kernel_tail,
+        const uint8_t *src, uint8_t *dst,
+        const void *post_ops_binary_rhs_arg_vec) const {
+    const dim_t reduce_size = conf.reduce_size;
+    const dim_t inner_size = conf.inner_size;
+    const std::size_t src_dt_size = conf.src_dt_size;
+    const std::size_t dst_dt_size = conf.dst_dt_size;
+
+    if (inner_size == 1) {
+        parallel_nd(conf.outer_size, [&](dim_t i) {
+            const dim_t src_off = i * reduce_size * src_dt_size;
+            const dim_t dst_off = i * dst_dt_size;
+
+            jit_reduction_call_s args = jit_reduction_call_s();
+            args.src = src + src_off;
+            args.dst = dst + dst_off;
+            args.dst_orig = dst;
+            args.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec;
+
+            (*kernel)(&args);
+        });
+        return;
+    }
 
-    parallel_nd(idle_size, [&](dim_t i) {
-        const dim_t src_off = i * reduce_size * src_dt_size;
-        const dim_t dst_off = i * dst_dt_size;
+    const dim_t block = conf.inner_block;
+    const dim_t nblocks = utils::div_up(inner_size, block);
+    parallel_nd(conf.outer_size, nblocks, [&](dim_t o, dim_t b) {
+        const dim_t inner_off = b * block;
+        const dim_t src_off
+                = (o * reduce_size * inner_size + inner_off) * src_dt_size;
+        const dim_t dst_off = (o * inner_size + inner_off) * dst_dt_size;
 
         jit_reduction_call_s args = jit_reduction_call_s();
         args.src = src + src_off;
         args.dst = dst + dst_off;
+        args.reduce_work = reduce_size;
         args.dst_orig = dst;
-        args.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec.data();
+        args.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec;
 
-        (*kernel_)(&args);
+        if (inner_off + block > inner_size)
+            (*kernel_tail)(&args);
+        else
+            (*kernel)(&args);
     });
+}
+
+void jit_uni_reduction_t::reduce_trailing_arg(
+        const uint8_t *src, uint8_t *dst) const {
+    const auto &conf = pd()->get_conf();
+    const auto &pconf = pd()->get_partial_conf();
+    const bool is_max = conf.alg == alg_kind::reduction_argmax;
+    const dim_t reduce_size = conf.reduce_size;
+    const dim_t rows = pconf.reduce_size;
+    const dim_t row_size = pconf.inner_size;
+    // The longest row is max_vertical_unroll zmm vectors.
+    static constexpr dim_t max_row_size = kernel_t::max_vertical_unroll * 16;
+    assert(row_size <= max_row_size);
+
+    parallel_nd(conf.outer_size, [&](dim_t o) {
+        const uint8_t *src_o = src + o * reduce_size * conf.src_dt_size;
+        float best = is_max ? -nstl::numeric_limits<float>::infinity()
+                            : nstl::numeric_limits<float>::infinity();
+        dim_t best_idx = 0;
+
+        // The kernel keeps the first best value for every lane of the
+        // rows. Among the lanes, equal values are resolved by the index.
+        if (rows > 0) {
+            float vals[max_row_size], idxs[max_row_size];
+
+            jit_reduction_call_s args = jit_reduction_call_s();
+            args.src = src_o;
+            args.dst = vals;
+            args.dst_idx = idxs;
+            args.reduce_work = rows;
+            (*partial_kernel_)(&args);
+
+            for (dim_t l = 0; l < row_size; l++) {
+                const dim_t idx = static_cast<dim_t>(idxs[l]) * row_size + l;
+                const bool is_better = is_max ? vals[l] > best
+                                              : vals[l] < best;
+                if (is_better || (vals[l] == best && idx < best_idx)) {
+                    best = vals[l];
+                    best_idx = idx;
+                }
+            }
+        }
+
+        for (dim_t i = rows * row_size; i < reduce_size; i++) {
+            const float val
+                    = cpu::io::load_float_value(conf.src_type, src_o, i);
+            if (is_max ? val > best : val < best) {
+                best = val;
+                best_idx = i;
+            }
+        }
+
+        reinterpret_cast<int32_t *>(dst)[o] = static_cast<int32_t>(best_idx);
+    });
+}
+
+status_t jit_uni_reduction_t::execute(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const uint8_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DST);
+
+    const auto &conf = pd()->get_conf();
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    if (dst_d.has_zero_dim()) return status::success;
+    src += src_d.offset0() * src_d.data_type_size();
+    dst += dst_d.offset0() * dst_d.data_type_size();
+
+    const auto &post_ops = pd()->attr()->post_ops_;
+    const auto &post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(post_ops, ctx);
+
+    if (pd()->is_arg_alg() && conf.inner_size == 1) {
+        reduce_trailing_arg(src, dst);
+        return status::success;
+    }
+
+    if (conf.nsplit == 1) {
+        reduce(conf, kernel_.get(), kernel_tail_.get(), src, dst,
+                post_ops_binary_rhs_arg_vec.data());
+        return status::success;
+    }
+
+    // The first stage reduces the chunks of rows into a
+    // [outer][nsplit][row_size] buffer.
+    const auto &pconf = pd()->get_partial_conf();
+    auto partial = ctx.get_scratchpad_grantor().template get<float>(
+            memory_tracking::names::key_reduction);
+
+    const dim_t nsplit = conf.nsplit;
+    const dim_t rows = pconf.reduce_size;
+    const dim_t row_size = pconf.inner_size;
+    const dim_t chunk_rows = utils::div_up(rows, nsplit);
+    const dim_t block = pconf.inner_block;
+    const dim_t nblocks = utils::div_up(row_size, block);
+    const std::size_t src_dt_size = pconf.src_dt_size;
+
+    parallel_nd(pconf.outer_size, nsplit, nblocks,
+            [&](dim_t o, dim_t c, dim_t b) {
+                const dim_t row_off = c * chunk_rows;
+                const dim_t inner_off = b * block;
+                const dim_t src_off
+                        = ((o * rows + row_off) * row_size + inner_off)
+                        * src_dt_size;
+                const dim_t partial_off
+                        = (o * nsplit + c) * row_size + inner_off;
+
+                jit_reduction_call_s args = jit_reduction_call_s();
+                args.src = src + src_off;
+                args.dst = partial + partial_off;
+                args.reduce_work = nstl::min(chunk_rows, rows - row_off);
+
+                if (inner_off + block > row_size)
+                    (*partial_kernel_tail_)(&args);
+                else
+                    (*partial_kernel_)(&args);
+            });
+
+    reduce(conf, kernel_.get(), kernel_tail_.get(),
+            reinterpret_cast<const uint8_t *>(partial), dst,
+            post_ops_binary_rhs_arg_vec.data());
 
     return status::success;
 }
 
 status_t jit_uni_reduction_t::get_proper_kernel(
-        const memory_desc_t *dst_md, const jit_reduction_conf_t &conf) {
+        std::unique_ptr<kernel_t> &kernel, const memory_desc_t *dst_md,
+        const jit_reduction_conf_t &conf, dim_t block) {
     using namespace data_type;
 
     if (conf.isa == avx512_core_bf16)
-        return safe_ptr_assign(kernel_,
-                new jit_uni_reduction_kernel_t<avx512_core_bf16>(conf, dst_md));
+        return create_kernel<avx512_core_bf16>(kernel, dst_md, conf, block);
     else if (conf.isa == avx512_core)
-        return safe_ptr_assign(kernel_,
-                new jit_uni_reduction_kernel_t<avx512_core>(conf, dst_md));
+        return create_kernel<avx512_core>(kernel, dst_md, conf, block);
     else if (is_superset(conf.isa, avx)) {
         const bool is_src_i8 = utils::one_of(conf.src_type, s8, u8);
         const bool is_dst_i8 = utils::one_of(conf.dst_type, s8, u8);
         if (conf.isa == avx2) {
             if (is_src_i8 || is_dst_i8)
-                return safe_ptr_assign(kernel_,
-                        new jit_uni_reduction_kernel_t<avx2, Xbyak::Xmm>(
-                                conf, dst_md));
+                return create_kernel<avx2, Xbyak::Xmm>(
+                        kernel, dst_md, conf, block);
             else
-                return safe_ptr_assign(kernel_,
-                        new jit_uni_reduction_kernel_t<avx2>(conf, dst_md));
+                return create_kernel<avx2>(kernel, dst_md, conf, block);
         } else {
             if (is_src_i8 || is_dst_i8)
-                return safe_ptr_assign(kernel_,
-                        new jit_uni_reduction_kernel_t<avx, Xbyak::Xmm>(
-                                conf, dst_md));
+                return create_kernel<avx, Xbyak::Xmm>(
+                        kernel, dst_md, conf, block);
             else
-                return safe_ptr_assign(kernel_,
-                        new jit_uni_reduction_kernel_t<avx>(conf, dst_md));
+                return create_kernel<avx>(kernel, dst_md, conf, block);
         }
     } else if (conf.isa == sse41)
-        return safe_ptr_assign(
-                kernel_, new jit_uni_reduction_kernel_t<sse41>(conf, dst_md));
+        return create_kernel<sse41>(kernel, dst_md, conf, block);
     else
         return status::runtime_error;
 }
@@ -41,11 +41,19 @@ struct jit_uni_reduction_t : public primitive_t {
         status_t init(engine_t *engine);
 
         const jit_reduction_conf_t &get_conf() const { return conf_; };
+        const jit_reduction_conf_t &get_partial_conf() const {
+            return partial_conf_;
+        };
 
     private:
-        bool fill_post_ops_conf();
+        bool init_shape();
+        void init_split();
+        void init_scratchpad();
 
+        // With a split reduction conf_ describes the second stage, which
+        // reduces the partial results computed under partial_conf_.
         jit_reduction_conf_t conf_;
+        jit_reduction_conf_t partial_conf_;
     };
 
     jit_uni_reduction_t(const pd_t *apd) : primitive_t(apd) {}
@@ -55,12 +63,32 @@ struct jit_uni_reduction_t : public primitive_t {
     status_t execute(const exec_ctx_t &ctx) const override;
 
 private:
-    status_t get_proper_kernel(
+    using kernel_t = jit_uni_reduction_kernel_base_t;
+
+    // block == 0 selects the horizontal kernel, otherwise the vertical one
+    // processing block inner elements.
+    static status_t get_proper_kernel(std::unique_ptr<kernel_t> &kernel,
+            const memory_desc_t *dst_md, const jit_reduction_conf_t &conf,
+            dim_t block);
+    static status_t create_kernels(std::unique_ptr<kernel_t> &kernel,
+            std::unique_ptr<kernel_t> &kernel_tail,
             const memory_desc_t *dst_md, const jit_reduction_conf_t &conf);
 
+    void reduce(const jit_reduction_conf_t &conf, const kernel_t *kernel,
+            const kernel_t *kernel_tail, const uint8_t *src, uint8_t *dst,
+            const void *post_ops_binary_rhs_arg_vec) const;
+    // Computes arg reductions over the trailing dimensions with the partial
+    // kernel and merges the results of its lanes.
+    void reduce_trailing_arg(const uint8_t *src, uint8_t *dst) const;
+
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
-    std::unique_ptr<jit_uni_reduction_kernel_base_t> kernel_;
+    // kernel_tail_ processes the remainder of the inner size which is not a
+    // multiple of conf.inner_block.
+    std::unique_ptr<kernel_t> kernel_;
+    std::unique_ptr<kernel_t> kernel_tail_;
+    std::unique_ptr<kernel_t> partial_kernel_;
+    std::unique_ptr<kernel_t> partial_kernel_tail_;
 };
 
 } // namespace x64
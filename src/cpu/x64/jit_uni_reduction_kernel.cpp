@@ -34,6 +34,87 @@ static const bcast_set_t &get_supported_postops_bcast_strategies() {
     return supported_strategies;
 }
 
+float jit_uni_reduction_kernel_base_t::get_acc_init_value() const {
+    using namespace alg_kind;
+    using namespace nstl;
+
+    switch (conf_.alg) {
+        case reduction_max: return numeric_limits<float>::lowest();
+        case reduction_min: return numeric_limits<float>::max();
+        case reduction_mul: return 1.f;
+        case reduction_mean:
+        case reduction_sum:
+        case reduction_norm_lp_max:
+        case reduction_norm_lp_sum:
+        case reduction_norm_lp_power_p_max:
+        case reduction_norm_lp_power_p_sum: return 0.f;
+        case reduction_argmax: return -numeric_limits<float>::infinity();
+        case reduction_argmin: return numeric_limits<float>::infinity();
+        default: assert(!"unknown alg");
+    }
+    return 0.f;
+}
+
+bool jit_uni_reduction_kernel_base_t::is_lp_alg() const {
+    using namespace alg_kind;
+    return utils::one_of(conf_.alg, reduction_norm_lp_max,
+            reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
+            reduction_norm_lp_power_p_sum);
+}
+
+bool jit_uni_reduction_kernel_base_t::is_arg_alg() const {
+    using namespace alg_kind;
+    return utils::one_of(conf_.alg, reduction_argmax, reduction_argmin);
+}
+
+template <typename Vmm>
+void jit_uni_reduction_kernel_base_t::broadcast_f32(
+        const Vmm &vmm, float value, const Reg64 &reg_tmp) {
+    const Xmm xmm(vmm.getIdx());
+    mov(reg_tmp.cvt32(), float2int(value));
+    uni_vmovd(xmm, reg_tmp.cvt32());
+    uni_vbroadcastss(vmm, xmm);
+}
+
+template <typename Vmm>
+void jit_uni_reduction_kernel_base_t::init_abs_mask(
+        const Vmm &vmm_abs_mask, const Reg64 &reg_tmp) {
+    const Xmm xmm(vmm_abs_mask.getIdx());
+    mov(reg_tmp.cvt32(), 0x7fffffff);
+    uni_vmovd(xmm, reg_tmp.cvt32());
+    uni_vbroadcastss(vmm_abs_mask, xmm);
+}
+
+template <typename Vmm>
+void jit_uni_reduction_kernel_base_t::transform_src(
+        const Vmm &vmm, const Vmm &vmm_abs_mask) {
+    if (!conf_.transform_src || !is_lp_alg()) return;
+
+    if (conf_.p == 1.f)
+        uni_vandps(vmm, vmm, vmm_abs_mask);
+    else
+        uni_vmulps(vmm, vmm, vmm);
+}
+
+template <typename Vmm>
+void jit_uni_reduction_kernel_base_t::finalize_lp(
+        const Vmm &vmm_acc, const Vmm &vmm_tmp, const Reg64 &reg_tmp) {
+    using namespace alg_kind;
+    if (!is_lp_alg()) return;
+
+    broadcast_f32(vmm_tmp, conf_.eps, reg_tmp);
+    if (utils::one_of(conf_.alg, reduction_norm_lp_max,
+                reduction_norm_lp_power_p_max))
+        uni_vmaxps(vmm_acc, vmm_acc, vmm_tmp);
+    else
+        uni_vaddps(vmm_acc, vmm_acc, vmm_tmp);
+
+    if (conf_.p == 2.f
+            && utils::one_of(
+                    conf_.alg, reduction_norm_lp_max, reduction_norm_lp_sum))
+        uni_vsqrtps(vmm_acc, vmm_acc);
+}
+
 template <cpu_isa_t isa, typename Vmm>
 jit_uni_reduction_kernel_t<isa, Vmm>::jit_uni_reduction_kernel_t(
         const jit_reduction_conf_t &conf, const memory_desc_t *dst_md)
@@ -60,26 +141,7 @@ jit_uni_reduction_kernel_t<isa, Vmm>::jit_uni_reduction_kernel_t(
 
 template <cpu_isa_t isa, typename Vmm>
 void jit_uni_reduction_kernel_t<isa, Vmm>::init_acc() {
-    using namespace alg_kind;
-    using namespace nstl;
-
-    const Xmm xmm_tmp_(vmm_tmp1_.getIdx());
-    float starting_val = 0;
-
-    switch (conf_.alg) {
-        case reduction_max:
-            starting_val = numeric_limits<float>::lowest();
-            break;
-        case reduction_min: starting_val = numeric_limits<float>::max(); break;
-        case reduction_mean:
-        case reduction_sum: starting_val = 0.f; break;
-        case reduction_mul: starting_val = 1.f; break;
-        default: assert(!"unknown alg");
-    }
-
-    mov(reg_tmp_.cvt32(), float2int(starting_val));
-    uni_vmovd(xmm_tmp_, reg_tmp_.cvt32());
-    uni_vbroadcastss(vmm_acc_, xmm_tmp_);
+    broadcast_f32(vmm_acc_, get_acc_init_value(), reg_tmp_);
 }
 
 template <cpu_isa_t isa, typename Vmm>
@@ -98,6 +160,10 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::init_compute_op() {
             break;
         case reduction_mean:
         case reduction_sum:
+        case reduction_norm_lp_max:
+        case reduction_norm_lp_sum:
+        case reduction_norm_lp_power_p_max:
+        case reduction_norm_lp_power_p_sum:
             compute_op_ = [&](const Xbyak::Xmm &acc, const Xbyak::Xmm &to_acc) {
                 uni_vaddps(acc, acc, to_acc);
             };
@@ -130,6 +196,10 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::init_compute_scalar_op() {
             break;
         case reduction_mean:
         case reduction_sum:
+        case reduction_norm_lp_max:
+        case reduction_norm_lp_sum:
+        case reduction_norm_lp_power_p_max:
+        case reduction_norm_lp_power_p_sum:
             compute_scalar_op_
                     = [&](const Xbyak::Xmm &acc, const Xbyak::Xmm &to_acc) {
                           addss(acc, to_acc);
@@ -271,6 +341,7 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce() {
         cmp(reg_work_, 0);
         je(label_work_end);
         io_load_.load(ptr[reg_src_], vmm_tmp1_, false);
+        transform_src(vmm_tmp1_, vmm_abs_mask_);
         compute_op_(vmm_acc_, vmm_tmp1_);
 
         add(reg_src_, simd_w_ * conf_.src_dt_size);
@@ -282,6 +353,7 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce() {
 
     if (load_tail_size_) {
         io_load_.load(ptr[reg_src_], vmm_tmp1_, true);
+        transform_src(vmm_tmp1_, vmm_abs_mask_);
         reduce_vmm_to_scalar(
                 vmm_tmp1_, vmm_tmp2_, vmm_tmp3_, vmm_tmp4_, load_tail_size_);
         compute_scalar_op_(Xmm(vmm_acc_.getIdx()), Xmm(vmm_tmp1_.getIdx()));
@@ -344,15 +416,20 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::finalize() {
                 vmm_acc_, vmm_tmp1_, vmm_tmp2_, vmm_tmp3_, simd_w_);
     }
 
-    if (conf_.alg == alg_kind::reduction_mean) {
-        const Xmm xmm_acc(vmm_acc_.getIdx());
-        const Xmm xmm_reduce_size(vmm_tmp1_.getIdx());
-        mov(reg_tmp_.cvt32(), float2int(static_cast<float>(conf_.reduce_size)));
-        uni_vmovd(xmm_reduce_size, reg_tmp_.cvt32());
-        uni_vdivss(xmm_acc, xmm_acc, xmm_reduce_size);
-    }
+    if (conf_.finalize) {
+        if (conf_.alg == alg_kind::reduction_mean) {
+            const Xmm xmm_acc(vmm_acc_.getIdx());
+            const Xmm xmm_reduce_size(vmm_tmp1_.getIdx());
+            mov(reg_tmp_.cvt32(),
+                    float2int(static_cast<float>(conf_.div_size)));
+            uni_vmovd(xmm_reduce_size, reg_tmp_.cvt32());
+            uni_vdivss(xmm_acc, xmm_acc, xmm_reduce_size);
+        }
 
-    if (conf_.with_postops) apply_postops(vmm_acc_.getIdx());
+        finalize_lp(vmm_acc_, vmm_tmp1_, reg_tmp_);
+
+        if (conf_.with_postops) apply_postops(vmm_acc_.getIdx());
+    }
 
     io_store_.store(vmm_acc_, ptr[reg_dst_], true);
 }
@@ -368,6 +445,8 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::generate() {
     io_store_.prepare_tail_mask();
 
     load_params();
+    if (is_lp_alg() && conf_.transform_src && conf_.p == 1.f)
+        init_abs_mask(vmm_abs_mask_, reg_tmp_);
     init_acc();
     reduce();
     finalize();
@@ -378,6 +457,241 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::generate() {
         postops_injector_->prepare_table();
 }
 
+template <cpu_isa_t isa, typename Vmm>
+jit_uni_reduction_vertical_kernel_t<isa, Vmm>::
+        jit_uni_reduction_vertical_kernel_t(const jit_reduction_conf_t &conf,
+                const memory_desc_t *dst_md, dim_t block)
+    : jit_uni_reduction_kernel_base_t(conf)
+    , n_vecs_(utils::div_up(block, simd_w_))
+    , tail_size_(block % simd_w_)
+    , io_load_(this, isa, conf_.src_type, {false},
+              io::io_tail_conf_t {simd_w_, tail_size_, k_tail_load_mask_,
+                      vmm_tail_load_mask_.getIdx(), reg_tmp_},
+              io::io_emu_bf16_conf_t {vmm_bf16_emu_1_, vmm_bf16_emu_2_,
+                      vmm_bf16_emu_3_, reg_tmp_, vmm_bf16_emu_4_},
+              io::io_saturation_conf_t {vmm_zero_saturation_.getIdx(),
+                      vmm_saturation_ubound_.getIdx(), reg_tmp_})
+    , io_store_(this, isa, conf_.dst_type, {false},
+              io::io_tail_conf_t {simd_w_, tail_size_, k_tail_store_mask_,
+                      vmm_tail_store_mask_.getIdx(), reg_tmp_},
+              io::io_emu_bf16_conf_t {vmm_bf16_emu_1_, vmm_bf16_emu_2_,
+                      vmm_bf16_emu_3_, reg_tmp_, vmm_bf16_emu_4_},
+              io::io_saturation_conf_t {vmm_zero_saturation_.getIdx(),
+                      vmm_saturation_ubound_.getIdx(), reg_tmp_}) {
+    assert(n_vecs_ > 0 && n_vecs_ <= max_vertical_unroll);
+    if (conf_.with_postops) init_post_ops_injector(dst_md);
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_vertical_kernel_t<isa, Vmm>::init_post_ops_injector(
+        const memory_desc_t *dst_md) {
+    const memory_desc_wrapper dst_d(*dst_md);
+
+    const eltwise_injector::static_params_t esp(true /*save_state*/,
+            reg_po_injector_helper_1_, elt_inj_opmask_, true /*is_fwd*/,
+            false /*use_dst*/);
+    const binary_injector::rhs_arg_static_params_t rhs_arg_bsp {
+            static_cast<size_t>(rhs_dt_helper_vmm_.getIdx()),
+            reg_po_injector_helper_1_, reg_po_injector_helper_2_,
+            true /*preserve gpr*/, true /*preserve vmm*/,
+            GET_OFF(post_ops_binary_rhs_arg_vec), GET_OFF(dst_orig), dst_d,
+            tail_size_, k_tail_store_mask_,
+            false /*use_exact_tail_scalar_bcast*/};
+    const binary_injector::static_params_t bsp(
+            reg_param_, get_supported_postops_bcast_strategies(), rhs_arg_bsp);
+
+    postops_injector_ = utils::make_unique<
+            injector::jit_uni_postops_injector_t<inject_isa_, Vmm>>(
+            this, conf_.post_ops, bsp, esp);
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_vertical_kernel_t<isa, Vmm>::compute_op(
+        const Vmm &acc, const Vmm &to_acc) {
+    using namespace alg_kind;
+    switch (conf_.alg) {
+        case reduction_max: uni_vmaxps(acc, acc, to_acc); break;
+        case reduction_min: uni_vminps(acc, acc, to_acc); break;
+        case reduction_mul: uni_vmulps(acc, acc, to_acc); break;
+        case reduction_mean:
+        case reduction_sum:
+        case reduction_norm_lp_max:
+        case reduction_norm_lp_sum:
+        case reduction_norm_lp_power_p_max:
+        case reduction_norm_lp_power_p_sum:
+            uni_vaddps(acc, acc, to_acc);
+            break;
+        default: assert(!"unsupported alg.");
+    }
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_vertical_kernel_t<isa, Vmm>::update_arg(const int u) {
+    // The lanes are updated only with strictly better values, so equal
+    // values keep the first index and NaNs are never selected.
+    const bool is_max = conf_.alg == alg_kind::reduction_argmax;
+    const Vmm &lhs = is_max ? vmm_acc(u) : vmm_tmp_;
+    const Vmm &rhs = is_max ? vmm_tmp_ : vmm_acc(u);
+
+    if (is_zmm_) {
+        vcmpps(k_arg_mask_, lhs, rhs, _cmp_lt_os);
+        vblendmps(vmm_acc(u) | k_arg_mask_, vmm_acc(u), vmm_tmp_);
+        vblendmps(vmm_idx(u) | k_arg_mask_, vmm_idx(u), vmm_row_);
+    } else {
+        uni_vcmpps(vmm_arg_mask(), lhs, rhs, _cmp_lt_os);
+        uni_vblendvps(vmm_acc(u), vmm_acc(u), vmm_tmp_, vmm_arg_mask());
+        uni_vblendvps(vmm_idx(u), vmm_idx(u), vmm_row_, vmm_arg_mask());
+    }
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_vertical_kernel_t<isa, Vmm>::reduce() {
+    Label label_work_begin, label_work_end;
+
+    L(label_work_begin);
+    {
+        cmp(reg_work_, 0);
+        je(label_work_end, T_NEAR);
+        for (int u = 0; u < n_vecs_; u++) {
+            io_load_.load(ptr[reg_src_ + u * simd_w_ * conf_.src_dt_size],
+                    vmm_tmp_, is_tail(u));
+            if (is_arg_alg())
+                update_arg(u);
+            else {
+                transform_src(vmm_tmp_, vmm_aux_);
+                compute_op(vmm_acc(u), vmm_tmp_);
+            }
+        }
+        if (is_arg_alg()) uni_vaddps(vmm_row_, vmm_row_, vmm_one_);
+
+        safe_add(reg_src_, conf_.inner_size * conf_.src_dt_size, reg_tmp1_);
+
+        dec(reg_work_);
+        jmp(label_work_begin, T_NEAR);
+    }
+    L(label_work_end);
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_vertical_kernel_t<isa, Vmm>::apply_sum(const int u) {
+    if (conf_.with_sum) {
+        assert(!conf_.sum_scales.empty()
+                && "No scales for sum post operation.");
+        const auto sum_injector = [this, u]() {
+            const Vmm vmm_prev_dst = vmm_tmp_;
+            const Vmm vmm_dst = vmm_acc(u);
+
+            io_store_.load(ptr[reg_dst_ + u * simd_w_ * conf_.dst_dt_size],
+                    vmm_prev_dst, is_tail(u));
+            const float sum_scale = sum_scales_.front();
+            if (sum_scale == 1.f)
+                uni_vaddps(vmm_dst, vmm_dst, vmm_prev_dst);
+            else {
+                broadcast_f32(vmm_sum_scale_, sum_scale, reg_tmp1_);
+                uni_vfmadd231ps(vmm_dst, vmm_prev_dst, vmm_sum_scale_);
+            }
+            sum_scales_.push(sum_scale);
+            sum_scales_.pop();
+        };
+        postops_injector_->set_lambda_injector(
+                primitive_kind::sum, sum_injector);
+    }
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_vertical_kernel_t<isa, Vmm>::apply_postops(
+        const int u) {
+    binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
+    const int data_idx = vmm_acc(u).getIdx();
+
+    if (conf_.with_sum) apply_sum(u);
+
+    if (conf_.with_binary) {
+        rhs_arg_params.vmm_idx_to_out_addr.emplace(
+                data_idx, ptr[reg_dst_ + u * simd_w_ * conf_.dst_dt_size]);
+        if (is_tail(u)) rhs_arg_params.vmm_tail_idx_.emplace(data_idx);
+    }
+
+    postops_injector_->compute_vector(data_idx, rhs_arg_params);
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_vertical_kernel_t<isa, Vmm>::finalize() {
+    if (!conf_.finalize) return;
+
+    if (conf_.alg == alg_kind::reduction_mean) {
+        broadcast_f32(
+                vmm_aux_, static_cast<float>(conf_.div_size), reg_tmp_);
+        for (int u = 0; u < n_vecs_; u++)
+            uni_vdivps(vmm_acc(u), vmm_acc(u), vmm_aux_);
+    }
+
+    for (int u = 0; u < n_vecs_; u++)
+        finalize_lp(vmm_acc(u), vmm_aux_, reg_tmp_);
+
+    if (conf_.with_postops)
+        for (int u = 0; u < n_vecs_; u++)
+            apply_postops(u);
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_vertical_kernel_t<isa, Vmm>::store() {
+    if (is_arg_alg()) {
+        const Reg64 &reg_dst_idx = conf_.finalize ? reg_dst_ : reg_tmp1_;
+        if (!conf_.finalize)
+            mov(reg_dst_idx, ptr[reg_param_ + GET_OFF(dst_idx)]);
+        for (int u = 0; u < n_vecs_; u++)
+            io_store_.store(vmm_idx(u),
+                    ptr[reg_dst_idx + u * simd_w_ * conf_.dst_dt_size],
+                    is_tail(u));
+        if (conf_.finalize) return;
+    }
+
+    for (int u = 0; u < n_vecs_; u++)
+        io_store_.store(vmm_acc(u),
+                ptr[reg_dst_ + u * simd_w_ * conf_.dst_dt_size], is_tail(u));
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_vertical_kernel_t<isa, Vmm>::generate() {
+    preamble();
+
+    io_store_.init_bf16();
+    if (conf_.is_saturation_needed) io_store_.init_saturate_f32();
+
+    if (tail_size_ > 0) {
+        io_load_.prepare_tail_mask();
+        io_store_.prepare_tail_mask();
+    }
+
+    mov(reg_src_, ptr[reg_param_ + GET_OFF(src)]);
+    mov(reg_dst_, ptr[reg_param_ + GET_OFF(dst)]);
+    mov(reg_work_, ptr[reg_param_ + GET_OFF(reduce_work)]);
+
+    if (is_lp_alg() && conf_.transform_src && conf_.p == 1.f)
+        init_abs_mask(vmm_aux_, reg_tmp_);
+
+    broadcast_f32(vmm_acc(0), get_acc_init_value(), reg_tmp_);
+    for (int u = 1; u < n_vecs_; u++)
+        uni_vmovups(vmm_acc(u), vmm_acc(0));
+
+    if (is_arg_alg()) {
+        for (int u = 0; u < n_vecs_; u++)
+            uni_vxorps(vmm_idx(u), vmm_idx(u), vmm_idx(u));
+        uni_vxorps(vmm_row_, vmm_row_, vmm_row_);
+        broadcast_f32(vmm_one_, 1.f, reg_tmp_);
+    }
+
+    reduce();
+    finalize();
+    store();
+
+    postamble();
+
+    if (conf_.with_eltwise && postops_injector_)
+        postops_injector_->prepare_table();
+}
+
 template struct jit_uni_reduction_kernel_t<avx512_core_bf16>;
 template struct jit_uni_reduction_kernel_t<avx512_core>;
 template struct jit_uni_reduction_kernel_t<avx2>;
@@ -386,6 +700,14 @@ template struct jit_uni_reduction_kernel_t<avx>;
 template struct jit_uni_reduction_kernel_t<avx, Xbyak::Xmm>;
 template struct jit_uni_reduction_kernel_t<sse41>;
 
+template struct jit_uni_reduction_vertical_kernel_t<avx512_core_bf16>;
+template struct jit_uni_reduction_vertical_kernel_t<avx512_core>;
+template struct jit_uni_reduction_vertical_kernel_t<avx2>;
+template struct jit_uni_reduction_vertical_kernel_t<avx2, Xbyak::Xmm>;
+template struct jit_uni_reduction_vertical_kernel_t<avx>;
+template struct jit_uni_reduction_vertical_kernel_t<avx, Xbyak::Xmm>;
+template struct jit_uni_reduction_vertical_kernel_t<sse41>;
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
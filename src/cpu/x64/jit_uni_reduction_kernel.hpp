@@ -44,7 +44,30 @@ struct jit_uni_reduction_kernel_base_t : public jit_generator {
 
     virtual std::size_t get_simd_w() = 0;
 
+    // Maximum number of vector registers accumulating different inner
+    // elements in the vertical kernel.
+    static constexpr int max_vertical_unroll = 4;
+
 protected:
+    float get_acc_init_value() const;
+    bool is_lp_alg() const;
+    bool is_arg_alg() const;
+
+    template <typename Vmm>
+    void broadcast_f32(
+            const Vmm &vmm, float value, const Xbyak::Reg64 &reg_tmp);
+    template <typename Vmm>
+    void init_abs_mask(const Vmm &vmm_abs_mask, const Xbyak::Reg64 &reg_tmp);
+    // Replaces the source values with |x|^p for lp algorithms. The mask is
+    // needed for p == 1 only.
+    template <typename Vmm>
+    void transform_src(const Vmm &vmm, const Vmm &vmm_abs_mask);
+    // Applies eps and the p-th root (for lp_max and lp_sum) to the sums of
+    // |x|^p.
+    template <typename Vmm>
+    void finalize_lp(const Vmm &vmm_acc, const Vmm &vmm_tmp,
+            const Xbyak::Reg64 &reg_tmp);
+
     const jit_reduction_conf_t &conf_;
     std::queue<float> sum_scales_;
 };
@@ -100,6 +123,7 @@ private:
     const Vmm vmm_tmp4_ = Vmm(8);
     const Vmm vmm_sum_scale_ = Vmm(9);
     const Vmm rhs_dt_helper_vmm_ = Vmm(10);
+    const Vmm vmm_abs_mask_ = Vmm(11);
     const Xbyak::Zmm vmm_bf16_emu_1_ = Xbyak::Zmm(28);
     const Xbyak::Zmm vmm_bf16_emu_2_ = Xbyak::Zmm(29);
     const Xbyak::Zmm vmm_bf16_emu_3_ = Xbyak::Zmm(30);
@@ -143,6 +167,90 @@ private:
             postops_injector_;
 };
 
+// Reduces a [reduce_work][conf.inner_size] source over its rows. A call
+// processes `block` consecutive inner elements, kept in up to
+// max_vertical_unroll vector accumulators; block is conf.inner_block or the
+// remainder of the inner size for the tail kernel. The number of rows is
+// passed at runtime, so that the same kernel computes the chunks of a split
+// reduction. For arg algorithms the row index of the selected value is kept
+// as f32 next to every accumulator and stored instead of the value, or
+// together with it without finalization.
+template <cpu_isa_t isa, typename Vmm = typename cpu_isa_traits<isa>::Vmm>
+struct jit_uni_reduction_vertical_kernel_t
+    : public jit_uni_reduction_kernel_base_t {
+    jit_uni_reduction_vertical_kernel_t(const jit_reduction_conf_t &conf,
+            const memory_desc_t *dst_md, dim_t block);
+
+    virtual ~jit_uni_reduction_vertical_kernel_t() = default;
+
+    std::size_t get_simd_w() override { return simd_w_; }
+
+private:
+    void init_post_ops_injector(const memory_desc_t *dst_md);
+
+    void compute_op(const Vmm &acc, const Vmm &to_acc);
+    void update_arg(const int u);
+    void reduce();
+    void apply_sum(const int u);
+    void apply_postops(const int u);
+    void finalize();
+    void store();
+    void generate() override;
+
+    Vmm vmm_acc(int u) const { return Vmm(8 + u); }
+    Vmm vmm_idx(int u) const { return Vmm(8 + max_vertical_unroll + u); }
+    bool is_tail(int u) const { return tail_size_ > 0 && u == n_vecs_ - 1; }
+    // blendvps takes the mask in xmm0 which is not used for tails on sse41.
+    Vmm vmm_arg_mask() const { return isa == sse41 ? Vmm(0) : Vmm(7); }
+
+    const Vmm vmm_tail_load_mask_ = Vmm(0);
+    const Vmm vmm_tail_store_mask_ = Vmm(1);
+    const Vmm vmm_zero_saturation_ = Vmm(2);
+    const Vmm vmm_saturation_ubound_ = Vmm(3);
+    const Vmm vmm_tmp_ = Vmm(4);
+    const Vmm vmm_aux_ = Vmm(5);
+    const Vmm vmm_sum_scale_ = Vmm(6);
+    const Vmm rhs_dt_helper_vmm_ = Vmm(7);
+    // Post-ops are not supported with arg algorithms, so the registers are
+    // shared.
+    const Vmm vmm_row_ = Vmm(5);
+    const Vmm vmm_one_ = Vmm(6);
+    const Xbyak::Zmm vmm_bf16_emu_1_ = Xbyak::Zmm(28);
+    const Xbyak::Zmm vmm_bf16_emu_2_ = Xbyak::Zmm(29);
+    const Xbyak::Zmm vmm_bf16_emu_3_ = Xbyak::Zmm(30);
+    const Xbyak::Zmm vmm_bf16_emu_4_ = Xbyak::Zmm(31);
+
+    const Xbyak::Opmask k_arg_mask_ = k2;
+    const Xbyak::Opmask k_tail_load_mask_ = k3;
+    const Xbyak::Opmask k_tail_store_mask_ = k4;
+
+    const Xbyak::Reg64 reg_work_ = rax;
+    const Xbyak::Reg64 reg_src_ = rbx;
+    const Xbyak::Reg64 reg_dst_ = rdx;
+    const Xbyak::Reg64 reg_param_ = abi_param1;
+    const Xbyak::Reg64 reg_tmp_ = abi_not_param1;
+    const Xbyak::Reg64 reg_tmp1_ = r13;
+
+    static constexpr bool is_zmm_ = std::is_same<Vmm, Xbyak::Zmm>::value;
+    static constexpr bool is_ymm_ = std::is_same<Vmm, Xbyak::Ymm>::value;
+    static constexpr std::size_t vlen_ = is_zmm_ ? 64 : is_ymm_ ? 32 : 16;
+    static constexpr std::size_t simd_w_ = vlen_ / sizeof(float);
+    const int n_vecs_;
+    const std::size_t tail_size_;
+
+    io::jit_io_helper_t<Vmm> io_load_;
+    io::jit_io_helper_t<Vmm> io_store_;
+
+    const Xbyak::Opmask elt_inj_opmask_ = k1;
+    const Xbyak::Reg64 reg_po_injector_helper_1_ = r14;
+    const Xbyak::Reg64 reg_po_injector_helper_2_ = r15;
+
+    static constexpr cpu_isa_t inject_isa_
+            = isa == avx512_core_bf16 ? avx512_core : isa;
+    std::unique_ptr<injector::jit_uni_postops_injector_t<inject_isa_, Vmm>>
+            postops_injector_;
+};
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
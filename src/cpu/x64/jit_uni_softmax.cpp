@@ -578,6 +578,117 @@ struct jit_softmax_t<avx512_core> : public jit_softmax_base_t<avx512_core> {
 template <>
 struct jit_softmax_t<avx2> : public jit_softmax_base_t<avx2> {
     Vmm tail_vmask = Vmm(0);
+    // used by data type conversions only, the axis loops use at most
+    // Vmm(1)..Vmm(8)
+    Vmm vcvt = Vmm(9);
+    Vmm vcvt_aux = Vmm(10);
+
+    // Loads data converted to f32. Tail lanes are zeroed.
+    void load(const Vmm &vmm, const Address &addr, data_type_t dt,
+            bool tail = false) {
+        const Xmm xmm = Xmm(vmm.getIdx());
+        const int n_elems = tail ? axis_simd_tail_ : simd_w_;
+        switch (dt) {
+            case data_type::f32:
+                if (tail)
+                    uni_vmovups_tail(vmm, tail_vmask, addr);
+                else
+                    uni_vmovups(vmm, addr);
+                break;
+            case data_type::bf16:
+                if (tail) {
+                    uni_vpxor(xmm, xmm, xmm);
+                    load_bytes(xmm, addr, n_elems * sizeof(bfloat16_t));
+                    vpmovzxwd(vmm, xmm);
+                } else
+                    vpmovzxwd(vmm, addr);
+                vpslld(vmm, vmm, 0x10);
+                break;
+            case data_type::u8:
+            case data_type::s8:
+                if (tail) {
+                    uni_vpxor(vmm, vmm, vmm);
+                    load_bytes_to_dword_extension(
+                            vmm, addr, dt == data_type::s8, n_elems);
+                } else if (dt == data_type::s8)
+                    vpmovsxbd(vmm, addr);
+                else
+                    vpmovzxbd(vmm, addr);
+                uni_vcvtdq2ps(vmm, vmm);
+                break;
+            default: assert(!"unsupported"); break;
+        }
+    }
+
+    // Converts f32 to bf16 in software: rounds to nearest even and truncates
+    // NaNs. The result is packed into the lower half of vcvt.
+    void cvt_f32_to_bf16(const Vmm &vmm) {
+        const Xmm xcvt_aux = Xmm(vcvt_aux.getIdx());
+        vpsrld(vcvt, vmm, 16);
+        mov(reg_tmp.cvt32(), 0x1);
+        uni_vmovd(xcvt_aux, reg_tmp.cvt32());
+        vpbroadcastd(vcvt_aux, xcvt_aux);
+        vpand(vcvt, vcvt, vcvt_aux);
+        vpaddd(vcvt, vcvt, vmm);
+        mov(reg_tmp.cvt32(), 0x7fff);
+        uni_vmovd(xcvt_aux, reg_tmp.cvt32());
+        vpbroadcastd(vcvt_aux, xcvt_aux);
+        vpaddd(vcvt, vcvt, vcvt_aux);
+        vcmpunordps(vcvt_aux, vmm, vmm);
+        vblendvps(vcvt, vcvt, vmm, vcvt_aux);
+        vpsrld(vcvt, vcvt, 16);
+        vpackusdw(vcvt, vcvt, vcvt);
+        vpermq(vcvt, vcvt, 0xD8);
+    }
+
+    void store(const Address &addr, const Vmm &vmm, data_type_t dt,
+            bool tail = false) {
+        const Xmm xcvt = Xmm(vcvt.getIdx());
+        // blocked layouts keep zeros in the padded area of the axis, so the
+        // whole vector is stored with zeroed tail lanes
+        Vmm src_vmm = vmm;
+        if (tail && axis_is_blocked_) {
+            uni_vxorps(vzero, vzero, vzero);
+            uni_vblendvps(vzero, vzero, vmm, tail_vmask);
+            src_vmm = vzero;
+        }
+        const bool store_tail = tail && !axis_is_blocked_;
+        const int n_elems = store_tail ? axis_simd_tail_ : simd_w_;
+
+        switch (dt) {
+            case data_type::f32:
+                if (store_tail)
+                    uni_vmovups_tail(addr, tail_vmask, src_vmm);
+                else
+                    uni_vmovups(addr, src_vmm);
+                break;
+            case data_type::bf16:
+                cvt_f32_to_bf16(src_vmm);
+                if (store_tail)
+                    store_bytes(xcvt, addr, n_elems * sizeof(bfloat16_t));
+                else
+                    uni_vmovdqu(addr, xcvt);
+                break;
+            case data_type::u8:
+            case data_type::s8:
+                uni_vmovups(vcvt, src_vmm);
+                uni_vxorps(vzero, vzero, vzero); // since vzero might be spoiled
+                saturate_f32(vcvt, vzero, vsaturation_ubound, dt);
+                vcvtps2dq(vcvt, vcvt);
+                uni_vpackssdw(vcvt, vcvt, vcvt);
+                vpermq(vcvt, vcvt, 0x08);
+                if (dt == data_type::s8)
+                    uni_vpacksswb(vcvt, vcvt, vcvt);
+                else
+                    uni_vpackuswb(vcvt, vcvt, vcvt);
+                if (store_tail)
+                    store_bytes(xcvt, addr, n_elems);
+                else
+                    vmovq(addr, xcvt);
+                break;
+            default: assert(!"unsupported"); break;
+        }
+    }
 
     void prepare_tail_mask() override {
         static const uint32_t mask_f32[14]
@@ -602,15 +713,13 @@ struct jit_softmax_t<avx2> : public jit_softmax_base_t<avx2> {
 
         axis_loop([&](int unroll, bool tail = false) {
             for (int i = 0; i < unroll; i++) {
-                if (!tail)
-                    uni_vmaxps(vmax, vmax, src_ptr(src_axis_stride_ * i));
-                else {
-                    vtmp = Vmm(i + 1);
-                    uni_vmovups_tail(
-                            vtmp, tail_vmask, src_ptr(src_axis_stride_ * i));
-                    uni_vblendvps(vtmp, vneg_flt_max, vtmp, tail_vmask);
-                    uni_vmaxps(vmax, vmax, vtmp);
-                }
+                Vmm vreg_tmp_src = Vmm(i + 1);
+                load(vreg_tmp_src, src_ptr(src_axis_stride_ * i),
+                        src_d_.data_type(), tail);
+                if (tail)
+                    uni_vblendvps(vreg_tmp_src, vneg_flt_max, vreg_tmp_src,
+                            tail_vmask);
+                uni_vmaxps(vmax, vmax, vreg_tmp_src);
             }
         });
 
@@ -618,37 +727,45 @@ struct jit_softmax_t<avx2> : public jit_softmax_base_t<avx2> {
     }
 
     void accumulate_vsum() override {
+        // Initialize saturation vector register
+        if (utils::one_of(dst_d_.data_type(), data_type::u8, data_type::s8)) {
+            init_saturate_f32(vzero, vsaturation_ubound, reg_tmp,
+                    data_type::f32, dst_d_.data_type());
+        }
+
         uni_vpxor(vsum, vsum, vsum); // flush to zero before accumulation
 
         axis_loop([&](int unroll, bool tail = false) {
             for (int i = 0; i < unroll; i++) {
                 Vmm vreg_tmp_src = Vmm(i + 1);
-                if (!tail) {
-                    uni_vmovups(vreg_tmp_src, src_ptr(src_axis_stride_ * i));
-                    uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
-                    if (is_logsoftmax_) // store before applying exp
-                        uni_vmovups(
-                                dst_ptr(dst_axis_stride_ * i), vreg_tmp_src);
-                    exp_injector_->compute_vector(vreg_tmp_src.getIdx());
-                    uni_vaddps(vsum, vsum, vreg_tmp_src);
-                    if (is_softmax_) // store after applying exp
-                        uni_vmovups(
-                                dst_ptr(dst_axis_stride_ * i), vreg_tmp_src);
-                } else {
-                    uni_vmovups_tail(vreg_tmp_src, tail_vmask,
-                            src_ptr(src_axis_stride_ * i));
-                    uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
-                    if (is_logsoftmax_) // store before applying exp
-                        uni_vmovups_tail(dst_ptr(dst_axis_stride_ * i),
-                                tail_vmask, vreg_tmp_src);
-                    exp_injector_->compute_vector(vreg_tmp_src.getIdx());
+                load(vreg_tmp_src, src_ptr(src_axis_stride_ * i),
+                        src_d_.data_type(), tail);
+                uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
+                if (is_logsoftmax_) { // store before applying exp
+                    if (need_scratchpad_) {
+                        store(interim_ptr(interim_axis_stride_ * i),
+                                vreg_tmp_src, data_type::f32, tail);
+                    } else {
+                        store(dst_ptr(dst_axis_stride_ * i), vreg_tmp_src,
+                                dst_d_.data_type(), tail);
+                    }
+                }
+                exp_injector_->compute_vector(vreg_tmp_src.getIdx());
+                if (tail) {
                     vtmp = Vmm(vreg_tmp_src.getIdx() + 1);
                     uni_vpxor(vtmp, vtmp, vtmp);
                     uni_vblendvps(vtmp, vtmp, vreg_tmp_src, tail_vmask);
                     uni_vaddps(vsum, vsum, vtmp);
-                    if (is_softmax_) // store after applying exp
-                        uni_vmovups_tail(dst_ptr(dst_axis_stride_ * i),
-                                tail_vmask, vreg_tmp_src);
+                } else
+                    uni_vaddps(vsum, vsum, vreg_tmp_src);
+                if (is_softmax_) { // store after applying exp
+                    if (need_scratchpad_) {
+                        store(interim_ptr(interim_axis_stride_ * i),
+                                vreg_tmp_src, data_type::f32, tail);
+                    } else {
+                        store(dst_ptr(dst_axis_stride_ * i), vreg_tmp_src,
+                                dst_d_.data_type(), tail);
+                    }
                 }
             }
         });
@@ -659,36 +776,74 @@ struct jit_softmax_t<avx2> : public jit_softmax_base_t<avx2> {
     }
 
     void compute_dst() override {
+        Vmm vscale = vmax;
+        uni_vbroadcastss(vscale, ptr[reg_output_scale]);
+
         axis_loop([&](int unroll, bool tail = false) {
             for (int i = 0; i < unroll; i++) {
                 Vmm vreg_tmp_src = Vmm(i + 1);
-                if (!tail) {
-                    if (is_softmax_)
-                        uni_vmulps(vreg_tmp_src, vsum,
-                                dst_ptr(dst_axis_stride_ * i));
-                    if (is_logsoftmax_) {
-                        uni_vmovups(
-                                vreg_tmp_src, dst_ptr(dst_axis_stride_ * i));
-                        uni_vsubps(vreg_tmp_src, vreg_tmp_src, vsum);
-                    }
-                    uni_vmovups(dst_ptr(dst_axis_stride_ * i), vreg_tmp_src);
+                if (need_scratchpad_) {
+                    load(vreg_tmp_src, interim_ptr(interim_axis_stride_ * i),
+                            data_type::f32, tail);
                 } else {
-                    uni_vmovups_tail(vreg_tmp_src, tail_vmask,
-                            dst_ptr(dst_axis_stride_ * i));
-                    if (is_softmax_)
-                        uni_vmulps(vreg_tmp_src, vreg_tmp_src, vsum);
-                    if (is_logsoftmax_)
-                        uni_vsubps(vreg_tmp_src, vreg_tmp_src, vsum);
+                    load(vreg_tmp_src, dst_ptr(dst_axis_stride_ * i),
+                            dst_d_.data_type(), tail);
+                }
 
-                    if (axis_is_blocked_) {
-                        uni_vxorps(vzero, vzero, vzero);
-                        uni_vblendvps(vzero, vzero, vreg_tmp_src, tail_vmask);
-                        uni_vmovups(dst_ptr(dst_axis_stride_ * i), vzero);
-                    } else {
-                        uni_vmovups_tail(dst_ptr(dst_axis_stride_ * i),
-                                tail_vmask, vreg_tmp_src);
-                    }
+                if (is_softmax_)
+                    uni_vmulps(vreg_tmp_src, vreg_tmp_src, vsum);
+                if (is_logsoftmax_)
+                    uni_vsubps(vreg_tmp_src, vreg_tmp_src, vsum);
+                uni_vmulps(vreg_tmp_src, vreg_tmp_src, vscale);
+                store(dst_ptr(dst_axis_stride_ * i), vreg_tmp_src,
+                        dst_d_.data_type(), tail);
+            }
+        });
+    }
+
+    void accumulate_vsbr() override {
+        uni_vpxor(vsbr, vsbr, vsbr); // flush to zero before accumulation
+
+        axis_loop([&](int unroll, bool tail = false) {
+            for (int i = 0; i < unroll; i++) {
+                Vmm vreg_tmp_dst = Vmm(i * 2 + 1);
+                Vmm vreg_tmp_diff_dst = Vmm(i * 2 + 2);
+                // tail lanes are zeroed by load
+                load(vreg_tmp_diff_dst, diff_dst_ptr(diff_dst_axis_stride_ * i),
+                        diff_dst_d_.data_type(), tail);
+                if (is_softmax_) {
+                    load(vreg_tmp_dst, dst_ptr(dst_axis_stride_ * i),
+                            dst_d_.data_type(), tail);
+                    uni_vmulps(
+                            vreg_tmp_diff_dst, vreg_tmp_diff_dst, vreg_tmp_dst);
                 }
+                uni_vaddps(vsbr, vsbr, vreg_tmp_diff_dst);
+            }
+        });
+
+        get_horizontal_op(vsbr, vtmp = vmax, op_t::sum);
+    }
+
+    void compute_diff_src() override {
+        axis_loop([&](int unroll, bool tail = false) {
+            for (int i = 0; i < unroll; i++) {
+                Vmm vreg_tmp_dst = Vmm(i * 2 + 1);
+                Vmm vreg_tmp_diff_dst = Vmm(i * 2 + 2);
+                load(vreg_tmp_dst, dst_ptr(dst_axis_stride_ * i),
+                        dst_d_.data_type(), tail);
+                load(vreg_tmp_diff_dst, diff_dst_ptr(diff_dst_axis_stride_ * i),
+                        diff_dst_d_.data_type(), tail);
+                if (is_softmax_) {
+                    uni_vsubps(vreg_tmp_diff_dst, vreg_tmp_diff_dst, vsbr);
+                    uni_vmulps(
+                            vreg_tmp_diff_dst, vreg_tmp_dst, vreg_tmp_diff_dst);
+                }
+                if (is_logsoftmax_) {
+                    exp_injector_->compute_vector(vreg_tmp_dst.getIdx());
+                    uni_vfnmadd231ps(vreg_tmp_diff_dst, vreg_tmp_dst, vsbr);
+                }
+                store(diff_src_ptr(src_axis_stride_ * i), vreg_tmp_diff_dst,
+                        src_d_.data_type(), tail);
             }
         });
     }
@@ -797,6 +952,9 @@ struct jit_softmax_t<sse41> : public jit_softmax_base_t<sse41> {
     }
 
     void compute_dst() override {
+        Vmm vscale = vmax;
+        uni_vbroadcastss(vscale, ptr[reg_output_scale]);
+
         axis_loop([&](int unroll, bool tail = false) {
             for (int i = 0; i < unroll; i++) {
                 Vmm vreg_tmp_src = Vmm(i + 1);
@@ -806,6 +964,7 @@ struct jit_softmax_t<sse41> : public jit_softmax_base_t<sse41> {
                         uni_vmulps(vreg_tmp_src, vreg_tmp_src, vsum);
                     if (is_logsoftmax_)
                         uni_vsubps(vreg_tmp_src, vreg_tmp_src, vsum);
+                    uni_vmulps(vreg_tmp_src, vreg_tmp_src, vscale);
                     uni_vmovups(dst_ptr(dst_axis_stride_ * i), vreg_tmp_src);
                 } else {
                     for (size_t j = 0; j < axis_simd_tail_; j++) {
@@ -816,6 +975,7 @@ struct jit_softmax_t<sse41> : public jit_softmax_base_t<sse41> {
                             uni_vmulps(vreg_tmp_src, vreg_tmp_src, vsum);
                         if (is_logsoftmax_)
                             uni_vsubps(vreg_tmp_src, vreg_tmp_src, vsum);
+                        uni_vmulps(vreg_tmp_src, vreg_tmp_src, vscale);
                         uni_vmovss(dst_ptr(dst_axis_stride_ * i
                                            + dst_d_.data_type_size() * j),
                                 vreg_tmp_src);
@@ -825,6 +985,78 @@ struct jit_softmax_t<sse41> : public jit_softmax_base_t<sse41> {
         });
     }
 
+    void accumulate_vsbr() override {
+        uni_vpxor(vsbr, vsbr, vsbr); // flush to zero before accumulation
+
+        axis_loop([&](int unroll, bool tail = false) {
+            for (int i = 0; i < unroll; i++) {
+                Vmm vreg_tmp_dst = Vmm(i * 2 + 1);
+                Vmm vreg_tmp_diff_dst = Vmm(i * 2 + 2);
+                // movss from memory zeroes the upper lanes
+                const size_t n_elems = tail ? axis_simd_tail_ : 1;
+                for (size_t j = 0; j < n_elems; j++) {
+                    const size_t dd_offt = diff_dst_axis_stride_ * i
+                            + diff_dst_d_.data_type_size() * j;
+                    const size_t d_offt = dst_axis_stride_ * i
+                            + dst_d_.data_type_size() * j;
+                    if (tail)
+                        uni_vmovss(vreg_tmp_diff_dst, diff_dst_ptr(dd_offt));
+                    else
+                        uni_vmovups(vreg_tmp_diff_dst, diff_dst_ptr(dd_offt));
+                    if (is_softmax_) {
+                        if (tail)
+                            uni_vmovss(vreg_tmp_dst, dst_ptr(d_offt));
+                        else
+                            uni_vmovups(vreg_tmp_dst, dst_ptr(d_offt));
+                        uni_vmulps(vreg_tmp_diff_dst, vreg_tmp_diff_dst,
+                                vreg_tmp_dst);
+                    }
+                    uni_vaddps(vsbr, vsbr, vreg_tmp_diff_dst);
+                }
+            }
+        });
+
+        get_horizontal_op(vsbr, vtmp = vmax, op_t::sum);
+    }
+
+    void compute_diff_src() override {
+        axis_loop([&](int unroll, bool tail = false) {
+            for (int i = 0; i < unroll; i++) {
+                Vmm vreg_tmp_dst = Vmm(i * 2 + 1);
+                Vmm vreg_tmp_diff_dst = Vmm(i * 2 + 2);
+                const size_t n_elems = tail ? axis_simd_tail_ : 1;
+                for (size_t j = 0; j < n_elems; j++) {
+                    const size_t dd_offt = diff_dst_axis_stride_ * i
+                            + diff_dst_d_.data_type_size() * j;
+                    const size_t d_offt = dst_axis_stride_ * i
+                            + dst_d_.data_type_size() * j;
+                    const size_t ds_offt = src_axis_stride_ * i
+                            + src_d_.data_type_size() * j;
+                    if (tail) {
+                        uni_vmovss(vreg_tmp_dst, dst_ptr(d_offt));
+                        uni_vmovss(vreg_tmp_diff_dst, diff_dst_ptr(dd_offt));
+                    } else {
+                        uni_vmovups(vreg_tmp_dst, dst_ptr(d_offt));
+                        uni_vmovups(vreg_tmp_diff_dst, diff_dst_ptr(dd_offt));
+                    }
+                    if (is_softmax_) {
+                        uni_vsubps(vreg_tmp_diff_dst, vreg_tmp_diff_dst, vsbr);
+                        uni_vmulps(vreg_tmp_diff_dst, vreg_tmp_diff_dst,
+                                vreg_tmp_dst);
+                    }
+                    if (is_logsoftmax_) {
+                        exp_injector_->compute_vector(vreg_tmp_dst.getIdx());
+                        uni_vfnmadd231ps(vreg_tmp_diff_dst, vreg_tmp_dst, vsbr);
+                    }
+                    if (tail)
+                        uni_vmovss(diff_src_ptr(ds_offt), vreg_tmp_diff_dst);
+                    else
+                        uni_vmovups(diff_src_ptr(ds_offt), vreg_tmp_diff_dst);
+                }
+            }
+        });
+    }
+
     void operator()(const call_params_t *p) override {
         return jit_generator::operator()(p);
     }
@@ -978,6 +1210,8 @@ private:
 template struct jit_uni_softmax_fwd_t<sse41>;
 template struct jit_uni_softmax_fwd_t<avx2>;
 template struct jit_uni_softmax_fwd_t<avx512_core>;
+template struct jit_uni_softmax_bwd_t<sse41>;
+template struct jit_uni_softmax_bwd_t<avx2>;
 template struct jit_uni_softmax_bwd_t<avx512_core>;
 
 } // namespace x64
@@ -76,12 +76,12 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
             bool ok = mayiuse(isa) && is_fwd() && !has_zero_dim_memory()
                     && utils::one_of(src_dt, f32, bf16, s8, u8)
                     && utils::one_of(dst_dt, f32, bf16, s8, u8)
-                    // s8/u8 are temporary limitations due to priorities
+                    // sse41 is kept f32-only due to priorities
                     && IMPLICATION(
                             (utils::one_of(bf16, src_dt, dst_dt)
                                     || utils::one_of(s8, src_dt, dst_dt)
                                     || utils::one_of(u8, src_dt, dst_dt)),
-                            is_superset(isa, avx512_core))
+                            is_superset(isa, avx2))
                     && attr()->has_default_values(skip_mask_t::oscale)
                     && attr_oscale_ok()
                     && set_default_formats() == status::success;
@@ -163,7 +163,7 @@ struct jit_uni_softmax_bwd_t : public primitive_t {
                     && IMPLICATION(utils::one_of(bf16, dst_md()->data_type,
                                            diff_dst_md()->data_type,
                                            diff_src_md()->data_type),
-                            is_superset(isa, avx512_core))
+                            is_superset(isa, avx2))
                     && attr()->has_default_values()
                     && set_default_formats() == status::success;
             if (!ok) return status::unimplemented;
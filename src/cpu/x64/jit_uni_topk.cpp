@@ -0,0 +1,353 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/topk_utils.hpp"
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/jit_uni_topk.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace memory_tracking::names;
+using namespace Xbyak;
+
+namespace topk_impl {
+
+/* Looks for the first vector of a row holding an element which beats the
+ * threshold, i.e. is greater (less for topk_min) than it. The comparisons are
+ * ordered, so neither NaN elements nor a NaN threshold ever match. */
+template <cpu_isa_t isa>
+struct jit_scan_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_scan_kernel_t)
+
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    struct call_params_t {
+        const float *src;
+        // number of elements to scan, a multiple of the vector length
+        size_t len;
+        float thr;
+        // offset of the first vector with a match or `len` if there is none
+        size_t *pos;
+    };
+
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    jit_scan_kernel_t(bool is_max)
+        : jit_generator(jit_name()), is_max_(is_max) {}
+
+    void operator()(const call_params_t *p) { jit_generator::operator()(p); }
+
+private:
+    static constexpr int vlen_ = cpu_isa_traits<isa>::vlen;
+    // number of vectors checked by a single branch
+    static constexpr int unroll_ = 4;
+
+    const bool is_max_;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_src = r8;
+    const Reg64 reg_len = r9;
+    const Reg64 reg_off = r10;
+    const Reg64 reg_tmp = r11;
+
+    const Vmm vmm_thr = Vmm(unroll_);
+
+    Vmm vmm_src(int i) { return Vmm(i); }
+    Opmask k_match(int i) { return Opmask(i + 1); }
+
+    // Sets the match flag of vector `i` located `i` vectors after the current
+    // offset
+    void compare(int i) {
+        const Vmm v = vmm_src(i);
+        uni_vmovups(v, ptr[reg_src + reg_off + i * vlen_]);
+        const Vmm &lhs = is_max_ ? vmm_thr : v;
+        const Vmm &rhs = is_max_ ? v : vmm_thr;
+        if (isa == avx512_core)
+            vcmpps(k_match(i), lhs, rhs, _cmp_lt_os);
+        else
+            vcmpps(v, lhs, rhs, _cmp_lt_os);
+    }
+
+    // Sets ZF to 0 if any of the `n` vectors compared last has a match
+    void test_matches(int n) {
+        if (isa == avx512_core) {
+            if (n == 1) {
+                kortestw(k_match(0), k_match(0));
+                return;
+            }
+            korw(k_match(0), k_match(0), k_match(1));
+            korw(k_match(2), k_match(2), k_match(3));
+            kortestw(k_match(0), k_match(2));
+        } else {
+            if (n > 1) {
+                vorps(vmm_src(0), vmm_src(0), vmm_src(1));
+                vorps(vmm_src(2), vmm_src(2), vmm_src(3));
+                vorps(vmm_src(0), vmm_src(0), vmm_src(2));
+            }
+            vtestps(vmm_src(0), vmm_src(0));
+        }
+    }
+
+    void generate() override {
+        static_assert(unroll_ == 4, "unroll_ is expected to be 4");
+
+        preamble();
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_len, ptr[reg_param + PARAM_OFF(len)]);
+        uni_vbroadcastss(vmm_thr, ptr[reg_param + PARAM_OFF(thr)]);
+
+        // offsets are kept in bytes
+        shl(reg_len, 2);
+        xor_(reg_off, reg_off);
+
+        Label unroll_loop, vec_loop, done;
+        L(unroll_loop);
+        {
+            mov(reg_tmp, reg_len);
+            sub(reg_tmp, reg_off);
+            cmp(reg_tmp, unroll_ * vlen_);
+            jl(vec_loop, T_NEAR);
+
+            for (int i = 0; i < unroll_; i++)
+                compare(i);
+            test_matches(unroll_);
+            // the match is located vector by vector below
+            jnz(vec_loop, T_NEAR);
+
+            add(reg_off, unroll_ * vlen_);
+            jmp(unroll_loop, T_NEAR);
+        }
+
+        L(vec_loop);
+        {
+            cmp(reg_off, reg_len);
+            jge(done, T_NEAR);
+
+            compare(0);
+            test_matches(1);
+            jnz(done, T_NEAR);
+
+            add(reg_off, vlen_);
+            jmp(vec_loop, T_NEAR);
+        }
+
+        L(done);
+        shr(reg_off, 2);
+        mov(reg_tmp, ptr[reg_param + PARAM_OFF(pos)]);
+        mov(ptr[reg_tmp], reg_off);
+#undef PARAM_OFF
+        postamble();
+    }
+};
+
+} // namespace topk_impl
+
+using namespace data_type;
+using namespace utils;
+
+template <cpu_isa_t isa>
+status_t jit_uni_topk_t<isa>::pd_t::init(engine_t *engine) {
+    bool ok = mayiuse(isa) && src_md()->data_type == f32
+            && dst_md(0)->data_type == f32 && dst_md(1)->data_type == s32
+            && attr()->has_default_values()
+            && set_default_params() == status::success;
+    if (!ok) return status::unimplemented;
+
+    // The rows are read directly by the kernel
+    const memory_desc_wrapper src_d(src_md());
+    if (!(src_d.is_plain() && src_d.is_dense()
+                && src_d.blocking_desc().strides[axis()] == 1))
+        return status::unimplemented;
+
+    // indices are stored in int32_t
+    if (axis_size() > INT32_MAX) return status::unimplemented;
+
+    nthr_ = dnnl_get_max_threads();
+    n_rows_ = src_d.nelems() / axis_size();
+    // Rows are split only when there are not enough of them to occupy all the
+    // threads. Every chunk is kept much longer than k, otherwise filling its
+    // heap and the final merge would dominate.
+    n_chunks_ = nstl::max((dim_t)1,
+            nstl::min(div_up((dim_t)nthr_, nstl::max(n_rows_, (dim_t)1)),
+                    axis_size() / nstl::max(4 * K(), (dim_t)1024)));
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_topk_t<isa>::pd_t::init_scratchpad() {
+    using topk_utils::entry_t;
+    auto scratchpad = scratchpad_registry().registrar();
+    if (n_chunks_ > 1)
+        scratchpad.template book<entry_t>(
+                key_topk_partial, n_rows_ * n_chunks_ * K());
+    else
+        scratchpad.template book<entry_t>(key_topk_entries, nthr_ * K());
+}
+
+template <cpu_isa_t isa>
+jit_uni_topk_t<isa>::jit_uni_topk_t(const pd_t *apd) : primitive_t(apd) {}
+
+template <cpu_isa_t isa>
+jit_uni_topk_t<isa>::~jit_uni_topk_t() = default;
+
+template <cpu_isa_t isa>
+status_t jit_uni_topk_t<isa>::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(
+            kernel_, new topk_impl::jit_scan_kernel_t<isa>(pd()->is_max())));
+    return kernel_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_topk_t<isa>::execute(const exec_ctx_t &ctx) const {
+    using namespace topk_utils;
+    using kernel_t = topk_impl::jit_scan_kernel_t<isa>;
+    constexpr dim_t simd_w = kernel_t::simd_w;
+
+    status_t status = status::success;
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DST, status);
+    CHECK(status);
+    auto indices = CTX_OUT_CLEAN_MEM(int32_t *, DNNL_ARG_DST_1, status);
+    CHECK(status);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    const memory_desc_wrapper indices_d(pd()->dst_md(1));
+
+    const int ndims = src_d.ndims();
+    const int axis = pd()->axis();
+    const dim_t N = pd()->axis_size();
+    const dim_t K = pd()->K();
+    const bool is_max = pd()->is_max();
+    const dim_t n_rows = pd()->n_rows_;
+    const dim_t n_chunks = pd()->n_chunks_;
+
+    dims_t outer_dims;
+    array_copy(outer_dims, src_d.dims(), ndims);
+    outer_dims[axis] = 1;
+
+    const auto row_pos = [&](dims_t pos, dim_t row) {
+        utils::l_dims_by_l_offset(pos, row, outer_dims, ndims);
+        pos[axis] = 0;
+    };
+
+    // Feeds the elements [start, end) of a row to the heap
+    const auto select = [&](heap_t &heap, const float *row, dim_t start,
+                                dim_t end) {
+        dim_t i = start;
+        for (; i < end && !heap.is_full(); i++)
+            heap.insert({row[i], (int32_t)i});
+        while (i < end) {
+            const dim_t len = (end - i) / simd_w * simd_w;
+            // Nothing is skipped when the worst entry is NaN
+            if (len == 0 || std::isnan(heap.worst().value)) {
+                heap.insert({row[i], (int32_t)i});
+                i++;
+                continue;
+            }
+            size_t pos = 0;
+            typename kernel_t::call_params_t p;
+            p.src = row + i;
+            p.len = len;
+            p.thr = heap.worst().value;
+            p.pos = &pos;
+            (*kernel_)(&p);
+            i += pos;
+            if ((dim_t)pos == len) continue;
+            for (dim_t j = i; j < i + simd_w; j++)
+                heap.insert({row[j], (int32_t)j});
+            i += simd_w;
+        }
+    };
+
+    const auto store = [&](const entry_t *entries, dims_t pos) {
+        for (dim_t k = 0; k < K; k++) {
+            pos[axis] = k;
+            dst[dst_d.off_v(pos)] = entries[k].value;
+            indices[indices_d.off_v(pos)] = entries[k].index;
+        }
+    };
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+
+    if (n_chunks == 1) {
+        auto heaps = scratchpad.template get<entry_t>(key_topk_entries);
+        parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+            dim_t start {0}, end {0};
+            balance211(n_rows, nthr, ithr, start, end);
+            dims_t pos;
+            for (dim_t r = start; r < end; r++) {
+                row_pos(pos, r);
+                heap_t heap(heaps + ithr * K, K, is_max);
+                select(heap, src + src_d.off_v(pos), 0, N);
+                heap.sort();
+                store(heaps + ithr * K, pos);
+            }
+        });
+        return status::success;
+    }
+
+    // Every chunk is longer than k, so all the heaps are full
+    auto partial = scratchpad.template get<entry_t>(key_topk_partial);
+    parallel_nd(n_rows, n_chunks, [&](dim_t r, dim_t c) {
+        dim_t start {0}, end {0};
+        balance211(N, n_chunks, c, start, end);
+        dims_t pos;
+        row_pos(pos, r);
+        heap_t heap(partial + (r * n_chunks + c) * K, K, is_max);
+        select(heap, src + src_d.off_v(pos), start, end);
+    });
+
+    const auto cmp = [=](const entry_t &a, const entry_t &b) {
+        return precedes(a, b, is_max);
+    };
+    parallel_nd(n_rows, [&](dim_t r) {
+        entry_t *entries = partial + r * n_chunks * K;
+        std::partial_sort(entries, entries + K, entries + n_chunks * K, cmp);
+        dims_t pos;
+        row_pos(pos, r);
+        store(entries, pos);
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_topk_t<avx512_core>;
+template struct jit_uni_topk_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,91 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_TOPK_HPP
+#define CPU_X64_JIT_UNI_TOPK_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_topk_pd.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace topk_impl {
+template <cpu_isa_t isa>
+struct jit_scan_kernel_t;
+} // namespace topk_impl
+
+/* Top-k of f32 data along an axis with unit stride.
+ *
+ * The k best elements of a row are kept in a heap with the worst of them at
+ * the top. Once the heap is full, only the elements beating its top can change
+ * the result, and for random data their share quickly goes down as the row is
+ * processed. The kernel compares the row against the top of the heap a few
+ * vectors at a time and returns the first vector holding such an element, so
+ * the heap is updated only for those vectors.
+ *
+ * When there are fewer rows than threads, long rows are split into chunks
+ * with their own heaps, which are merged at the end. */
+template <cpu_isa_t isa>
+struct jit_uni_topk_t : public primitive_t {
+    struct pd_t : public cpu_topk_pd_t {
+        using cpu_topk_pd_t::cpu_topk_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""),
+                jit_uni_topk_t);
+
+        status_t init(engine_t *engine);
+
+        int nthr_; // To not exceed the limit in execute used for set up.
+        // number of rows, i.e. points of the dimensions other than the axis
+        dim_t n_rows_;
+        // number of chunks every row is split into
+        dim_t n_chunks_;
+
+    private:
+        void init_scratchpad();
+    };
+
+    jit_uni_topk_t(const pd_t *apd);
+    ~jit_uni_topk_t();
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<topk_impl::jit_scan_kernel_t<isa>> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -1484,8 +1484,30 @@ status_t jit_uni_x8s8s32x_fwd_kernel<isa>::init_conf(jit_conv_conf_t &jcp,
 
     jcp.nb_oc_blocking_thr_chunk
             = nstl::min(max_threading_nb_oc_chunk, jcp.nb_oc);
-    for (; jcp.nb_oc_blocking_thr_chunk > 1; --jcp.nb_oc_blocking_thr_chunk) {
-        if (is_oc_blocking_ok(jcp.nb_oc_blocking_thr_chunk)) break;
+    if (isa == avx2 && !jcp.has_vnni && !jcp.is_depthwise) {
+        // On avx2 without VNNI each 4-channel dot product takes vpmaddubsw,
+        // vpmaddwd and vpaddd, so the kernel is bound by the number of
+        // accumulators updated per loaded input and weights register rather
+        // than by the oc blocking itself. Pick the blocking that maximizes
+        // ur_w * nb_oc_blocking / (ur_w + nb_oc_blocking), preferring the
+        // wider one on ties.
+        float best_ratio = 0.f;
+        int best_block = 1;
+        for (int block = jcp.nb_oc_blocking_thr_chunk; block >= 1; --block) {
+            if (block > 1 && !is_oc_blocking_ok(block)) continue;
+            const int ur_w = nstl::min(jcp.ow, jcp.max_regs_ur / (block + 1));
+            const float ratio = (float)(ur_w * block) / (ur_w + block);
+            if (ratio > best_ratio) {
+                best_ratio = ratio;
+                best_block = block;
+            }
+        }
+        jcp.nb_oc_blocking_thr_chunk = best_block;
+    } else {
+        for (; jcp.nb_oc_blocking_thr_chunk > 1;
+                --jcp.nb_oc_blocking_thr_chunk) {
+            if (is_oc_blocking_ok(jcp.nb_oc_blocking_thr_chunk)) break;
+        }
     }
 
     auto get_thr_eff = [=](int nb_ow, int nthr) {
@@ -73,7 +73,6 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
 
     const bool problem_dt_correct = is_int8 || is_bf16 || is_f32;
     bool ok = mayiuse(isa) && problem_dt_correct
-            && !has_runtime_dims_or_strides()
             && attr()->has_default_values(
                     primitive_attr_t::skip_mask_t::oscale_runtime
                             | primitive_attr_t::skip_mask_t::zero_points_runtime
@@ -87,59 +86,18 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     CHECK(init_brgemm_matmul_conf(isa, bgmmc_, *desc(), src_md_, weights_md_,
             dst_md_, bias_md_, attr_));
 
-    const float alpha = 1.0;
-    const float beta = 1.0;
-    const float beta_init = 0.0;
-
     for_(int i_bs = 0; i_bs < 2; i_bs++)
     for_(int i_init = 0; i_init < 2; i_init++)
     for_(int i_M = 0; i_M < 2; i_M++)
     for_(int i_N = 0; i_N < 2; i_N++)
     for (int i_K = 0; i_K < 2; i_K++) {
-        auto vbeta = (i_init) ? beta_init : beta;
-        auto vM = (i_M) ? bgmmc_.M_tail : bgmmc_.M_blk;
-        auto vN = (i_N) ? bgmmc_.N_tail : bgmmc_.N_blk;
-        auto vK = (i_K) ? bgmmc_.K_tail : bgmmc_.K_blk;
-
-        int bs = get_brg_batchsize(bgmmc_, i_bs, i_K);
         int idx = get_brg_kernel_idx(i_bs, i_init, i_M, i_N, i_K);
         if (idx < 0) continue;
         brgemm_t &brg = brg_descs_[idx];
-        auto LDA = i_K && bgmmc_.use_buffer_a_tail_only
-                ? (dim_t)bgmmc_.wei_k_blk
-                : bgmmc_.LDA;
-        CHECK(brgemm_desc_init(&brg, isa, bgmmc_.brg_type, bgmmc_.src_dt,
-                bgmmc_.wei_dt, false, false, brgemm_row_major, alpha, vbeta,
-                LDA, bgmmc_.LDB, bgmmc_.LDC, vM, vN, vK));
-
-        auto LDD = bgmmc_.LDD;
-        CHECK(brgemm_desc_set_postops(
-                &brg, attr(), &dst_md_, LDD, bgmmc_.bia_dt));
-
-        brgemm_attr_t brgattr;
-        brgattr.generate_skip_accumulation
-                = bgmmc_.post_ops_applicable && bgmmc_.nthr_k > 1;
-        constexpr bool is_amx = one_of(
-                isa, avx512_core_bf16_amx_int8, avx512_core_bf16_amx_bf16);
-        if (is_amx) {
-            if (!brgattr.generate_skip_accumulation) {
-                // TODO: uker doesn't yet support generate_skip_accumulation
-                brgattr.use_uker = true;
-                brgattr.use_interleave_stores = true;
-            }
-            brgattr.max_bs = bs;
-            brgattr.wary_tail_read = false;
-
-            // TODO: change expected sizes to local chunks wrt L2 blocking
-            brgattr.hint_expected_A_size = vM * vK * bs;
-            brgattr.hint_expected_B_size = vN * vK * bs;
-            brgattr.hint_expected_C_size = vM * vN * bs;
-            brgattr.hint_innermost_loop = brgemm_ld_loop_innermost;
-            brgattr.hint_prefetching
-                    = brgemm_kernel_prefetching_t::brgemm_prf_output1;
-        }
-
-        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        const auto vM = (i_M) ? bgmmc_.M_tail : bgmmc_.M_blk;
+        CHECK(init_brg_desc(brg, i_bs, i_init, vM, i_N, i_K));
+        // Note: kernels for runtime M tails have fewer C tiles than the full
+        // M block ones, so the workspace booked here is sufficient for them.
         bgmmc_.wsp_tile_per_thr_bytes = nstl::max(
                 brg.get_wsp_buffer_size(), bgmmc_.wsp_tile_per_thr_bytes);
     }
@@ -150,6 +108,55 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     return status::success;
 }
 
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::pd_t::init_brg_desc(brgemm_t &brg,
+        bool is_bs_tail, bool do_initialization, dim_t vM, bool is_N_tail,
+        bool is_K_tail) const {
+    const float alpha = 1.0;
+    const float beta = 1.0;
+    const float beta_init = 0.0;
+
+    auto vbeta = (do_initialization) ? beta_init : beta;
+    auto vN = (is_N_tail) ? bgmmc_.N_tail : bgmmc_.N_blk;
+    auto vK = (is_K_tail) ? bgmmc_.K_tail : bgmmc_.K_blk;
+
+    int bs = get_brg_batchsize(bgmmc_, is_bs_tail, is_K_tail);
+    auto LDA = is_K_tail && bgmmc_.use_buffer_a_tail_only
+            ? (dim_t)bgmmc_.wei_k_blk
+            : bgmmc_.LDA;
+    CHECK(brgemm_desc_init(&brg, isa, bgmmc_.brg_type, bgmmc_.src_dt,
+            bgmmc_.wei_dt, false, false, brgemm_row_major, alpha, vbeta, LDA,
+            bgmmc_.LDB, bgmmc_.LDC, vM, vN, vK));
+
+    auto LDD = bgmmc_.LDD;
+    CHECK(brgemm_desc_set_postops(&brg, attr(), &dst_md_, LDD, bgmmc_.bia_dt));
+
+    brgemm_attr_t brgattr;
+    brgattr.generate_skip_accumulation
+            = bgmmc_.post_ops_applicable && bgmmc_.nthr_k > 1;
+    constexpr bool is_amx
+            = one_of(isa, avx512_core_bf16_amx_int8, avx512_core_bf16_amx_bf16);
+    if (is_amx) {
+        if (!brgattr.generate_skip_accumulation) {
+            // TODO: uker doesn't yet support generate_skip_accumulation
+            brgattr.use_uker = true;
+            brgattr.use_interleave_stores = true;
+        }
+        brgattr.max_bs = bs;
+        brgattr.wary_tail_read = false;
+
+        // TODO: change expected sizes to local chunks wrt L2 blocking
+        brgattr.hint_expected_A_size = vM * vK * bs;
+        brgattr.hint_expected_B_size = vN * vK * bs;
+        brgattr.hint_expected_C_size = vM * vN * bs;
+        brgattr.hint_innermost_loop = brgemm_ld_loop_innermost;
+        brgattr.hint_prefetching
+                = brgemm_kernel_prefetching_t::brgemm_prf_output1;
+    }
+
+    return brgemm_desc_set_attr(&brg, brgattr);
+}
+
 template <cpu_isa_t isa>
 status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
     for_(int i_bs = 0; i_bs < 2; i_bs++)
@@ -185,6 +192,89 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
         CHECK(acc_ker_s32_->create_kernel());
     }
 
+    // Power of 2 sizes are the most frequent M tails for dynamic shapes, so
+    // their kernels are generated in advance. Other tails are generated on
+    // first use.
+    if (bgmmc.is_runtime_M)
+        for (dim_t M_tail = bgmmc.M_blk / 2; M_tail > 0; M_tail /= 2)
+            CHECK(create_M_tail_kernels(M_tail, M_tail_kernels_[M_tail]));
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::create_M_tail_kernels(dim_t M_tail,
+        std::unique_ptr<brg_M_tail_kernels_t> &tail_kernels) const {
+    auto bgmmc = pd()->get_brgemm_matmul_conf();
+    assert(bgmmc.is_runtime_M && 0 < M_tail && M_tail < bgmmc.M_blk);
+    bgmmc.M_tail = M_tail;
+
+    std::unique_ptr<brg_M_tail_kernels_t> kernels(new brg_M_tail_kernels_t());
+    for_(int i_bs = 0; i_bs < 2; i_bs++)
+    for_(int i_N = 0; i_N < 2; i_N++)
+    for_(int i_K = 0; i_K < 2; i_K++)
+    for (int i_init = 0; i_init < 2; i_init++) {
+        const int bs = get_brg_batchsize(bgmmc, i_bs, i_K);
+        const int idx = get_brg_kernel_index(
+                bgmmc, i_bs, i_init, true, i_N, i_K, bs);
+        if (idx < 0) continue;
+
+        brgemm_t brg;
+        CHECK(pd()->init_brg_desc(brg, i_bs, i_init, M_tail, i_N, i_K));
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, brg));
+        CHECK(safe_ptr_assign(kernels->kernels[idx], ker));
+        if (one_of(isa, avx512_core_bf16_amx_int8, avx512_core_bf16_amx_bf16))
+            CHECK(brgemm_init_tiles(brg, &kernels->palettes[idx][0]));
+    }
+    tail_kernels = std::move(kernels);
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::get_M_tail_kernels(
+        dim_t M_tail, const brg_M_tail_kernels_t *&tail_kernels) const {
+    {
+        utils::lock_read_t lock_r(M_tail_kernels_mutex_);
+        tail_kernels = M_tail_kernels_[M_tail].get();
+    }
+    if (tail_kernels != nullptr) return status::success;
+
+    utils::lock_write_t lock_w(M_tail_kernels_mutex_);
+    // Another thread might have generated the kernels in the meantime.
+    if (!M_tail_kernels_[M_tail])
+        CHECK(create_M_tail_kernels(M_tail, M_tail_kernels_[M_tail]));
+    tail_kernels = M_tail_kernels_[M_tail].get();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::init_brg_kernels_for_execution(
+        brg_matmul_exec_ctx_t &brgmm_ctx) const {
+    const auto &bgmmc = brgmm_ctx.get_bgmmc();
+    const brg_M_tail_kernels_t *tail_kernels = nullptr;
+    if (bgmmc.is_runtime_M && bgmmc.M_tail > 0)
+        CHECK(get_M_tail_kernels(bgmmc.M_tail, tail_kernels));
+
+    for_(int i_bs = 0; i_bs < 2; i_bs++)
+    for_(int i_M = 0; i_M < 2; i_M++)
+    for_(int i_N = 0; i_N < 2; i_N++)
+    for_(int i_K = 0; i_K < 2; i_K++)
+    for (int i_init = 0; i_init < 2; i_init++) {
+        const int idx
+                = brgmm_ctx.get_brg_kernel_idx(i_bs, i_init, i_M, i_N, i_K);
+        if (idx < 0) continue;
+
+        if (i_M && bgmmc.is_runtime_M)
+            brgmm_ctx.set_brg_kernel(idx, tail_kernels->kernels[idx].get(),
+                    &tail_kernels->palettes[idx][0]);
+        else
+            brgmm_ctx.set_brg_kernel(idx, brg_kernels_[idx].get(),
+                    &brg_kernel_palettes_[idx][0]);
+    }
+
     return status::success;
 }
 
@@ -197,8 +287,9 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
 
     brg_matmul_exec_ctx_t brgmm_ctx(
             ctx, pd(), oscales, src_zero_point, wei_zero_point, dst_zero_point);
+    CHECK(init_brg_kernels_for_execution(brgmm_ctx));
 
-    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto &bgmmc = brgmm_ctx.get_bgmmc();
     const bool use_buffer_a
             = bgmmc.use_buffer_a || bgmmc.use_buffer_a_tail_only;
     constexpr bool is_amx
@@ -219,7 +310,7 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
 
         if (is_amx) {
             const auto base_ker_idx = brgmm_ctx.get_base_brgemm_kernel_idx();
-            amx_tile_configure(&brg_kernel_palettes_[base_ker_idx][0]);
+            amx_tile_configure(brgmm_ctx.get_brg_kernel_palette(base_ker_idx));
         }
 
         int b {0}, mc {0}, nc {0};
@@ -261,7 +352,7 @@ void brgemm_matmul_t<isa>::compute_kernel(
         int m_blk_idx, int n_blk_idx, int k_chunk_idx, bool do_init) const {
     constexpr bool is_amx
             = one_of(isa, avx512_core_bf16_amx_int8, avx512_core_bf16_amx_bf16);
-    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto &bgmmc = brgmm_ctx.get_bgmmc();
     const auto addr_batch = brgmm_ctx.get_batch_elem_ptr(ithr);
     const int base_brg_ker_idx = brgmm_ctx.get_base_brgemm_kernel_idx();
 
@@ -282,7 +373,7 @@ void brgemm_matmul_t<isa>::compute_kernel(
     const bool is_K_tail
             = is_last_K_chunk && (gemm_batch * bgmmc.K_blk) != remaining_k_blks;
     auto is_bs_tail = (gemm_batch != bgmmc.brgemm_batch_size);
-    const int brg_ker_idx = pd()->get_brg_kernel_idx(
+    const int brg_ker_idx = brgmm_ctx.get_brg_kernel_idx(
             is_bs_tail, do_init, is_M_tail, is_N_tail, false);
     const auto ptr_bias = brgmm_ctx.get_bias_ptr(n);
     auto ptr_D = brgmm_ctx.get_data_C_ptr(b_idx, m, n);
@@ -300,12 +391,12 @@ void brgemm_matmul_t<isa>::compute_kernel(
             && (bgmmc.nthr_k <= 1 || bgmmc.K_chunks == 1);
 
     if (gemm_batch > 0 && brg_ker_idx >= 0) {
-        const auto brg_kernel = brg_kernels_[brg_ker_idx].get();
+        const auto brg_kernel = brgmm_ctx.get_brg_kernel(brg_ker_idx);
         assert(brg_kernel != nullptr);
 
         const bool is_tile_reconf_required = is_amx && (is_M_tail || is_N_tail);
         if (is_tile_reconf_required)
-            amx_tile_configure(&brg_kernel_palettes_[brg_ker_idx][0]);
+            amx_tile_configure(brgmm_ctx.get_brg_kernel_palette(brg_ker_idx));
 
         brgmm_ctx.init_brgemm_batch_elements_values(
                 ithr, 0, gemm_batch, b_idx, m_blk_idx, k_blk_idx, n_blk_idx);
@@ -341,20 +432,21 @@ void brgemm_matmul_t<isa>::compute_kernel(
         }
 
         if (is_tile_reconf_required)
-            amx_tile_configure(&brg_kernel_palettes_[base_brg_ker_idx][0]);
+            amx_tile_configure(
+                    brgmm_ctx.get_brg_kernel_palette(base_brg_ker_idx));
     }
     if (is_K_tail) {
         brgmm_ctx.init_brgemm_batch_elements_values(
                 ithr, gemm_batch, 1, b_idx, m_blk_idx, k_blk_idx, n_blk_idx);
 
         const bool use_init_ker = (do_init && gemm_batch == 0);
-        const int brg_ker_idx = pd()->get_brg_kernel_idx(
+        const int brg_ker_idx = brgmm_ctx.get_brg_kernel_idx(
                 false, use_init_ker, is_M_tail, is_N_tail, true);
-        const auto brg_kernel_k_tail = brg_kernels_[brg_ker_idx].get();
+        const auto brg_kernel_k_tail = brgmm_ctx.get_brg_kernel(brg_ker_idx);
         const bool is_tile_reconf_required
                 = is_amx && bgmmc.K_tail != bgmmc.K_blk;
         if (is_tile_reconf_required)
-            amx_tile_configure(&brg_kernel_palettes_[brg_ker_idx][0]);
+            amx_tile_configure(brgmm_ctx.get_brg_kernel_palette(brg_ker_idx));
         if (post_ops_applicable) {
             void *scratch = is_amx
                     ? static_cast<void *>(wsp_tile)
@@ -385,7 +477,8 @@ void brgemm_matmul_t<isa>::compute_kernel(
                     (void *)ptr_C, is_amx ? (void *)wsp_tile : nullptr);
         }
         if (is_tile_reconf_required)
-            amx_tile_configure(&brg_kernel_palettes_[base_brg_ker_idx][0]);
+            amx_tile_configure(
+                    brgmm_ctx.get_brg_kernel_palette(base_brg_ker_idx));
     }
 }
 
@@ -394,7 +487,7 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
         const brg_matmul_exec_ctx_t &brgmm_ctx) const {
     if (!brgmm_ctx.parallel_reduction_is_used()) return;
 
-    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto &bgmmc = brgmm_ctx.get_bgmmc();
     const int num_threads = brgmm_ctx.get_num_threads_for_parallelization();
 
     parallel(num_threads, [&](const int ithr, const int nthr) {
@@ -448,9 +541,10 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
                     for (int nb = nb_start; nb < nb_end; nb++) {
                         const bool is_N_tail
                                 = (bgmmc.N - nb * bgmmc.N_blk < bgmmc.N_blk);
-                        const int brg_ker_idx = pd()->get_brg_kernel_idx(
+                        const int brg_ker_idx = brgmm_ctx.get_brg_kernel_idx(
                                 false, false, is_M_tail, is_N_tail, false);
-                        const auto brg_kernel = brg_kernels_[brg_ker_idx].get();
+                        const auto brg_kernel
+                                = brgmm_ctx.get_brg_kernel(brg_ker_idx);
                         const int m = mb * bgmmc.M_blk;
                         const int n = nb * bgmmc.N_blk;
                         const auto ptr_bias = brgmm_ctx.get_bias_ptr(n);
@@ -507,7 +601,7 @@ template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::copy_a_chunk_in_buffer(
         const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr, int b_idx,
         int m_blk_idx, int k_chunk_idx) const {
-    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto &bgmmc = brgmm_ctx.get_bgmmc();
 
     auto ctx = jit_brgemm_matmul_copy_a_t::ctx_t();
     const int k_start = k_chunk_idx * bgmmc.K_chunk_elems;
@@ -554,7 +648,7 @@ template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
         const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr, int b_idx,
         int n_blk_idx, int k_chunk_idx) const {
-    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto &bgmmc = brgmm_ctx.get_bgmmc();
 
     const int k_start = k_chunk_idx * bgmmc.K_chunk_elems;
     const bool is_K_tail
@@ -615,6 +709,12 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
             int32_t dst_zp)
         : bgmmc_(pd->get_brgemm_matmul_conf()) {
 
+        if (bgmmc_.is_runtime_M) {
+            const memory_desc_wrapper src_d
+                    = ctx.memory_mdw(DNNL_ARG_SRC, pd->src_md());
+            init_M_dependent_values(bgmmc_, src_d.dims()[bgmmc_.ndims - 2]);
+        }
+
         data_A_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
         data_B_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
         data_C_ptr_ = CTX_OUT_MEM(char *, DNNL_ARG_DST);
@@ -622,7 +722,7 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         bias_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
         oscales_ptr_ = oscales;
         memory_tracking::grantor_t scratchpad = ctx.get_scratchpad_grantor();
-        const auto &bgmmc = pd->get_brgemm_matmul_conf();
+        const auto &bgmmc = bgmmc_;
 
         batch_element_ptr_ = scratchpad.template get<brgemm_batch_element_t>(
                 key_brgemm_primitive_batch);
@@ -681,7 +781,9 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         post_ops_binary_rhs_arg_vec_ = binary_injector::prepare_binary_args(
                 pd->attr()->post_ops_, ctx);
         base_brg_ker_idx_
-                = pd->get_brg_kernel_idx(false, true, false, false, false);
+                = get_brg_kernel_idx(false, true, false, false, false);
+        for (int i = 0; i < max_num_brg_kernels_matmul; i++)
+            set_brg_kernel(i, nullptr, nullptr);
         vnni_factor = isa == avx512_core_bf16_amx_int8
                 ? 4
                 : isa == avx512_core_bf16_amx_bf16 ? 2 : 1;
@@ -1024,6 +1126,31 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
     int get_base_brgemm_kernel_idx() const { return base_brg_ker_idx_; }
 
+    // Returns the configuration of the current call, it differs from the
+    // primitive one by M-dependent values for runtime M.
+    const brgemm_matmul_conf_t &get_bgmmc() const { return bgmmc_; }
+
+    int get_brg_kernel_idx(bool is_bs_tail, bool do_initialization,
+            bool is_M_tail, bool is_N_tail, bool is_K_tail) const {
+        int bs = get_brg_batchsize(bgmmc_, is_bs_tail, is_K_tail);
+        return get_brg_kernel_index(bgmmc_, is_bs_tail, do_initialization,
+                is_M_tail, is_N_tail, is_K_tail, bs);
+    }
+
+    void set_brg_kernel(
+            int idx, const brgemm_kernel_t *kernel, const char *palette) {
+        brg_kernels_[idx] = kernel;
+        brg_kernel_palettes_[idx] = palette;
+    }
+
+    const brgemm_kernel_t *get_brg_kernel(int idx) const {
+        return brg_kernels_[idx];
+    }
+
+    const char *get_brg_kernel_palette(int idx) const {
+        return brg_kernel_palettes_[idx];
+    }
+
     bool is_last_K_chunk(int k_chunk_idx) const {
         return k_chunk_idx == bgmmc_.K_chunks - 1;
     }
@@ -1054,7 +1181,7 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
 private:
     bool is_amx_;
-    const brgemm_matmul_conf_t &bgmmc_;
+    brgemm_matmul_conf_t bgmmc_;
     const char *data_A_ptr_;
     const char *data_B_ptr_;
     char *data_C_ptr_;
@@ -1081,6 +1208,8 @@ private:
 
     int base_brg_ker_idx_;
     int vnni_factor;
+    const brgemm_kernel_t *brg_kernels_[max_num_brg_kernels_matmul];
+    const char *brg_kernel_palettes_[max_num_brg_kernels_matmul];
 
     // parallelization parameters
     int parallel_work_amount_;
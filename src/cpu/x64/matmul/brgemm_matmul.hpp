@@ -19,6 +19,7 @@
 
 #include "common/c_types_map.hpp"
 #include "common/primitive.hpp"
+#include "common/rw_mutex.hpp"
 #include "common/type_helpers.hpp"
 
 #include "cpu/matmul/cpu_matmul_pd.hpp"
@@ -72,6 +73,9 @@ struct brgemm_matmul_t : public primitive_t {
                 JIT_IMPL_NAME_HELPER("brg:", isa, ""), brgemm_matmul_t);
 
         status_t init(engine_t *engine);
+        status_t init_brg_desc(brgemm_t &brg, bool is_bs_tail,
+                bool do_initialization, dim_t vM, bool is_N_tail,
+                bool is_K_tail) const;
         int get_brg_kernel_idx(bool is_bs_tail, bool do_initialization,
                 bool is_M_tail, bool is_N_tail, bool is_K_tail) const {
             int bs = get_brg_batchsize(bgmmc_, is_bs_tail, is_K_tail);
@@ -101,8 +105,21 @@ struct brgemm_matmul_t : public primitive_t {
 private:
     struct brg_matmul_exec_ctx_t;
 
+    // Kernels for a single M tail size, used when M is defined at execution
+    // time only. Indexing is the same as for brg_kernels_.
+    struct brg_M_tail_kernels_t {
+        std::unique_ptr<brgemm_kernel_t> kernels[max_num_brg_kernels_matmul];
+        char palettes[max_num_brg_kernels_matmul][64];
+    };
+
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     status_t execute_body(const exec_ctx_t &ctx) const;
+    status_t create_M_tail_kernels(dim_t M_tail,
+            std::unique_ptr<brg_M_tail_kernels_t> &tail_kernels) const;
+    status_t get_M_tail_kernels(dim_t M_tail,
+            const brg_M_tail_kernels_t *&tail_kernels) const;
+    status_t init_brg_kernels_for_execution(
+            brg_matmul_exec_ctx_t &brgmm_ctx) const;
     void compute_kernel(const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr,
             int b_idx, int m_blk_idx, int n_blk_idx, int k_blk_idx,
             bool do_init) const;
@@ -121,6 +138,13 @@ private:
     std::unique_ptr<jit_brgemm_matmul_copy_a_t> copy_A_kernel_;
     std::unique_ptr<cpu_accumulator_1d_t<data_type::f32>> acc_ker_f32_;
     std::unique_ptr<cpu_accumulator_1d_t<data_type::s32>> acc_ker_s32_;
+
+    // Per-primitive cache of runtime M tail kernels indexed by the tail size.
+    // Power of 2 tails are generated at creation, other tails are generated
+    // on first use.
+    mutable std::unique_ptr<brg_M_tail_kernels_t>
+            M_tail_kernels_[runtime_M_blk];
+    mutable utils::rw_mutex_t M_tail_kernels_mutex_;
 };
 
 } // namespace matmul
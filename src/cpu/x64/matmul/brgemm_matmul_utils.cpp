@@ -514,6 +514,7 @@ void compute_blocking_heuristic_amx(const brgemm_matmul_conf_t &bgmmc,
     const bool is_amx_bf16
             = bgmmc.isa == avx512_core_bf16_amx_bf16; // note: also bf32
     const int max_nthr_k = is_amx_bf16 && bgmmc.batch == 1
+                    && !bgmmc.is_runtime_M
             ? nstl::min(saturate(1, 7, bgmmc.nthr / 8), max_k_parallel_work)
             : 1;
     int iter = 0;
@@ -628,6 +629,7 @@ float compute_blocking_heuristic_avx512(brgemm_matmul_conf_t &bgmmc,
 
         // Parallelize across K for shapes with big 'K' dimension
         bool bwd_w_par_k_blk = bm_conf_utils.check_is_transposed(bgmmc.src_tag)
+                && !bgmmc.is_runtime_M
                 && IMPLICATION(bm_conf_utils.is_bf16(), math::is_pow2(matmul.K))
                 && matmul.K >= 2048;
         if (bwd_w_par_k_blk) {
@@ -842,6 +844,18 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.batch_without_first_dim
             = bgmmc.batch_ndims > 1 ? helper.batch() / dst_d.dims()[0] : 0;
 
+    // Only M may be defined at execution time: other dimensions and all the
+    // strides define the blocking and the generated kernels.
+    bgmmc.is_runtime_M = is_runtime_value(bgmmc.M);
+    const bool runtime_dims_ok
+            = IMPLICATION(src_d.has_runtime_dims() || dst_d.has_runtime_dims(),
+                      bgmmc.is_runtime_M && bgmmc.batch_ndims == 0
+                              && !bgmmc.with_binary)
+            && !is_runtime_value(bgmmc.N) && !is_runtime_value(bgmmc.K)
+            && !weights_d.has_runtime_dims_or_strides()
+            && !src_d.has_runtime_strides() && !dst_d.has_runtime_strides();
+    if (!runtime_dims_ok) return status::unimplemented;
+
     bgmmc.bcast_A_desc.set_params(
             src_d.dims(), dst_d.dims(), bgmmc.batch_ndims, bgmmc.batch);
     bgmmc.bcast_B_desc.set_params(
@@ -876,6 +890,7 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
             || bgmmc.wei_zp_type != brgemm_broadcast_t::none
             || bgmmc.transposed_A || lda_is_big_2pow;
     bgmmc.use_buffer_a = is_copy_a_required;
+    if (bgmmc.is_runtime_M && bgmmc.transposed_A) return status::unimplemented;
 
     // Supported computation with copy only part of A related to K_tail if
     // is_copy_a_required == true, but the current performance measurements
@@ -895,7 +910,7 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     // BF32 'Hint' Heuristic:
     // Under the following conditions, F32 through AVX512_CORE performs better
     // than using BF32 arithmetic.
-    if (bgmmc.is_bf32 && (bgmmc.M < 8)
+    if (bgmmc.is_bf32 && !bgmmc.is_runtime_M && (bgmmc.M < 8)
             && ((bgmmc.wei_tag == abcd) || bm_conf_utils.is_any_B_layout()))
         return status::unimplemented;
 
@@ -904,7 +919,16 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     // - N_blk, N_Chunk
     // - K_blk, batch_size
     // - nthr_K
+    // For runtime M the heuristic assumes enough rows to load all threads, but
+    // M blocking is fixed so that the kernels to generate are known in advance.
+    if (bgmmc.is_runtime_M) bgmmc.M = runtime_M_blk * bgmmc.nthr;
     CHECK(compute_blocking_heuristic(bgmmc, bm_conf_utils));
+    if (bgmmc.is_runtime_M) {
+        assert(bgmmc.nthr_k == 1);
+        bgmmc.M = DNNL_RUNTIME_DIM_VAL;
+        bgmmc.M_blk = runtime_M_blk;
+        bgmmc.M_chunk_size = 1;
+    }
 
     if (bgmmc.wei_n_blk > bgmmc.N_blk
             && IMPLICATION(
@@ -919,7 +943,6 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     CHECK(bm_conf_utils.set_B_flags(weights_md));
 
-    bgmmc.M_tail = bgmmc.M % bgmmc.M_blk;
     bgmmc.N_tail = bgmmc.N % bgmmc.N_blk;
     bgmmc.K_tail = bgmmc.K > bgmmc.K_blk
             ? rnd_up(bgmmc.K % bgmmc.K_blk, bgmmc.required_k_granularity)
@@ -943,10 +966,9 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
     bgmmc.M_chunk_elems = bgmmc.M_blk * bgmmc.M_chunk_size;
     bgmmc.N_chunk_elems = bgmmc.N_blk * bgmmc.N_chunk_size;
     bgmmc.K_chunk_elems = bgmmc.K_blk * bgmmc.brgemm_batch_size;
-    bgmmc.M_chunks = div_up(bgmmc.M, bgmmc.M_chunk_elems);
     bgmmc.N_chunks = div_up(bgmmc.N, bgmmc.N_chunk_elems);
     bgmmc.K_chunks = div_up(bgmmc.K, bgmmc.K_chunk_elems);
-    bgmmc.num_M_blocks = div_up(bgmmc.M, bgmmc.M_blk);
+    if (!bgmmc.is_runtime_M) init_M_dependent_values(bgmmc, bgmmc.M);
     bgmmc.num_N_blocks = div_up(bgmmc.N, bgmmc.N_blk);
     const int last_chunck_batch_size
             = (nstl::max(bgmmc.K, bgmmc.K_blk)
@@ -1041,6 +1063,13 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
     bgmmc.brgemm_batch_element_per_thr_sz = 16 * bgmmc.brgemm_batch_size;
 }
 
+void init_M_dependent_values(brgemm_matmul_conf_t &bgmmc, dim_t M) {
+    bgmmc.M = M;
+    bgmmc.M_tail = M % bgmmc.M_blk;
+    bgmmc.M_chunks = div_up(M, bgmmc.M_chunk_elems);
+    bgmmc.num_M_blocks = div_up(M, bgmmc.M_blk);
+}
+
 void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         const brgemm_matmul_conf_t &bgmmc) {
     const size_t default_data_align = sizeof(char);
@@ -30,6 +30,10 @@ namespace matmul {
 
 constexpr int max_batch_ndims = DNNL_MAX_NDIMS - 2;
 
+// M block size used when M is defined at execution time only. Kernels for
+// M tails smaller than this value are selected or generated per call.
+constexpr dim_t runtime_M_blk = 32;
+
 struct brgemm_matmul_bcast_desc_t {
 
     brgemm_matmul_bcast_desc_t()
@@ -171,6 +175,7 @@ struct brgemm_matmul_conf_t {
     int wsp_tile_per_thr_bytes;
     int brgemm_batch_element_per_thr_sz;
     bool is_amx;
+    bool is_runtime_M;
 
     int required_k_granularity;
     bool is_bf32 = false;
@@ -281,6 +286,10 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
         const memory_desc_wrapper &src_d, const memory_desc_wrapper &wei_d,
         const memory_desc_wrapper &dst_d);
 
+// Sets the values of the configuration that depend on M. For runtime M it is
+// called at execution time on a copy of the primitive configuration.
+void init_M_dependent_values(brgemm_matmul_conf_t &bgmmc, dim_t M);
+
 status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
         const matmul_desc_t &mmd, memory_desc_t &src_md,
         memory_desc_t &weights_md, memory_desc_t &dst_md,
@@ -107,6 +107,17 @@ template <typename src_t, typename weights_t, typename scratch_t,
         typename gemm_acc_t>
 void brgemm_dst_layer_iter_t<src_t, weights_t, scratch_t, gemm_acc_t>::execute()
         const {
+    if (rnn_.cell_nthr > 0) {
+        // Called from the persistent region of the layer: the hidden state
+        // is complete once all the threads have reached the barrier.
+        if (is_fused_layer_iter_brgemm_)
+            kernel_fused_iter_layer(rnn_.cell_ithr, rnn_.cell_nthr);
+        else
+            kernel(rnn_.cell_ithr, rnn_.cell_nthr);
+        dnnl_thr_barrier();
+        return;
+    }
+
     if (is_fused_layer_iter_brgemm_) {
         parallel(max_nthr_, [this](const int ithr, const int nthr) {
             this->kernel_fused_iter_layer(ithr, nthr);
@@ -381,11 +381,35 @@ status_t rnn_brgemm_t<prop_kind::forward>::configure_brgemm(
     rnn.brgemm_isa = adjust_isa_by_m_block(
             rnn.brgemm_isa, rnn.m_block, rnn.is_cell_int8_amx());
     // Unfused post-gemm for lstm cell allows to parallelize across gates loop
-    // and reduces brgemm problem size for the single iteration of parallel loop
+    // and reduces brgemm problem size for the single iteration of parallel
+    // loop. It is only worth it when the blocks of rows and columns do not
+    // give enough work to the threads: otherwise the fused post-gemm consumes
+    // the gates of a block right after the brgemm calls while they are still
+    // in L1, instead of writing all the gates of the cell to scratch and
+    // reading them back in a separate parallel loop.
+    const bool enough_work_without_gates
+            = rnn.M_blocks > 1 || rnn.N_blocks >= rnn.nthr;
     rnn.unfused_post_gemm = cell_kind == alg_kind::vanilla_lstm
-            ? IMPLICATION(rnn.M_blocks > 1, rnn.is_cell_bf16_amx())
+            ? rnn.is_cell_bf16_amx() || !enough_work_without_gates
             : false;
 
+    // With a single block of rows, the threads only split the columns and
+    // every cell of a layer uses the same weights. Keeping the split across
+    // the iterations lets each thread reuse its slice of the weights from
+    // L2 instead of streaming them from memory at every iteration. The
+    // post-gemm has to be fused so that a thread completes its columns of
+    // the hidden state before the barrier.
+    const dim_t wei_slice_size = src_layer_type_size * rnn.n_gates
+            * (rnn.K1padded + rnn.K2padded) * rnn.n_block
+            * utils::div_up(rnn.N_blocks, nstl::min(rnn.nthr, rnn.N_blocks));
+    rnn.brgemm_fwd_persistent = dnnl_thr_syncable() && !rnn.is_training
+            && utils::one_of(
+                    cell_kind, alg_kind::vanilla_lstm, alg_kind::vanilla_rnn)
+            && !rnn.is_lstm_projection && rnn.M_blocks == 1 && rnn.nthr > 1
+            && rnn.N_blocks > 1 && rnn.n_iter > 1
+            && wei_slice_size <= l2_cache_size / 2;
+    if (rnn.brgemm_fwd_persistent) rnn.unfused_post_gemm = false;
+
     rnn.LDA1[0] = rnn.src_layer_ld_;
     rnn.LDA1[1] = rnn.dst_iter_ld_;
     rnn.LDA1[2] = rnn.ws_states_layer_ld;
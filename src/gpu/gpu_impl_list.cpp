@@ -35,8 +35,11 @@ const impl_list_item_t *gpu_impl_list_t::get_implementation_list(
             CASE(deconvolution);
             CASE(eltwise);
             CASE(gemm);
+            // No GPU implementation of group normalization yet
+            case primitive_kind::group_normalization: return empty_list;
             CASE(inner_product);
-            CASE(layer_normalization);
+            case primitive_kind::layer_normalization:
+            CASE(layer_normalization_v2);
             CASE(lrn);
             CASE(logsoftmax);
             CASE(matmul);
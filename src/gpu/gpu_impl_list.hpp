@@ -42,7 +42,7 @@ DECLARE_IMPL_LIST(deconvolution);
 DECLARE_IMPL_LIST(eltwise);
 DECLARE_IMPL_LIST(gemm);
 DECLARE_IMPL_LIST(inner_product);
-DECLARE_IMPL_LIST(layer_normalization);
+DECLARE_IMPL_LIST(layer_normalization_v2);
 DECLARE_IMPL_LIST(lrn);
 DECLARE_IMPL_LIST(logsoftmax);
 DECLARE_IMPL_LIST(matmul);
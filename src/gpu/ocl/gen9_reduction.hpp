@@ -41,6 +41,9 @@ struct gen9_reduction_t : public gpu_primitive_t {
 
         status_t init(engine_t *engine) {
             bool ok = set_default_params() == status::success
+                    && !utils::one_of(desc()->alg_kind,
+                            alg_kind::reduction_argmax,
+                            alg_kind::reduction_argmin)
                     && attr()->has_default_values()
                     && !memory_desc_ndims_ok(src_md(), dst_md());
             if (!ok) return status::unimplemented;
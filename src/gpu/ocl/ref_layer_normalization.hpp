@@ -52,7 +52,7 @@ struct ref_layer_normalization_fwd_t : public gpu_primitive_t {
                             || utils::everyone_is(f32, src_data_t, dst_data_t))
                     && !memory_desc_ndims_ok(src_md(), dst_md(), stat_md())
                     && stat_md()->data_type == f32
-                    && check_scale_shift_data_type()
+                    && check_scale_shift_data_type() && !skip_mean()
                     && attr()->has_default_values()
                     && set_default_formats_common();
             if (!ok) return status::unimplemented;
@@ -107,8 +107,10 @@ struct ref_layer_normalization_bwd_t : public gpu_primitive_t {
                     && (utils::everyone_is(f32, src_data_t, diff_dst_data_t)
                             || utils::everyone_is(
                                     bf16, src_data_t, diff_dst_data_t))
-                    && check_scale_shift_data_type()
+                    && check_scale_shift_data_type() && !skip_mean()
                     && set_default_formats_common()
+                    && memory_desc_wrapper(diff_src_md())
+                            == memory_desc_wrapper(diff_dst_md())
                     && attr()->has_default_values();
             if (!ok) return status::unimplemented;
 
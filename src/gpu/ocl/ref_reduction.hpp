@@ -44,6 +44,9 @@ struct ref_reduction_t : public gpu_primitive_t {
             const auto attr_skip_mask = sm::post_ops;
 
             const bool ok = set_default_params() == status::success
+                    && !utils::one_of(desc()->alg_kind,
+                            alg_kind::reduction_argmax,
+                            alg_kind::reduction_argmin)
                     && !memory_desc_ndims_ok(src_md(), dst_md())
                     && attr()->has_default_values(attr_skip_mask)
                     && post_ops_with_binary_ok(attr(), dst_md()->data_type, 5)
@@ -480,6 +480,7 @@ status_t _ref_rnn_common_t<aprop>::pd_t::init(engine_t *engine) {
             && one_of(cell_kind, alg_kind::vanilla_rnn, alg_kind::vanilla_lstm,
                     alg_kind::lbr_gru, alg_kind::vanilla_gru)
             && !this->is_lstm_peephole() && !this->is_lstm_projection()
+            && !this->with_seq_lengths()
             && IMPLICATION(aprop == prop_kind::forward,
                     one_of(this->desc()->prop_kind, forward_training,
                             forward_inference))
@@ -406,6 +406,25 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
     cmp.set_driver_check_function(bnorm_add_check);
 }
 
+// Two-pass statistics read src once for mean and once more for variance.
+// Reports the src traffic the one-pass algorithm saves on every execution.
+static void report_stats_one_pass_saving(const prb_t *prb, res_t *res) {
+#ifdef DNNL_EXPERIMENTAL
+    const bool stats_one_pass
+            = dnnl::impl::experimental::use_bnorm_stats_one_pass()
+            && (prb->dir & FLAG_FWD) && !(prb->flags & GLOB_STATS);
+    if (!stats_one_pass || !is_bench_mode(PERF)) return;
+
+    const double saved_bytes = (double)prb->mb * prb->ic * prb->id * prb->ih
+            * prb->iw * dnnl_data_type_size(prb->dt);
+    const double ms = res->timer_map.perf_timer().ms(timer::timer_t::min);
+    BENCHDNN_PRINT(2,
+            "one-pass stats: src read once instead of twice, saved %g MB "
+            "(%g GB/s at min time)\n",
+            saved_bytes / 1e6, ms > 0 ? saved_bytes / ms / 1e6 : 0.);
+#endif
+}
+
 int doit(const prb_t *prb, res_t *res) {
     if (bench_mode == LIST) return res->state = LISTED, OK;
 
@@ -590,7 +609,10 @@ int doit(const prb_t *prb, res_t *res) {
         }
     }
 
-    return measure_perf(res, prim, args);
+    SAFE(measure_perf(res, prim, args), WARN);
+    report_stats_one_pass_saving(prb, res);
+
+    return OK;
 }
 
 } // namespace bnorm
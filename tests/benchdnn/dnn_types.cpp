@@ -769,6 +769,8 @@ std::ostream &dump_global_params(std::ostream &s) {
         s << "--allow-enum-tags-only=" << bool2str(allow_enum_tags_only) << " ";
     if (canonical || hints.get() != isa_hints_t::none)
         s << "--cpu-isa-hints=" << isa_hints_t::hints2str(hints) << " ";
+    if (canonical || max_cpu_isa != dnnl_cpu_isa_all)
+        s << "--max-cpu-isa=" << cpu_isa2str(max_cpu_isa) << " ";
     if (canonical || bench_mode != CORR) s << "--mode=" << bench_mode << " ";
     if (canonical || attr_same_pd_check != false)
         s << "--attr-same-pd-check=" << bool2str(attr_same_pd_check) << " ";
@@ -789,6 +791,37 @@ dnnl_engine_kind_t str2engine_kind(const char *str) {
     return dnnl_cpu;
 }
 
+namespace {
+const std::vector<std::pair<dnnl_cpu_isa_t, const char *>> cpu_isa_names {
+        {dnnl_cpu_isa_all, "all"},
+        {dnnl_cpu_isa_sse41, "sse41"},
+        {dnnl_cpu_isa_avx, "avx"},
+        {dnnl_cpu_isa_avx2, "avx2"},
+        {dnnl_cpu_isa_avx2_vnni, "avx2_vnni"},
+        {dnnl_cpu_isa_avx512_core, "avx512_core"},
+        {dnnl_cpu_isa_avx512_core_vnni, "avx512_core_vnni"},
+        {dnnl_cpu_isa_avx512_core_bf16, "avx512_core_bf16"},
+        {dnnl_cpu_isa_avx512_core_amx, "avx512_core_amx"},
+};
+} // namespace
+
+dnnl_cpu_isa_t str2cpu_isa(const char *str) {
+    for (const auto &e : cpu_isa_names)
+        if (!strcasecmp(e.second, str)) return e.first;
+
+    BENCHDNN_PRINT(0, "%s \'%s\'\n", "Error: unknown cpu isa", str);
+    SAFE_V(FAIL);
+    return dnnl_cpu_isa_all;
+}
+
+const char *cpu_isa2str(dnnl_cpu_isa_t isa) {
+    for (const auto &e : cpu_isa_names)
+        if (e.first == isa) return e.second;
+
+    assert(!"unknown cpu isa");
+    return "unknown_cpu_isa";
+}
+
 dnnl_scratchpad_mode_t str2scratchpad_mode(const char *str) {
     const char *param = "library";
     if (!strncasecmp(param, str, strlen(param)))
@@ -518,6 +518,8 @@ dnnl_primitive_attr_t create_dnnl_attr(
         const attr_t &attr, const attr_args_t &attr_args);
 
 dnnl_engine_kind_t str2engine_kind(const char *str);
+dnnl_cpu_isa_t str2cpu_isa(const char *str);
+const char *cpu_isa2str(dnnl_cpu_isa_t isa);
 dnnl_scratchpad_mode_t str2scratchpad_mode(const char *str);
 dnnl_fpmath_mode_t str2fpmath_mode(const char *str);
 
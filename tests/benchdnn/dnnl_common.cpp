@@ -238,6 +238,8 @@ dnnl_engine_kind_t engine_tgt_kind = dnnl_cpu;
 size_t engine_index = 0;
 // CPU ISA specific hints : none by default
 isa_hints_t hints {isa_hints_t::none};
+// Maximal CPU ISA : no limitation by default
+dnnl_cpu_isa_t max_cpu_isa {dnnl_cpu_isa_all};
 
 memory_kind_ext_t memory_kind {default_memory_kind};
 
@@ -252,6 +254,12 @@ void init_isa_settings() {
     }
 }
 
+void init_max_cpu_isa() {
+    // Do nothing when no limitation is requested
+    if (max_cpu_isa == dnnl_cpu_isa_all) return;
+    DNN_SAFE_V(dnnl_set_max_cpu_isa(max_cpu_isa));
+}
+
 args_t &args_t::set(int arg, const dnn_mem_t &mem) {
     args_.emplace_back(arg, &mem);
     return *this;
@@ -216,6 +216,7 @@ float round_to_nearest_representable(dnnl_data_type_t dt, float value);
 extern dnnl_engine_kind_t engine_tgt_kind;
 extern size_t engine_index;
 extern isa_hints_t hints;
+extern dnnl_cpu_isa_t max_cpu_isa;
 
 struct engine_t {
     engine_t(dnnl_engine_kind_t engine_kind);
@@ -293,6 +294,7 @@ const memory_kind_ext_t default_memory_kind = memory_kind_ext_t::usm;
 extern memory_kind_ext_t memory_kind;
 
 void init_isa_settings();
+void init_max_cpu_isa();
 
 struct args_t {
     args_t &set(int arg, const dnn_mem_t &mem);
@@ -0,0 +1,500 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <float.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <random>
+#include <sstream>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "utils/parallel.hpp"
+
+#include "dnnl_common.hpp"
+#include "dnnl_memory.hpp"
+
+#include "binary/binary.hpp"
+#include "gnorm/gnorm.hpp"
+
+using namespace bnorm;
+
+namespace gnorm {
+
+static void prepare_scale_shift(
+        const prb_t *prb, dnn_mem_t &sc, dnn_mem_t &sh, float sh_factor) {
+    const bool use_sc = prb->use_sc();
+    const bool use_sh = prb->use_sh();
+
+    benchdnn_parallel_nd(prb->ic, [&](int64_t c) {
+        const float sc_value = 1.f / 8 * (1 << (c % 7));
+        const float sh_value = ((c % 3) - 1) * sc_value * sh_factor;
+        sc.set_elem(c, use_sc ? sc_value : 1.0f);
+        sh.set_elem(c, use_sh ? sh_value : 0.0f);
+    });
+}
+
+static int prepare_fwd_with_stats(const prb_t *prb, dnn_mem_t &src,
+        dnn_mem_t &mean, dnn_mem_t &var, dnn_mem_t &sc, dnn_mem_t &sh) {
+    benchdnn_parallel_nd(prb->mb, prb->g, [&](int64_t mb, int64_t g) {
+        const int64_t idx = mb * prb->g + g;
+        mean.set_elem(stat_off(prb, mb, g), 4 * ((idx % 5) - 2));
+        var.set_elem(stat_off(prb, mb, g), ((idx % 7) << 1));
+    });
+
+    prepare_scale_shift(prb, sc, sh, 8.f);
+
+    benchdnn_parallel_nd(prb->mb, prb->ic, prb->id, prb->ih, prb->iw,
+            [&](int64_t mb, int64_t c, int64_t d, int64_t h, int64_t w) {
+                const int64_t l_base = mb * prb->sp() + c * 239 * 2;
+                const int64_t sp = (d * prb->ih + h) * prb->iw + w;
+                const int64_t l = l_base + sp;
+                const int64_t value = (l % 65) - 32;
+                src.set_elem(data_off(prb, mb, c, d, h, w),
+                        round_to_nearest_representable(prb->dt, value));
+            });
+
+    return OK;
+}
+
+static int prepare_fwd_no_stats(const prb_t *prb, dnn_mem_t &src,
+        dnn_mem_t &mean, dnn_mem_t &var, dnn_mem_t &sc, dnn_mem_t &sh) {
+    /** Idea: choose src[] values so that both mean and variance are computed
+     * exactly (independently of the order of the computations).
+     *
+     * The same approach as in batch normalization is used, but the sequence
+     * (L) a mean and a variance are computed over is a group of channels of a
+     * single mini-batch element: L = ic / g * id * ih * iw.
+     *
+     * ALG_0: mean is set to 0
+     * ALG_1: mean is set to 2^prb, where prb \in {-2, -1, ..., 4}
+     * ALG_AUTO: choose between ALG_0 and ALG_1 automatically */
+    const int64_t exact_bits = digits_dt(prb->dt);
+    const int64_t L = prb->ic_per_g() * prb->sp();
+    const int64_t logL = (int64_t)ceilf(log2f(L));
+
+    assert(logL <= 0 || (1LL << (logL - 1)) < L);
+    assert(L <= (1LL << logL));
+
+    const int64_t min_flex_bits = 3;
+    const int64_t want_flex_bits = MIN2(6, exact_bits / 2);
+
+    check_alg_t alg = prb->check_alg;
+    if (alg == ALG_AUTO) /* choose appropriate checking algorithm */
+        alg = (exact_bits - logL) / 2 - 1 >= min_flex_bits ? ALG_1 : ALG_0;
+
+    const int64_t flex_bits = alg == ALG_0
+            ? want_flex_bits /* BFloat16 has only 7 bits of mantissa */
+            : MIN2(prb->dt == dnnl_bf16 ? 7 : exact_bits,
+                    (exact_bits - logL) / 2 - 1);
+
+    if (flex_bits < min_flex_bits) return FAIL;
+
+    const int64_t flex_mask = (1 << flex_bits) - 1;
+
+    /* density: (exact_bits - log_2(L * density)) / 2 >= flex_bits */
+    const float density = alg == ALG_0
+            ? 1.f * (1 << (exact_bits - 2 * flex_bits)) / L
+            : 1.f;
+    assert((exact_bits - ceilf(log2f(L * density))) / 2 >= flex_bits);
+
+    BENCHDNN_PRINT(6, "check_alg: %s, density = %g, flex_bits = " IFMT "\n",
+            check_alg2str(alg), density, flex_bits);
+
+    const int64_t SP = prb->sp();
+    const int64_t cpg = prb->ic_per_g();
+
+    benchdnn_parallel_nd(prb->mb, prb->g, [&](int64_t mb, int64_t g) {
+        const int64_t idx = mb * prb->g + g;
+        const float m = alg == ALG_0 ? 0.f : 0.25f * (1 << (idx % 7));
+        float v = 0; /* current variance */
+
+        const int64_t l_base = idx * 239 * 2; // l[0] must be even
+        for (int64_t c_in_g = 0; c_in_g < cpg; ++c_in_g) {
+            const int64_t c = g * cpg + c_in_g;
+            float *s = (float *)src + data_off(prb, mb, c, 0, 0, 0);
+
+            for (int64_t sp = 0; sp < SP; ++sp) {
+                const int64_t l_in_g = c_in_g * SP + sp;
+                const int64_t l = l_base + l_in_g;
+
+                if (alg == ALG_0 && !flip_coin(l / 2 * 257ULL, density)) {
+                    s[sp] = 0;
+                    continue;
+                }
+
+                const int64_t gen = (l / 2 * 1637) & flex_mask;
+                const int sgn = l % 2 == 0 ? 1 : -1; /* [a1] */
+                const float f = 1.f * sgn * gen / (1 << flex_bits);
+
+                s[sp] = alg == ALG_0 ? f : m * (1.f + f);
+                if (L % 2 && l_in_g == L - 1) s[sp] = m;
+                v += (s[sp] - m) * (s[sp] - m);
+            }
+        }
+
+        mean.set_elem(stat_off(prb, mb, g), m);
+        var.set_elem(stat_off(prb, mb, g), v / L);
+    });
+
+    prepare_scale_shift(prb, sc, sh, 1.f / 64);
+
+    return OK;
+}
+
+static int prepare_fwd(const prb_t *prb, dnn_mem_t &src, dnn_mem_t &mean,
+        dnn_mem_t &var, dnn_mem_t &sc, dnn_mem_t &sh) {
+    if (prb->flags & GLOB_STATS)
+        return prepare_fwd_with_stats(prb, src, mean, var, sc, sh);
+    else
+        return prepare_fwd_no_stats(prb, src, mean, var, sc, sh);
+}
+
+static int prepare_bwd(const prb_t *prb, dnn_mem_t &mem_dt, dnn_mem_t &mem_fp) {
+    const auto nelems = mem_fp.nelems();
+    if (nelems == 0) return OK;
+
+    // Idea behind filling: integer diff_dst values decrease norms unlike fp32
+    // values in [-1.f, 1.f] range. To decrease norms more, make data pretty
+    // sparse as answers sum all diff_dst values.
+
+    /* Do fixed partitioning to have same filling for any number of threads */
+    const int64_t n_chunks = 16;
+    const int64_t chunk_size = div_up(nelems, n_chunks);
+
+    benchdnn_parallel_nd(n_chunks, [&](int64_t idx_chunk) {
+        int64_t idx_start = idx_chunk * chunk_size;
+        int64_t idx_end = MIN2(idx_start + chunk_size, nelems);
+
+        // Note: we use a different seed for each chunk to avoid
+        // repeating patterns. We add 1 to avoid seeding with 0.
+        std::minstd_rand msr(idx_start + 1);
+        msr.discard(1);
+
+        std::uniform_int_distribution<> igen_val(-2, 2);
+        std::uniform_int_distribution<> igen_coin(0, 256 * 1024);
+
+        // at least 20 non-zero elems
+        float sparsity = MAX2(0.05f, MIN2(1.f, 20.f / nelems));
+
+        for (int64_t idx = idx_start; idx < idx_end; ++idx) {
+            float value = flip_coin(igen_coin(msr), sparsity)
+                    ? round_to_nearest_representable(prb->dt, igen_val(msr))
+                    : 0;
+            mem_fp.set_elem(idx, value);
+        }
+    });
+
+    SAFE(mem_dt.reorder(mem_fp), WARN);
+
+    return OK;
+}
+
+dnnl_status_t init_pd(dnnl_engine_t engine, const prb_t *prb,
+        dnnl_primitive_desc_t &gpd, res_t *res, dir_t dir,
+        const_dnnl_primitive_desc_t hint) {
+    dnnl_group_normalization_desc_t gd;
+
+    const auto data_dims = prb->data_dims();
+    auto data_d = dnn_mem_t::init_md(
+            prb->ndims, data_dims.data(), prb->dt, prb->tag);
+
+    auto flags = (dnnl_normalization_flags_t)prb->flags;
+    attr_args_t attr_args;
+    if (dir & FLAG_FWD) {
+        auto prop = prb->dir & FLAG_INF ? dnnl_forward_inference
+                                        : dnnl_forward_training;
+        DNN_SAFE_STATUS(dnnl_group_normalization_forward_desc_init(
+                &gd, prop, &data_d, &data_d, prb->g, prb->eps, flags));
+        attr_args.prepare_post_ops_mds(
+                prb->attr, prb->ndims, data_dims.data());
+    } else {
+        auto diff_data_d = dnn_mem_t::init_md(
+                prb->ndims, data_dims.data(), prb->dt, tag::any);
+        auto prop = prb->dir & FLAG_WEI ? dnnl_backward : dnnl_backward_data;
+        DNN_SAFE_STATUS(dnnl_group_normalization_backward_desc_init(&gd, prop,
+                &diff_data_d, &diff_data_d, &data_d, prb->g, prb->eps, flags));
+    }
+
+    // Post-ops are applied by the forward pass only.
+    auto dnnl_attr = make_benchdnn_dnnl_wrapper(create_dnnl_attr(
+            (dir & FLAG_FWD) ? prb->attr : attr_t(), attr_args));
+
+    return dnnl_primitive_desc_create(&gpd, &gd, dnnl_attr, engine, hint);
+}
+
+void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
+    skip_unimplemented_data_type({prb->dt}, prb->dir, res);
+    skip_unimplemented_sum_po(prb->attr, res);
+
+    // There is no GPU implementation yet.
+    if (is_gpu()) {
+        res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+        return;
+    }
+}
+
+void skip_invalid_prb(const prb_t *prb, res_t *res) {
+    // Post-ops modify the forward output that backward doesn't know about.
+    if ((prb->dir & FLAG_BWD) && !prb->attr.post_ops.is_def()) {
+        res->state = SKIPPED, res->reason = INVALID_CASE;
+        return;
+    }
+
+    // See `skip_invalid_inplace` for details.
+    if (prb->inplace) {
+        skip_invalid_inplace(res, prb->dt, prb->dt, prb->tag, prb->tag);
+        if (res->state == SKIPPED) return;
+    }
+}
+
+void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
+        const args_t &ref_args) {
+    // Since bwd testing is done using results from forward which are random
+    // fp32 values, diff_scale and diff_shift start fluctuating, so norm check
+    // is used for all the kinds.
+    const bool compare_with_norm = (prb->dir & FLAG_BWD);
+    cmp.set_norm_validation_mode(compare_with_norm);
+
+    const int f32_mant_digits = 24;
+    const float trh_coeff = (1 << (f32_mant_digits - digits_dt(prb->dt)));
+    float trh = trh_coeff * ((kind == SRC || kind == DST) ? 5e-7 : 0);
+    if ((kind == SC || kind == SH) && prb->dir & FLAG_BWD)
+        trh = trh_coeff * 5e-6;
+
+    // Optimized implementations may compute statistics in a single pass
+    // combining per-channel partial results, which makes a division by the
+    // number of spatial points inexact.
+    if (kind == MEAN) trh = 1e-7;
+    if (kind == VAR) trh = 4e-7;
+    cmp.set_threshold(trh);
+
+    // TODO: improve bf16 filling
+    if (prb->dt == dnnl_bf16) cmp.set_zero_trust_percent(99.f);
+
+    // When the error is larger than `trh`, it could be due to a catastrophic
+    // cancellation in final result which is computed as `Y = a * X + b`.
+    // See the batch normalization driver for details.
+    //
+    // Since lambda is called when stack is unavailable, need to capture `prb`
+    // and `kind` by value to avoid using dangling references.
+    const auto gnorm_add_check =
+            [&, kind, prb](
+                    const compare::compare_t::driver_check_func_args_t &args) {
+                if (!((prb->dir & FLAG_FWD) && kind == DST && prb->use_sh()))
+                    return false;
+
+                const auto &sh = ref_args.find(DNNL_ARG_SHIFT);
+                const auto &dst = ref_args.find(DNNL_ARG_DST);
+                const int64_t c = dst.get_scale_idx(
+                        args.idx, 1 << 1 /* channel_mask */);
+                const float beta = sh.get_elem(c);
+                // Using an empirically derived threshold, check if
+                // cancellation error in `|Y| = |a*X - (-b)|` is huge.
+                const float abs_exp = fabsf(args.exp);
+                const float norm_denom = abs_exp > FLT_MIN ? abs_exp : 1.f;
+                const float abs_exp_delta = fabsf(args.exp - beta);
+                bool maybe_cancel_error = abs_exp_delta / norm_denom > 1.f;
+                if (!maybe_cancel_error) return false;
+
+                // Check for error in `a * X`
+                float diff_aX = fabsf((args.exp - beta) - (args.got - beta));
+                float rel_diff_aX = diff_aX
+                        / (abs_exp_delta > FLT_MIN ? abs_exp_delta : 1.f);
+                return rel_diff_aX <= args.trh;
+            };
+    cmp.set_driver_check_function(gnorm_add_check);
+}
+
+int doit(const prb_t *prb, res_t *res) {
+    if (bench_mode == LIST) return res->state = LISTED, OK;
+
+    benchdnn_dnnl_wrapper_t<dnnl_primitive_t> prim;
+    SAFE(init_prim(prim, init_pd, prb, res), WARN);
+    if (res->state == SKIPPED || res->state == UNIMPLEMENTED) return OK;
+
+    auto const_fpd = query_pd(prim);
+
+    if (check_mem_size(const_fpd) != OK) {
+        return res->state = SKIPPED, res->reason = NOT_ENOUGH_RAM, OK;
+    }
+
+    const bool use_sc = prb->use_sc();
+    const bool use_sh = prb->use_sh();
+
+    const auto &data_md = query_md(const_fpd, DNNL_ARG_SRC);
+    const auto &mean_md = query_md(const_fpd, DNNL_ARG_MEAN);
+    const auto &var_md = query_md(const_fpd, DNNL_ARG_VARIANCE);
+    const auto &sc_md = query_md(const_fpd, DNNL_ARG_SCALE);
+    const auto &scratchpad_md = query_md(const_fpd, DNNL_ARG_SCRATCHPAD);
+
+    const auto fp = dnnl_f32;
+    const auto tag = tag::abx;
+
+    const auto &test_engine = get_test_engine();
+    const auto &ref_engine = get_cpu_engine();
+
+    dnn_mem_t src_fp(data_md, fp, tag, ref_engine);
+    dnn_mem_t src_dt(data_md, test_engine);
+    // stash for bwd: src_hat[i] = (src[i] - mean) / sqrt(var + prb->eps)
+    dnn_mem_t src_hat_fp(data_md, fp, tag, ref_engine);
+
+    dnn_mem_t &dst_fp = src_fp; // in-place in ref code
+    dnn_mem_t placeholder_dst_dt;
+    const bool inplace_fwd = prb->inplace && (prb->dir & FLAG_FWD);
+    if (!inplace_fwd) { placeholder_dst_dt = dnn_mem_t(data_md, test_engine); }
+    dnn_mem_t &dst_dt = inplace_fwd ? src_dt : placeholder_dst_dt;
+
+    // On inference w/o global stats the group norm doesn't require stat
+    // memories. Hence, we need to prepare the mean_fp and var_fp ourselves.
+    const dnnl_dims_t stat_dims = {prb->mb, prb->g};
+    dnn_mem_t mean_fp(2, stat_dims, fp, tag::abx, ref_engine);
+    dnn_mem_t mean_dt(mean_md, test_engine);
+    dnn_mem_t var_fp(2, stat_dims, fp, tag::abx, ref_engine);
+    dnn_mem_t var_dt(var_md, test_engine);
+
+    // Scale and shift are always prepared for the reference, the library ones
+    // are used only if the corresponding flag is set.
+    const dnnl_dims_t ss_dims = {prb->ic};
+    dnn_mem_t sc_fp(1, ss_dims, fp, tag::x, ref_engine);
+    dnn_mem_t sc_dt(sc_md, test_engine);
+    dnn_mem_t d_sc_fp(1, ss_dims, fp, tag::x, ref_engine);
+    dnn_mem_t d_sc_dt(sc_md, test_engine);
+
+    dnn_mem_t sh_fp(1, ss_dims, fp, tag::x, ref_engine);
+    dnn_mem_t sh_dt(sc_md, test_engine);
+    dnn_mem_t d_sh_fp(1, ss_dims, fp, tag::x, ref_engine);
+    dnn_mem_t d_sh_dt(sc_md, test_engine);
+
+    dnn_mem_t scratchpad_dt(scratchpad_md, test_engine);
+
+    std::vector<dnn_mem_t> binary_po_fp, binary_po_dt;
+    std::vector<int> binary_po_args;
+    SAFE(binary::setup_binary_po(
+                 const_fpd, binary_po_args, binary_po_dt, binary_po_fp),
+            WARN);
+
+    dnn_mem_t d_dst_dt, placeholder_d_src_dt;
+
+    if (prepare_fwd(prb, src_fp, mean_fp, var_fp, sc_fp, sh_fp) != OK) {
+        return res->state = MISTRUSTED, OK;
+    }
+
+    SAFE(src_dt.reorder(src_fp), WARN);
+    if (prb->flags & GLOB_STATS) {
+        SAFE(mean_dt.reorder(mean_fp), WARN);
+        SAFE(var_dt.reorder(var_fp), WARN);
+    }
+    if (use_sc) { SAFE(sc_dt.reorder(sc_fp), WARN); }
+    if (use_sh) { SAFE(sh_dt.reorder(sh_fp), WARN); }
+
+    args_t args, ref_args;
+
+    args.set(DNNL_ARG_SRC, src_dt);
+    args.set(DNNL_ARG_MEAN, mean_dt);
+    args.set(DNNL_ARG_VARIANCE, var_dt);
+    args.set(DNNL_ARG_SCALE, sc_dt);
+    args.set(DNNL_ARG_SHIFT, sh_dt);
+    args.set(DNNL_ARG_SCRATCHPAD, scratchpad_dt);
+    args.set(DNNL_ARG_DST, dst_dt);
+    args.set(binary_po_args, binary_po_dt);
+
+    SAFE(execute_and_wait(prim, args, res), WARN);
+
+    // Running ref to collect src_hat (used instead of src + mean).
+    if (is_bench_mode(CORR)) {
+        ref_args.set(DNNL_ARG_SRC, src_fp);
+        ref_args.set(DNNL_ARG_MEAN, mean_fp);
+        ref_args.set(DNNL_ARG_VARIANCE, var_fp);
+        ref_args.set(DNNL_ARG_SCALE, sc_fp);
+        ref_args.set(DNNL_ARG_SHIFT, sh_fp);
+        ref_args.set(DNNL_ARG_DST, dst_fp);
+        ref_args.set(DNNL_ARG_DST_1, src_hat_fp); // Reference aux arg.
+        ref_args.set(binary_po_args, binary_po_fp);
+
+        if (prb->dir & FLAG_FWD) {
+            std::vector<data_kind_t> kinds {DST};
+            if (!(prb->flags & GLOB_STATS) && !(prb->dir & FLAG_INF)) {
+                kinds.push_back(MEAN);
+                kinds.push_back(VAR);
+            }
+
+            check_correctness(prb, kinds, args, ref_args, setup_cmp, res);
+        }
+    }
+
+    if (prb->dir & FLAG_BWD) {
+        benchdnn_dnnl_wrapper_t<dnnl_primitive_t> tmp_prim;
+        SAFE(init_prim(tmp_prim, init_pd, prb, res, FLAG_BWD, const_fpd), WARN);
+        if (res->state == SKIPPED || res->state == UNIMPLEMENTED) return OK;
+        prim.reset(tmp_prim.release());
+
+        auto const_bpd = query_pd(prim);
+
+        if (check_mem_size(const_bpd) != OK) {
+            return res->state = SKIPPED, res->reason = NOT_ENOUGH_RAM, OK;
+        }
+        const auto &d_data_md = query_md(const_bpd, DNNL_ARG_DIFF_DST);
+        const auto &d_scratchpad_md = query_md(const_bpd, DNNL_ARG_SCRATCHPAD);
+
+        dnn_mem_t d_dst_fp(d_data_md, fp, tag, ref_engine);
+        d_dst_dt = dnn_mem_t(d_data_md, test_engine);
+
+        dnn_mem_t &d_src_fp = d_dst_fp; // in-place in ref code
+        if (!prb->inplace) {
+            placeholder_d_src_dt = dnn_mem_t(d_data_md, test_engine);
+        }
+        dnn_mem_t &d_src_dt = prb->inplace ? d_dst_dt : placeholder_d_src_dt;
+
+        scratchpad_dt = dnn_mem_t(d_scratchpad_md, test_engine);
+
+        SAFE(prepare_bwd(prb, d_dst_dt, d_dst_fp), WARN);
+
+        args.clear();
+        args.set(DNNL_ARG_SRC, src_dt);
+        args.set(DNNL_ARG_MEAN, mean_dt);
+        args.set(DNNL_ARG_VARIANCE, var_dt);
+        args.set(DNNL_ARG_DIFF_DST, d_dst_dt);
+        args.set(DNNL_ARG_SCALE, sc_dt);
+        args.set(DNNL_ARG_SHIFT, sh_dt);
+        args.set(DNNL_ARG_DIFF_SRC, d_src_dt);
+        args.set(DNNL_ARG_DIFF_SCALE, d_sc_dt);
+        args.set(DNNL_ARG_DIFF_SHIFT, d_sh_dt);
+        args.set(DNNL_ARG_SCRATCHPAD, scratchpad_dt);
+
+        SAFE(execute_and_wait(prim, args, res), WARN);
+
+        if (is_bench_mode(CORR)) {
+            ref_args.set(DNNL_ARG_DIFF_DST, d_dst_fp);
+            ref_args.set(DNNL_ARG_DIFF_SRC, d_src_fp);
+            ref_args.set(DNNL_ARG_DIFF_SCALE, d_sc_fp);
+            ref_args.set(DNNL_ARG_DIFF_SHIFT, d_sh_fp);
+
+            std::vector<data_kind_t> kinds {SRC};
+            if (use_sc && (prb->dir & FLAG_WEI)) kinds.push_back(SC);
+            if (use_sh && (prb->dir & FLAG_WEI)) kinds.push_back(SH);
+
+            check_correctness(prb, kinds, args, ref_args, setup_cmp, res);
+        }
+    }
+
+    return measure_perf(res, prim, args);
+}
+
+} // namespace gnorm
@@ -0,0 +1,145 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "utils/parallel.hpp"
+
+#include "gnorm/gnorm.hpp"
+
+namespace gnorm {
+
+void compute_ref_fwd(const prb_t *prb, const args_t &args) {
+    const dnn_mem_t &src = args.find(DNNL_ARG_SRC);
+    const dnn_mem_t &mean = args.find(DNNL_ARG_MEAN);
+    const dnn_mem_t &var = args.find(DNNL_ARG_VARIANCE);
+    const dnn_mem_t &sc = args.find(DNNL_ARG_SCALE);
+    const dnn_mem_t &sh = args.find(DNNL_ARG_SHIFT);
+    const dnn_mem_t &dst = args.find(DNNL_ARG_DST);
+    const dnn_mem_t &src_hat = args.find(DNNL_ARG_DST_1);
+
+    float *dst_ptr = (float *)dst;
+    float *src_hat_ptr = (float *)src_hat;
+
+    const int64_t MB = prb->mb;
+    const int64_t G = prb->g;
+    const int64_t CPG = prb->ic_per_g();
+    const int64_t SP = prb->sp();
+    const bool use_sc = prb->use_sc();
+    const bool use_sh = prb->use_sh();
+    auto v_po_masks = prb->attr.post_ops.get_po_masks();
+
+    benchdnn_parallel_nd(MB, G, [&](int64_t mb, int64_t g) {
+        float smean = mean.get_elem(stat_off(prb, mb, g));
+        float svar = var.get_elem(stat_off(prb, mb, g));
+        float rcp_denom = 1.f / sqrtf(svar + prb->eps);
+
+        for (int64_t c = g * CPG; c < (g + 1) * CPG; ++c) {
+            float gamma = use_sc ? sc.get_elem(c) : 1.f;
+            float beta = use_sh ? sh.get_elem(c) : 0.f;
+
+            for (int64_t sp = 0; sp < SP; ++sp) {
+                auto off = data_off(prb, mb, c, 0, 0, sp);
+                float x_hat = (src.get_elem(off) - smean) * rcp_denom;
+                float res = gamma * x_hat + beta;
+
+                const auto v_po_vals
+                        = prepare_po_vals(dst, args, v_po_masks, off);
+                maybe_post_ops(prb->attr, res, 0.f, v_po_vals);
+                dst_ptr[off] = res;
+                if (prb->dir & FLAG_BWD) src_hat_ptr[off] = x_hat;
+            }
+        }
+    });
+}
+
+void compute_ref_bwd(const prb_t *prb, const args_t &args) {
+    const dnn_mem_t &src_hat = args.find(DNNL_ARG_DST_1);
+    const dnn_mem_t &var = args.find(DNNL_ARG_VARIANCE);
+    const dnn_mem_t &d_dst = args.find(DNNL_ARG_DIFF_DST);
+    const dnn_mem_t &sc = args.find(DNNL_ARG_SCALE);
+    const dnn_mem_t &d_src = args.find(DNNL_ARG_DIFF_SRC);
+    const dnn_mem_t &d_sc = args.find(DNNL_ARG_DIFF_SCALE);
+    const dnn_mem_t &d_sh = args.find(DNNL_ARG_DIFF_SHIFT);
+
+    float *d_src_ptr = (float *)d_src;
+    float *d_sc_ptr = (float *)d_sc;
+    float *d_sh_ptr = (float *)d_sh;
+
+    const int64_t MB = prb->mb;
+    const int64_t G = prb->g;
+    const int64_t CPG = prb->ic_per_g();
+    const int64_t SP = prb->sp();
+    const bool glob_stats = prb->flags & GLOB_STATS;
+    const bool use_sc = prb->use_sc();
+    const bool use_sh = prb->use_sh();
+
+    if ((use_sc || use_sh) && (prb->dir & FLAG_WEI)) {
+        benchdnn_parallel_nd(prb->ic, [&](int64_t c) {
+            float d_gamma = 0;
+            float d_beta = 0;
+
+            for_(int64_t mb = 0; mb < MB; ++mb)
+            for (int64_t sp = 0; sp < SP; ++sp) {
+                auto off = data_off(prb, mb, c, 0, 0, sp);
+                float dd = d_dst.get_elem(off);
+                d_gamma += dd * src_hat.get_elem(off);
+                d_beta += dd;
+            }
+
+            if (use_sc) d_sc_ptr[c] = d_gamma;
+            if (use_sh) d_sh_ptr[c] = d_beta;
+        });
+    }
+
+    const float L = CPG * SP;
+
+    benchdnn_parallel_nd(MB, G, [&](int64_t mb, int64_t g) {
+        float svar = var.get_elem(stat_off(prb, mb, g));
+        float rcp_denom = 1.f / sqrtf(svar + prb->eps);
+
+        // Sums of scaled diff_dst and of its product with src_hat over the
+        // group.
+        float dd_gamma = 0, dd_gamma_x = 0;
+        if (!glob_stats) {
+            for_(int64_t c = g * CPG; c < (g + 1) * CPG; ++c)
+            for (int64_t sp = 0; sp < SP; ++sp) {
+                auto off = data_off(prb, mb, c, 0, 0, sp);
+                float gamma = use_sc ? sc.get_elem(c) : 1.f;
+                float ds = gamma * d_dst.get_elem(off);
+                dd_gamma += ds;
+                dd_gamma_x += ds * src_hat.get_elem(off);
+            }
+        }
+
+        for_(int64_t c = g * CPG; c < (g + 1) * CPG; ++c)
+        for (int64_t sp = 0; sp < SP; ++sp) {
+            auto off = data_off(prb, mb, c, 0, 0, sp);
+            float gamma = use_sc ? sc.get_elem(c) : 1.f;
+            float ds = gamma * d_dst.get_elem(off);
+            if (!glob_stats)
+                ds -= (dd_gamma + src_hat.get_elem(off) * dd_gamma_x) / L;
+
+            d_src_ptr[off] = rcp_denom * ds;
+        }
+    });
+}
+
+void compute_ref(
+        const prb_t *prb, const args_t &args, dnnl_primitive_t prim_ref) {
+    compute_ref_fwd(prb, args);
+    if (prb->dir & FLAG_BWD) compute_ref_bwd(prb, args);
+}
+
+} // namespace gnorm
@@ -29,6 +29,7 @@
 #include "dnnl_common.hpp"
 #include "dnnl_memory.hpp"
 
+#include "binary/binary.hpp"
 #include "bnorm/bnorm.hpp"
 #include "lnorm/lnorm.hpp"
 
@@ -63,6 +64,9 @@ static int prepare_fwd(const prb_t *prb, dnn_mem_t &src, dnn_mem_t &mean,
     const int64_t want_flex_bits = MIN2(6, exact_bits / 2);
 
     check_alg_t alg = prb->check_alg;
+    // RMS normalization doesn't subtract the mean, so it has to be zero to
+    // keep the variance exact.
+    if (prb->use_rms()) alg = ALG_0;
     if (alg == ALG_AUTO) /* choose appropriate checking algorithm */
         alg = (exact_bits - logL) / 2 - 1 >= min_flex_bits ? ALG_1 : ALG_0;
 
@@ -209,7 +213,7 @@ static int prepare_bwd(const prb_t *prb, dnn_mem_t &src, dnn_mem_t &d_dst,
     }
 
     for (int64_t n = 0; n < prb->n; ++n) {
-        const float m = ((float *)mean)[n] = n % 2;
+        const float m = ((float *)mean)[n] = prb->use_rms() ? 0 : n % 2;
 
         /* var + eps \in {1/4, 1, 4} */
         const float ve_denom = 4.f / (1 << 2 * (n % 3));
@@ -285,11 +289,12 @@ static int prepare_bwd(const prb_t *prb, dnn_mem_t &src, dnn_mem_t &d_dst,
 dnnl_status_t init_pd(dnnl_engine_t engine, const prb_t *prb,
         dnnl_primitive_desc_t &lpd, res_t *res, dir_t dir,
         const_dnnl_primitive_desc_t hint) {
-    dnnl_layer_normalization_desc_t ld;
+    dnnl_layer_normalization_v2_desc_t ld;
 
     const int64_t *data_dims = &prb->dims[0];
 
     auto data_d = dnn_mem_t::init_md(prb->ndims, data_dims, prb->dt, prb->tag);
+    auto dst_d = dnn_mem_t::init_md(prb->ndims, data_dims, prb->ddt, prb->tag);
 
     dnnl_memory_desc_t stat_d;
     const dnnl_memory_desc_t *stat_d_ptr = nullptr;
@@ -303,24 +308,28 @@ dnnl_status_t init_pd(dnnl_engine_t engine, const prb_t *prb,
     if (prb->dir & FLAG_FWD) {
         auto prop = prb->dir & FLAG_INF ? dnnl_forward_inference
                                         : dnnl_forward_training;
-        DNN_SAFE_STATUS(dnnl_layer_normalization_forward_desc_init(
-                &ld, prop, &data_d, stat_d_ptr, prb->eps, flags));
+        DNN_SAFE_STATUS(dnnl_layer_normalization_v2_forward_desc_init(&ld,
+                prop, &data_d, &dst_d, stat_d_ptr, prb->eps, flags));
     } else {
         auto diff_data_d
                 = dnn_mem_t::init_md(prb->ndims, data_dims, prb->dt, tag::any);
         auto prop = prb->dir & FLAG_WEI ? dnnl_backward : dnnl_backward_data;
-        DNN_SAFE_STATUS(dnnl_layer_normalization_backward_desc_init(
-                &ld, prop, &diff_data_d, &data_d, stat_d_ptr, prb->eps, flags));
+        DNN_SAFE_STATUS(dnnl_layer_normalization_v2_backward_desc_init(&ld,
+                prop, &diff_data_d, &diff_data_d, &data_d, stat_d_ptr,
+                prb->eps, flags));
     }
 
+    attr_args_t attr_args;
+    attr_args.prepare_output_scales(prb->attr, prb->scales, 1);
+    attr_args.prepare_post_ops_mds(prb->attr, prb->ndims, prb->dims.data());
     auto dnnl_attr = make_benchdnn_dnnl_wrapper(
-            create_dnnl_attr(prb->attr, attr_args_t()));
+            create_dnnl_attr(prb->attr, attr_args));
 
     return dnnl_primitive_desc_create(&lpd, &ld, dnnl_attr, engine, hint);
 }
 
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
-    skip_unimplemented_data_type({prb->dt}, prb->dir, res);
+    skip_unimplemented_data_type({prb->dt, prb->ddt}, prb->dir, res);
     skip_unimplemented_sum_po(prb->attr, res);
 }
 
@@ -330,7 +339,7 @@ void skip_invalid_prb(const prb_t *prb, res_t *res) {
 
     // See `skip_invalid_inplace` for details.
     if (prb->inplace) {
-        skip_invalid_inplace(res, prb->dt, prb->dt, prb->tag, prb->tag);
+        skip_invalid_inplace(res, prb->dt, prb->ddt, prb->tag, prb->tag);
         if (res->state == SKIPPED) return;
     }
 }
@@ -359,6 +368,11 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
     const auto lnorm_add_check =
             [&, kind, prb](
                     const compare::compare_t::driver_check_func_args_t &args) {
+                // Integer destination may be off by one due to rounding of
+                // values close to the middle between two integers.
+                if (kind == DST && is_integral_dt(prb->ddt))
+                    return args.diff <= 1.f;
+
                 const bool has_shift = prb->use_sh() || prb->use_ss();
                 if (!((prb->dir & FLAG_FWD) && kind == DST && has_shift))
                     return false;
@@ -409,6 +423,7 @@ int doit(const prb_t *prb, res_t *res) {
     const bool use_sh = prb->use_sh();
 
     const auto &data_md = query_md(const_pd, DNNL_ARG_SRC);
+    const auto &dst_md = query_md(const_pd, DNNL_ARG_DST);
     const auto &mean_md = query_md(const_pd, DNNL_ARG_MEAN);
     const auto &var_md = query_md(const_pd, DNNL_ARG_VARIANCE);
     const auto &ss_md = query_md(const_pd, DNNL_ARG_SCALE_SHIFT);
@@ -425,7 +440,7 @@ int doit(const prb_t *prb, res_t *res) {
 
     dnn_mem_t &dst_fp = src_fp; // in-place reference
     dnn_mem_t placeholder_dst_dt;
-    if (!prb->inplace) { placeholder_dst_dt = dnn_mem_t(data_md, test_engine); }
+    if (!prb->inplace) { placeholder_dst_dt = dnn_mem_t(dst_md, test_engine); }
     dnn_mem_t &dst_dt = prb->inplace ? src_dt : placeholder_dst_dt;
 
     // On inference w/o global stats the layer norm doesn't require stat
@@ -450,6 +465,12 @@ int doit(const prb_t *prb, res_t *res) {
 
     dnn_mem_t scratchpad_dt(scratchpad_md, test_engine);
 
+    std::vector<dnn_mem_t> binary_po_fp, binary_po_dt;
+    std::vector<int> binary_po_args;
+    SAFE(binary::setup_binary_po(
+                 const_pd, binary_po_args, binary_po_dt, binary_po_fp),
+            WARN);
+
     dnn_mem_t d_dst_dt, placeholder_d_src_dt;
 
     args_t args, ref_args;
@@ -475,6 +496,7 @@ int doit(const prb_t *prb, res_t *res) {
         args.set(DNNL_ARG_SHIFT, sh_dt);
         args.set(DNNL_ARG_DST, dst_dt);
         args.set(DNNL_ARG_SCRATCHPAD, scratchpad_dt);
+        args.set(binary_po_args, binary_po_dt);
 
         SAFE(execute_and_wait(prim, args, res), WARN);
 
@@ -485,6 +507,7 @@ int doit(const prb_t *prb, res_t *res) {
             ref_args.set(use_sc ? DNNL_ARG_SCALE : DNNL_ARG_SCALE_SHIFT, ss_fp);
             ref_args.set(DNNL_ARG_SHIFT, sh_fp);
             ref_args.set(DNNL_ARG_DST, dst_fp);
+            ref_args.set(binary_po_args, binary_po_fp);
 
             std::vector<data_kind_t> kinds {DST};
             if (!(prb->flags & GLOB_STATS) && !(prb->dir & FLAG_INF)) {
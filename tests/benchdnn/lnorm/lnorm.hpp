@@ -42,8 +42,9 @@ const flags_t GLOB_STATS = bnorm::GLOB_STATS;
 const flags_t USE_SCALESHIFT = bnorm::USE_SCALESHIFT;
 const flags_t USE_SCALE = bnorm::USE_SCALE;
 const flags_t USE_SHIFT = bnorm::USE_SHIFT;
-const auto flags2str = bnorm::flags2str;
+const flags_t RMS_NORM = dnnl_rms_norm;
 flags_t str2flags(const char *str);
+std::string flags2str(flags_t flags);
 
 struct settings_t : public base_settings_t {
     settings_t() = default;
@@ -57,12 +58,15 @@ struct settings_t : public base_settings_t {
 
     std::vector<dir_t> dir {FWD_D};
     std::vector<dnnl_data_type_t> dt {dnnl_f32};
+    // `undef` means destination data type is the same as `dt`.
+    std::vector<dnnl_data_type_t> ddt {dnnl_data_type_undef};
     std::vector<std::string> tag {tag::abx}, stat_tag {tag::any};
     std::vector<flags_t> flags {NONE};
     check_alg_t check_alg = check_alg_t::ALG_AUTO;
 
     const char *perf_template_csv() const {
-        static const std::string args = "%dir%,%dt%,%tag%,%stat_tag%,%flags%";
+        static const std::string args
+                = "%dir%,%dt%,%ddt%,%tag%,%stat_tag%,%flags%";
         return perf_template_csv_base(args);
     }
 
@@ -72,38 +76,49 @@ struct settings_t : public base_settings_t {
 struct prb_t : public prb_dims_t {
     prb_t(const prb_dims_t &prb_dims, const std::string &tag,
             const std::string &stat_tag, dir_t dir, dnnl_data_type_t dt,
-            flags_t flags, const attr_t &attr, bool inplace,
-            check_alg_t check_alg)
+            dnnl_data_type_t ddt, flags_t flags, const attr_t &attr,
+            bool inplace, check_alg_t check_alg)
         : prb_dims_t(prb_dims)
         , check_alg(check_alg)
         , tag(tag)
         , stat_tag(stat_tag)
         , dir(dir)
         , dt(dt)
+        , ddt(ddt == dnnl_data_type_undef ? dt : ddt)
         , flags(flags)
         , inplace(inplace)
-        , attr(attr) {
+        , attr(attr)
+        , scales(NULL) {
         n = 1;
         for (int d = 0; d < ndims - 1; d++)
             n *= dims[d];
         c = dims[ndims - 1];
         eps = 1.f / 16;
+
+        generate_oscales();
+    }
+    ~prb_t() {
+        if (scales) zfree(scales);
     }
-    ~prb_t() {}
 
     check_alg_t check_alg;
     std::string tag, stat_tag;
     dir_t dir;
-    dnnl_data_type_t dt;
+    dnnl_data_type_t dt, ddt;
     flags_t flags;
     bool inplace;
     attr_t attr;
     int64_t n, c;
     float eps;
+    float *scales;
 
     bool use_ss() const { return flags & USE_SCALESHIFT; }
     bool use_sc() const { return flags & USE_SCALE; }
     bool use_sh() const { return flags & USE_SHIFT; }
+    bool use_rms() const { return flags & RMS_NORM; }
+
+private:
+    void generate_oscales();
 };
 
 std::ostream &operator<<(std::ostream &s, const prb_t &prb);
@@ -128,6 +143,7 @@ struct perf_report_t : public base_perf_report_t {
     const std::string *name() const override { return &p_->name; }
     const dir_t *dir() const override { return &p_->dir; }
     const dnnl_data_type_t *dt() const override { return &p_->dt; }
+    const dnnl_data_type_t *ddt() const override { return &p_->ddt; }
     const std::string *tag() const override { return &tag_; }
     const std::string *stat_tag() const override { return &stat_tag_; }
 
@@ -34,9 +34,10 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
     const bool use_ss = prb->use_ss();
     const bool use_sc = prb->use_sc();
     const bool use_sh = prb->use_sh();
+    auto v_po_masks = prb->attr.post_ops.get_po_masks();
 
     benchdnn_parallel_nd(prb->n, [&](int64_t n) {
-        float smean = mean.get_elem(n);
+        float smean = prb->use_rms() ? 0.f : mean.get_elem(n);
         float svar = var.get_elem(n);
         float sqrt_var = sqrtf(svar + prb->eps);
 
@@ -46,6 +47,10 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
                                 : use_sh ? sh.get_elem(c) : 0;
             auto off = n * prb->c + c;
             float res = gamma * (src.get_elem(off) - smean) + beta;
+            maybe_oscale(prb->attr, res, prb->scales, 0);
+
+            const auto v_po_vals = prepare_po_vals(dst, args, v_po_masks, off);
+            maybe_post_ops(prb->attr, res, 0.f, v_po_vals);
             dst_ptr[off] = res;
         }
     });
@@ -77,7 +82,7 @@ void compute_ref_bwd(const prb_t *prb, const args_t &args) {
             float d_beta = 0;
 
             for (int64_t n = 0; n < prb->n; ++n) {
-                float smean = mean.get_elem(n);
+                float smean = prb->use_rms() ? 0.f : mean.get_elem(n);
                 float svar = var.get_elem(n);
                 float rcp_denom = 1.f / sqrtf(svar + prb->eps);
                 auto off = n * prb->c + c;
@@ -97,7 +102,7 @@ void compute_ref_bwd(const prb_t *prb, const args_t &args) {
     }
 
     benchdnn_parallel_nd(prb->n, [&](int64_t n) {
-        float smean = mean.get_elem(n);
+        float smean = prb->use_rms() ? 0.f : mean.get_elem(n);
         float svar = var.get_elem(n);
         float rcp_denom = 1.f / sqrtf(svar + prb->eps);
         float dd_gamma = 0, dd_gamma_x = 0;
@@ -118,7 +123,9 @@ void compute_ref_bwd(const prb_t *prb, const args_t &args) {
             float ds = d_dst.get_elem(off) * gamma;
             if (!(prb->flags & GLOB_STATS)) {
                 const float x = src.get_elem(off) - smean;
-                ds -= (dd_gamma + x * dd_gamma_x * rcp_denom) / prb->c;
+                // RMS normalization has no mean, hence no `dd_gamma` term.
+                const float dd_g = prb->use_rms() ? 0.f : dd_gamma;
+                ds -= (dd_g + x * dd_gamma_x * rcp_denom) / prb->c;
             }
 
             d_src_ptr[off] = rcp_denom * ds;
@@ -56,6 +56,10 @@ bool is_norm_alg(const alg_t alg) {
             || alg == alg_t::norm_lp_power_p_sum;
 }
 
+bool is_arg_alg(const alg_t alg) {
+    return alg == alg_t::argmax || alg == alg_t::argmin;
+}
+
 int fill_mem(const prb_t *prb, dnn_mem_t &mem_dt, dnn_mem_t &mem_fp,
         float non_neutral_prob, bool use_reduced_range,
         bool only_positive_values) {
@@ -108,7 +112,8 @@ int fill_src(const prb_t *prb, dnn_mem_t &mem_dt, dnn_mem_t &mem_fp) {
         }
     }
     // There is no accumulation error in case of min or max algorithm
-    const bool is_min_or_max = prb->alg == alg_t::min || prb->alg == alg_t::max;
+    const bool is_min_or_max = prb->alg == alg_t::min || prb->alg == alg_t::max
+            || is_arg_alg(prb->alg);
     // Number of elements that should not exceed datatype limit after reduction
     int safe_to_reduce_elems = nelems_to_reduce;
     if (!is_min_or_max) { // Other algs do computations, reduce final values
@@ -138,8 +143,13 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
 void skip_invalid_prb(const prb_t *prb, res_t *res) {
     // Normalization algorithms don't make sense for integer data type.
     // They also can't have `p` parameter less than one.
-    const bool is_invalid = is_norm_alg(prb->alg)
+    bool is_invalid = is_norm_alg(prb->alg)
             && (is_integral_dt(prb->sdt) || prb->p < 1.f);
+    // Indices are returned as s32 values and post-ops are not applied to
+    // them.
+    is_invalid = is_invalid
+            || (is_arg_alg(prb->alg)
+                    && (prb->ddt != dnnl_s32 || !prb->attr.is_def()));
 
     if (is_invalid) {
         res->state = SKIPPED, res->reason = INVALID_CASE;
@@ -152,7 +162,7 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
     // `5` is a temporary magic const for GPU to pass norm algs.
     // TODO: consider change the filling with power-of-two values for better
     // answer precision.
-    cmp.set_threshold(5 * epsilon_dt(prb->ddt));
+    cmp.set_threshold(is_arg_alg(prb->alg) ? 0.f : 5 * epsilon_dt(prb->ddt));
 }
 
 int doit(const prb_t *prb, res_t *res) {
@@ -37,6 +37,8 @@ enum alg_t {
     norm_lp_sum,
     norm_lp_power_p_max,
     norm_lp_power_p_sum,
+    argmax,
+    argmin,
     reduction_min = min,
     reduction_max = max,
     reduction_mul = mul,
@@ -46,6 +48,8 @@ enum alg_t {
     reduction_norm_lp_sum = norm_lp_sum,
     reduction_norm_lp_power_p_max = norm_lp_power_p_max,
     reduction_norm_lp_power_p_sum = norm_lp_power_p_sum,
+    reduction_argmax = argmax,
+    reduction_argmin = argmin,
 };
 
 alg_t str2alg(const char *str);
@@ -138,6 +142,8 @@ void compute_ref(const prb_t *prb, const args_t &args,
         dnnl_primitive_t prim_ref = nullptr);
 
 int doit(const prb_t *prb, res_t *res);
+
+bool is_arg_alg(const alg_t alg);
 int bench(int argc, char **argv);
 
 } // namespace reduction
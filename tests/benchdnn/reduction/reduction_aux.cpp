@@ -39,6 +39,10 @@ alg_t str2alg(const char *str) {
     CASE(reduction_norm_lp_power_p_max);
     CASE(norm_lp_power_p_sum);
     CASE(reduction_norm_lp_power_p_sum);
+    CASE(argmax);
+    CASE(reduction_argmax);
+    CASE(argmin);
+    CASE(reduction_argmin);
 
 #undef CASE
     assert(!"unknown algorithm");
@@ -55,6 +59,8 @@ const char *alg2str(alg_t alg) {
     if (alg == norm_lp_sum) return "norm_lp_sum";
     if (alg == norm_lp_power_p_max) return "norm_lp_power_p_max";
     if (alg == norm_lp_power_p_sum) return "norm_lp_power_p_sum";
+    if (alg == argmax) return "argmax";
+    if (alg == argmin) return "argmin";
     assert(!"unknown algorithm");
     return "undef";
 }
@@ -69,6 +75,8 @@ dnnl_alg_kind_t alg2alg_kind(alg_t alg) {
     if (alg == norm_lp_sum) return dnnl_reduction_norm_lp_sum;
     if (alg == norm_lp_power_p_max) return dnnl_reduction_norm_lp_power_p_max;
     if (alg == norm_lp_power_p_sum) return dnnl_reduction_norm_lp_power_p_sum;
+    if (alg == argmax) return dnnl_reduction_argmax;
+    if (alg == argmin) return dnnl_reduction_argmin;
     assert(!"unknown algorithm");
     return dnnl_alg_kind_undef;
 }
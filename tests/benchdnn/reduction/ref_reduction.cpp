@@ -37,6 +37,8 @@ void init_acc(float &acc, alg_t alg) {
         case norm_lp_sum:
         case norm_lp_power_p_max:
         case norm_lp_power_p_sum: acc = 0.0f; break;
+        case argmax: acc = -std::numeric_limits<float>::infinity(); break;
+        case argmin: acc = std::numeric_limits<float>::infinity(); break;
         default: assert(!"unknown algorithm");
     }
 }
@@ -110,6 +112,22 @@ void compute_ref(
         const int64_t src_idle_off = md_off_v(src.md_, idle_pos.data());
         float acc {0.0f};
         init_acc(acc, alg);
+        if (is_arg_alg(alg)) {
+            // The first of equal elements is selected.
+            int64_t idx = 0;
+            for (int64_t r = 0; r < reduce_size; ++r) {
+                dims_t reduce_pos = off2dims_idx(reduce_dims, r);
+                const int64_t src_off = src_idle_off
+                        + md_off_v(src.md_, reduce_pos.data());
+                const float val = src.get_elem(src_off);
+                if (alg == argmax ? val > acc : val < acc) {
+                    acc = val;
+                    idx = r;
+                }
+            }
+            dst_ptr[dst_off] = idx;
+            return;
+        }
         for (int64_t r = 0; r < reduce_size; ++r) {
             dims_t reduce_pos = off2dims_idx(reduce_dims, r);
             const int64_t src_reduce_off = md_off_v(src.md_, reduce_pos.data());
@@ -144,6 +144,10 @@ dt_conf_t::entry_t U8_ENTRY_U8 {
         dnnl_u8, 0, UINT8_MAX, MIN_U8, MAX_U8, MEAN_U8, STDDEV_U8, EPS_U8};
 dt_conf_t::entry_t U8_ENTRY_S8 {dnnl_s8, INT8_MIN, INT8_MAX, MIN_S8, MAX_S8,
         MEAN_WEIGHT_S8, STDDEV_S8, EPS_S8};
+// AUGRU attention is quantized as src_layer, keeping it above the shift makes
+// the dequantized attention non-negative.
+dt_conf_t::entry_t U8_ENTRY_U8_ATTENTION {
+        dnnl_u8, 0, UINT8_MAX, MEAN_U8, MAX_U8, MEAN_U8, STDDEV_U8, EPS_U8};
 dt_conf_t::entry_t U8_ENTRY_F32 {dnnl_f32, -f32_max_exact, f32_max_exact,
         MIN_F32, MAX_F32, MEAN_F32, STDDEV_F32, EPS_F32};
 
@@ -169,6 +173,7 @@ CFG(u8u8u8u8) {
     CASE(DST_ITER, U8_ENTRY_U8);
     CASE(DST_ITER_C, U8_ENTRY_F32);
     CASE(DST_LAYER, U8_ENTRY_U8_EXACT);
+    CASE(AUGRU_ATTENTION, U8_ENTRY_U8_ATTENTION);
     END_LIST;
 }
 
@@ -185,6 +190,7 @@ CFG(u8u8u8f32) {
     CASE(DST_ITER, U8_ENTRY_U8);
     CASE(DST_ITER_C, U8_ENTRY_F32);
     CASE(DST_LAYER, U8_ENTRY_F32);
+    CASE(AUGRU_ATTENTION, U8_ENTRY_U8_ATTENTION);
     END_LIST;
 }
 
@@ -201,6 +207,7 @@ CFG(f32u8f32u8) {
     CASE(DST_ITER, U8_ENTRY_F32);
     CASE(DST_ITER_C, U8_ENTRY_F32);
     CASE(DST_LAYER, U8_ENTRY_U8_EXACT);
+    CASE(AUGRU_ATTENTION, U8_ENTRY_U8_ATTENTION);
     END_LIST;
 }
 
@@ -217,6 +224,7 @@ CFG(f32u8f32f32) {
     CASE(DST_ITER, U8_ENTRY_F32);
     CASE(DST_ITER_C, U8_ENTRY_F32);
     CASE(DST_LAYER, U8_ENTRY_F32);
+    CASE(AUGRU_ATTENTION, U8_ENTRY_U8_ATTENTION);
     END_LIST;
 }
 
@@ -309,6 +309,7 @@ int fill_memory(const prb_t &prb, rnn_data_kind_t kind, dnn_mem_t &mem_dt,
             break;
         case SRC_LAYER:
         case SRC_ITER:
+        case AUGRU_ATTENTION:
             benchdnn_parallel_nd(n_chunks, [&](int64_t idx) {
                 fill_chunk(&(prb.data_scale), 1, prb.data_shift, idx);
             });
@@ -734,13 +735,14 @@ void skip_unimplemented_prb(const prb_t *prb_, res_t *res) {
 #endif
 
     // int8 weights reorder does not support non trivial strides;
-    // only LSTM and GRU cell kinds support int8 so far;
+    // only LSTM, GRU and AUGRU cell kinds support int8 so far;
     if (prb.is_int8()) {
         if (!prb.trivial_strides) {
             res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
             return;
         }
-        if (prb.alg != VANILLA_LSTM && prb.alg != VANILLA_GRU) {
+        if (prb.alg != VANILLA_LSTM && prb.alg != VANILLA_GRU
+                && prb.alg != VANILLA_AUGRU) {
             res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
             return;
         }
@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdlib.h>
+
+#include <sstream>
+
+#include "utils/parser.hpp"
+
+#include "topk/topk.hpp"
+
+namespace topk {
+
+void check_correctness(const settings_t &s) {
+    for_(const auto &i_dt : s.dt)
+    for_(const auto &i_stag : s.stag)
+    for_(const auto &i_dtag : s.dtag)
+    for_(const auto &i_alg : s.alg)
+    for_(const auto &i_axis : s.axis)
+    for_(const auto &i_k : s.k)
+    for (const auto &i_scratchpad_mode : s.scratchpad_mode) {
+        auto attr = settings_t::get_attr(i_scratchpad_mode);
+
+        const prb_t prb(
+                s.prb_dims, i_dt, i_stag, i_dtag, i_alg, i_axis, i_k, attr);
+        std::stringstream ss;
+        ss << prb;
+        const std::string cpp_pstr = ss.str();
+        const char *pstr = cpp_pstr.c_str();
+
+        if (s.pattern && !match_regex(pstr, s.pattern)) return;
+        BENCHDNN_PRINT(1, "run: %s\n", pstr);
+
+        res_t res {};
+        doit(&prb, &res);
+
+        parse_result(res, pstr);
+
+        if (is_bench_mode(PERF)) {
+            perf_report_t pr(&prb, s.perf_template);
+            pr.report(&res, pstr);
+        }
+    }
+}
+
+static const std::string help_k
+        = "UINT    (Default: `1`)\n    Specifies the number of elements "
+          "selected along the `axis`.\n";
+
+int bench(int argc, char **argv) {
+    driver_name = "topk";
+    using namespace parser;
+    static settings_t s;
+    static const settings_t def {};
+    for (; argc > 0; --argc, ++argv) {
+        const bool parsed_options = parse_bench_settings(argv[0])
+                || parse_batch(bench, argv[0])
+                || parse_dt(s.dt, def.dt, argv[0])
+                || parse_tag(s.stag, def.stag, argv[0], "stag")
+                || parse_tag(s.dtag, def.dtag, argv[0], "dtag")
+                || parse_alg(s.alg, def.alg, str2alg, argv[0])
+                || parse_axis(s.axis, def.axis, argv[0])
+                || parse_vector_option(s.k, def.k, atoll, argv[0], "k", help_k)
+                || parse_attr_scratchpad_mode(
+                        s.scratchpad_mode, def.scratchpad_mode, argv[0])
+                || parse_test_pattern_match(s.pattern, argv[0])
+                || parse_perf_template(s.perf_template, s.perf_template_def,
+                        s.perf_template_csv(), argv[0])
+                || parse_reset(s, argv[0]) || parse_help(argv[0]);
+        if (!parsed_options) {
+            catch_unknown_options(argv[0]);
+
+            parse_prb_dims(s.prb_dims, argv[0]);
+            check_correctness(s);
+        }
+    }
+
+    return parse_last_argument();
+}
+
+} // namespace topk
@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "utils/parallel.hpp"
+
+#include "topk/topk.hpp"
+
+namespace topk {
+
+void compute_ref(
+        const prb_t *prb, const args_t &args, dnnl_primitive_t prim_ref) {
+    const dnn_mem_t &src = args.find(DNNL_ARG_SRC);
+    const dnn_mem_t &dst = args.find(DNNL_ARG_DST);
+    const dnn_mem_t &indices = args.find(DNNL_ARG_DST_1);
+
+    float *dst_ptr = (float *)dst;
+    float *indices_ptr = (float *)indices;
+
+    int64_t outer_size {1}, inner_size {1};
+    for (int d = 0; d < prb->axis; d++)
+        outer_size *= prb->dims[d];
+    for (int d = prb->axis + 1; d < prb->ndims; d++)
+        inner_size *= prb->dims[d];
+    const int64_t axis_size = prb->dims[prb->axis];
+    const int64_t k = prb->k;
+    const bool is_max = prb->alg == max;
+
+    benchdnn_parallel_nd(outer_size, inner_size, [&](int64_t ou, int64_t in) {
+        std::vector<std::pair<float, int64_t>> row(axis_size);
+        for (int64_t as = 0; as < axis_size; as++) {
+            const int64_t idx = (ou * axis_size + as) * inner_size + in;
+            row[as] = {src.get_elem(idx), as};
+        }
+        // The stable sort keeps the smaller index first among equal values.
+        std::stable_sort(row.begin(), row.end(),
+                [&](const std::pair<float, int64_t> &a,
+                        const std::pair<float, int64_t> &b) {
+                    return is_max ? a.first > b.first : a.first < b.first;
+                });
+        for (int64_t i = 0; i < k; i++) {
+            const int64_t idx = (ou * k + i) * inner_size + in;
+            dst_ptr[idx] = row[i].first;
+            indices_ptr[idx] = row[i].second;
+        }
+    });
+}
+
+} // namespace topk
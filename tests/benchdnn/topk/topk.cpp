@@ -0,0 +1,164 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <random>
+#include <sstream>
+
+#include "utils/parallel.hpp"
+
+#include "dnnl_common.hpp"
+#include "dnnl_memory.hpp"
+
+#include "topk/topk.hpp"
+
+namespace topk {
+
+dnnl_status_t init_pd(dnnl_engine_t engine, const prb_t *prb,
+        dnnl_primitive_desc_t &tpd, res_t *res, dir_t dir,
+        const_dnnl_primitive_desc_t hint) {
+    dnnl_topk_desc_t td;
+
+    const auto dst_dims = prb->dst_dims();
+    auto src_desc = dnn_mem_t::init_md(
+            prb->ndims, prb->dims.data(), prb->dt, prb->stag);
+    auto dst_desc = dnn_mem_t::init_md(
+            prb->ndims, dst_dims.data(), prb->dt, prb->dtag);
+    auto indices_desc = dnn_mem_t::init_md(
+            prb->ndims, dst_dims.data(), dnnl_s32, prb->dtag);
+
+    DNN_SAFE_STATUS(dnnl_topk_desc_init(&td, alg2alg_kind(prb->alg),
+            &src_desc, &dst_desc, &indices_desc, prb->axis));
+
+    auto dnnl_attr = make_benchdnn_dnnl_wrapper(
+            create_dnnl_attr(prb->attr, attr_args_t()));
+
+    return dnnl_primitive_desc_create(&tpd, &td, dnnl_attr, engine, nullptr);
+}
+
+int fill_src(const prb_t *prb, dnn_mem_t &mem_dt, dnn_mem_t &mem_fp) {
+    const auto nelems = mem_fp.nelems();
+    if (nelems == 0) return OK;
+
+    const auto dt = prb->dt;
+    const bool is_signed = dt != dnnl_u8;
+    const bool is_int = is_integral_dt(dt);
+    // A range narrower than the axis provides equal values to check that the
+    // smaller index goes first.
+    const int value_range = is_int ? max_dt(dnnl_s8) : 1000;
+
+    const int64_t n_chunks = 16;
+    const int64_t chunk_size = div_up(nelems, n_chunks);
+
+    benchdnn_parallel_nd(n_chunks, [&](int64_t idx_chunk) {
+        const int64_t idx_start = idx_chunk * chunk_size;
+        const int64_t idx_end = MIN2(idx_start + chunk_size, nelems);
+
+        std::minstd_rand msr(idx_start + 1);
+        msr.discard(1);
+        std::uniform_int_distribution<> igen(1, value_range);
+
+        for (int64_t idx = idx_start; idx < idx_end; ++idx) {
+            const int gen = igen(msr);
+            float value = is_int ? gen : gen / 8.f;
+            if (is_signed && flip_coin(gen, 0.5f)) value = -value;
+            mem_fp.set_elem(idx, round_to_nearest_representable(dt, value));
+        }
+    });
+
+    SAFE(mem_dt.reorder(mem_fp), WARN);
+    return OK;
+}
+
+void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
+    skip_unimplemented_data_type({prb->dt}, prb->dir, res);
+}
+
+void skip_invalid_prb(const prb_t *prb, res_t *res) {
+    const bool is_invalid = prb->axis >= prb->ndims || prb->k < 1
+            || prb->k > prb->dims[prb->axis];
+    if (is_invalid) {
+        res->state = SKIPPED, res->reason = INVALID_CASE;
+        return;
+    }
+}
+
+void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
+        const args_t &ref_args) {
+    // Values are copied from the source, so they match exactly.
+    cmp.set_threshold(0.f);
+}
+
+int doit(const prb_t *prb, res_t *res) {
+    if (bench_mode == LIST) return res->state = LISTED, OK;
+
+    benchdnn_dnnl_wrapper_t<dnnl_primitive_t> prim;
+    SAFE(init_prim(prim, init_pd, prb, res), WARN);
+    if (res->state == SKIPPED || res->state == UNIMPLEMENTED) return OK;
+
+    auto const_pd = query_pd(prim);
+
+    if (check_mem_size(const_pd) != OK) {
+        return res->state = SKIPPED, res->reason = NOT_ENOUGH_RAM, OK;
+    }
+
+    const auto fp_dt = dnnl_f32;
+    const auto abx_tag = tag::abx;
+
+    const auto &test_engine = get_test_engine();
+    const auto &ref_engine = get_cpu_engine();
+
+    const auto &src_md = query_md(const_pd, DNNL_ARG_SRC);
+    const auto &dst_md = query_md(const_pd, DNNL_ARG_DST);
+    const auto &indices_md = query_md(const_pd, DNNL_ARG_DST_1);
+    const auto &scratchpad_md = query_md(const_pd, DNNL_ARG_SCRATCHPAD);
+
+    dnn_mem_t src_fp(src_md, fp_dt, abx_tag, ref_engine);
+    dnn_mem_t src_dt(src_md, test_engine);
+    SAFE(fill_src(prb, src_dt, src_fp), WARN);
+
+    dnn_mem_t dst_fp(dst_md, fp_dt, abx_tag, ref_engine);
+    dnn_mem_t dst_dt(dst_md, test_engine);
+    dnn_mem_t indices_fp(indices_md, fp_dt, abx_tag, ref_engine);
+    dnn_mem_t indices_dt(indices_md, test_engine);
+    dnn_mem_t scratchpad_dt(scratchpad_md, test_engine);
+
+    args_t args, ref_args;
+
+    args.set(DNNL_ARG_SRC, src_dt);
+    args.set(DNNL_ARG_DST, dst_dt);
+    args.set(DNNL_ARG_DST_1, indices_dt);
+    args.set(DNNL_ARG_SCRATCHPAD, scratchpad_dt);
+
+    SAFE(execute_and_wait(prim, args, res), WARN);
+
+    if (is_bench_mode(CORR)) {
+        ref_args.set(DNNL_ARG_SRC, src_fp);
+        ref_args.set(DNNL_ARG_DST, dst_fp);
+        ref_args.set(DNNL_ARG_DST_1, indices_fp);
+
+        check_correctness(prb, {DST}, args, ref_args, setup_cmp, res);
+
+        // Indices have no data kind of their own and are compared here.
+        compare::compare_t cmp;
+        cmp.set_data_kind(DST);
+        setup_cmp(cmp, prb, DST, ref_args);
+        cmp.compare(indices_fp, indices_dt, prb->attr, res);
+    }
+
+    return measure_perf(res, prim, args);
+}
+
+} // namespace topk
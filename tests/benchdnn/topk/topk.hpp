@@ -0,0 +1,129 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef TOPK_HPP
+#define TOPK_HPP
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "dnn_types.hpp"
+#include "dnnl_common.hpp"
+#include "utils/perf_report.hpp"
+#include "utils/settings.hpp"
+
+namespace topk {
+
+enum alg_t {
+    undef,
+    max,
+    min,
+    topk_max = max,
+    topk_min = min,
+};
+
+alg_t str2alg(const char *str);
+const char *alg2str(alg_t alg);
+dnnl_alg_kind_t alg2alg_kind(alg_t alg);
+
+struct settings_t : public base_settings_t {
+    settings_t() = default;
+
+    // ctor to save certain fields from resetting
+    settings_t(const char *perf_template) : settings_t() {
+        this->perf_template = perf_template;
+    }
+
+    prb_dims_t prb_dims;
+
+    std::vector<dnnl_data_type_t> dt {dnnl_f32};
+    std::vector<std::string> stag {tag::abx}, dtag {tag::any};
+    std::vector<alg_t> alg {max};
+    std::vector<int> axis {1};
+    std::vector<int64_t> k {1};
+
+    const char *perf_template_csv() const {
+        static const std::string args = "%dt%,%stag%,%dtag%,%alg%,%axis%";
+        return perf_template_csv_base(args);
+    }
+
+    void reset() { *this = settings_t(perf_template); }
+};
+
+struct prb_t : public prb_dims_t {
+    prb_t(const prb_dims_t &prb_dims, dnnl_data_type_t dt,
+            const std::string &stag, const std::string &dtag, alg_t alg,
+            int axis, int64_t k, const attr_t &attr)
+        : prb_dims_t(prb_dims)
+        , dt(dt)
+        , stag(stag)
+        , dtag(dtag)
+        , alg(alg)
+        , axis(axis)
+        , k(k)
+        , attr(attr) {}
+
+    dir_t dir = FLAG_FWD; // Lack of prop_kind, always considered as forward.
+    dnnl_data_type_t dt;
+    std::string stag, dtag;
+    alg_t alg;
+    int axis;
+    int64_t k;
+    attr_t attr;
+
+    // Dimensions of the values and the indices.
+    dims_t dst_dims() const {
+        dims_t d = dims;
+        d[axis] = k;
+        return d;
+    }
+};
+std::ostream &operator<<(std::ostream &s, const prb_t &prb);
+
+struct perf_report_t : public base_perf_report_t {
+    perf_report_t(const prb_t *prb, const char *perf_template)
+        : base_perf_report_t(perf_template)
+        , p_(prb)
+        , tag_(normalize_tag(p_->stag, p_->ndims)) {}
+
+    void dump_alg(std::ostream &s) const override { s << alg2str(p_->alg); }
+
+    void dump_desc(std::ostream &s) const override {
+        s << static_cast<const prb_dims_t &>(*p_);
+    }
+
+    void dump_desc_csv(std::ostream &s) const override { dump_desc(s); }
+
+    const std::string *name() const override { return &p_->name; }
+    const int *axis() const override { return &p_->axis; }
+    const dnnl_data_type_t *dt() const override { return &p_->dt; }
+    const std::string *tag() const override { return &tag_; }
+
+private:
+    const prb_t *p_;
+    std::string tag_;
+};
+
+void skip_unimplemented_prb(const prb_t *prb, res_t *res);
+void skip_invalid_prb(const prb_t *prb, res_t *res);
+void compute_ref(const prb_t *prb, const args_t &args,
+        dnnl_primitive_t prim_ref = nullptr);
+
+int doit(const prb_t *prb, res_t *res);
+int bench(int argc, char **argv);
+
+} // namespace topk
+
+#endif
@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "topk/topk.hpp"
+
+namespace topk {
+
+alg_t str2alg(const char *str) {
+#define CASE(_alg) \
+    if (!strcasecmp(STRINGIFY(_alg), str)) return _alg
+    CASE(max);
+    CASE(topk_max);
+    CASE(min);
+    CASE(topk_min);
+#undef CASE
+    assert(!"unknown algorithm");
+    return undef;
+}
+
+const char *alg2str(alg_t alg) {
+    if (alg == max) return "max";
+    if (alg == min) return "min";
+    assert(!"unknown algorithm");
+    return "undef";
+}
+
+dnnl_alg_kind_t alg2alg_kind(alg_t alg) {
+    if (alg == max) return dnnl_topk_max;
+    if (alg == min) return dnnl_topk_min;
+    assert(!"unknown algorithm");
+    return dnnl_alg_kind_undef;
+}
+
+std::ostream &operator<<(std::ostream &s, const prb_t &prb) {
+    dump_global_params(s);
+    settings_t def;
+
+    if (canonical || prb.dt != def.dt[0]) s << "--dt=" << prb.dt << " ";
+    if (canonical || prb.stag != def.stag[0]) s << "--stag=" << prb.stag << " ";
+    if (canonical || prb.dtag != def.dtag[0]) s << "--dtag=" << prb.dtag << " ";
+    if (canonical || prb.alg != def.alg[0])
+        s << "--alg=" << alg2str(prb.alg) << " ";
+    if (canonical || prb.axis != def.axis[0]) s << "--axis=" << prb.axis << " ";
+    if (canonical || prb.k != def.k[0]) s << "--k=" << prb.k << " ";
+
+    s << prb.attr;
+    s << static_cast<prb_dims_t>(prb);
+
+    return s;
+}
+
+} // namespace topk
@@ -460,6 +460,19 @@ static bool parse_cpu_isa_hints(
     return parsed;
 }
 
+static bool parse_max_cpu_isa(
+        const char *str, const std::string &option_name = "max-cpu-isa") {
+    static const std::string help
+            = "ISA    (Default: `all`)\n    Limits the ISA used by the CPU "
+              "engine to `ISA`.\n    `ISA` values can be `all`, `sse41`, "
+              "`avx`, `avx2`, `avx2_vnni`, `avx512_core`,\n    "
+              "`avx512_core_vnni`, `avx512_core_bf16` or `avx512_core_amx`.\n";
+    const bool parsed = parse_single_value_option(max_cpu_isa,
+            dnnl_cpu_isa_all, str2cpu_isa, str, option_name, help);
+    if (parsed) init_max_cpu_isa();
+    return parsed;
+}
+
 static bool parse_engine(
         const char *str, const std::string &option_name = "engine") {
     static const std::string help
@@ -687,7 +700,8 @@ bool parse_bench_settings(const char *str) {
             || parse_attr_same_pd_check(str) || parse_canonical(str)
             || parse_cpu_isa_hints(str) || parse_engine(str)
             || parse_fast_ref_gpu(str) || parse_fix_times_per_prb(str)
-            || parse_max_ms_per_prb(str) || parse_mem_check(str)
+            || parse_max_cpu_isa(str) || parse_max_ms_per_prb(str)
+            || parse_mem_check(str)
             || parse_memory_kind(str) || parse_mode(str) || parse_skip_impl(str)
             || parse_start(str) || parse_verbose(str);
 
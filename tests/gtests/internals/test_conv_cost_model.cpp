@@ -0,0 +1,138 @@
+/*******************************************************************************
+* Copyright 2022 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "cpu/x64/jit_conv_cost_model.hpp"
+
+namespace dnnl {
+
+using namespace impl::cpu::x64;
+using conv_cost_model::alg_t;
+using conv_cost_model::problem_t;
+
+namespace {
+problem_t make_problem(impl::data_type_t dt, int mb, int ic, int oc, int ih,
+        int iw, int kh, int kw, int s) {
+    problem_t prb;
+    prb.src_dt = dt;
+    prb.mb = mb;
+    prb.ic = ic;
+    prb.oc = oc;
+    prb.ih = ih;
+    prb.iw = iw;
+    prb.kh = kh;
+    prb.kw = kw;
+    prb.sh = prb.sw = s;
+    prb.oh = (ih - kh) / s + 1;
+    prb.ow = (iw - kw) / s + 1;
+    return prb;
+}
+
+int count(const alg_t *order, int n, alg_t alg) {
+    int c = 0;
+    for (int i = 0; i < n; i++)
+        c += order[i] == alg;
+    return c;
+}
+
+// Checks that the ranked algorithms are the applicable ones and come in the
+// non-decreasing order of their estimates.
+void check_rank(const problem_t &prb, cpu_isa_t isa, int nthr) {
+    alg_t order[conv_cost_model::n_algs];
+    const int n = conv_cost_model::rank(prb, isa, nthr, order);
+
+    const alg_t algs[] = {alg_t::direct, alg_t::brgemm, alg_t::gemm,
+            alg_t::ip, alg_t::winograd};
+    int n_applicable = 0;
+    for (const auto alg : algs) {
+        const double c = conv_cost_model::cycles(prb, alg, isa, nthr);
+        const bool is_applicable
+                = c != impl::nstl::numeric_limits<double>::infinity();
+        n_applicable += is_applicable;
+        ASSERT_EQ(count(order, n, alg), is_applicable ? 1 : 0);
+    }
+    ASSERT_EQ(n, n_applicable);
+
+    for (int i = 1; i < n; i++)
+        ASSERT_LE(conv_cost_model::cycles(prb, order[i - 1], isa, nthr),
+                conv_cost_model::cycles(prb, order[i], isa, nthr));
+}
+} // namespace
+
+TEST(conv_cost_model_test, RankIsSortedByCost) {
+    const auto f32 = impl::data_type::f32;
+    const auto bf16 = impl::data_type::bf16;
+    const auto s8 = impl::data_type::s8;
+    const cpu_isa_t isas[] = {sse41, avx2, avx512_core,
+            avx512_core_bf16_amx_bf16, avx512_core_bf16_amx_int8};
+    for (const auto isa : isas)
+        for (const int nthr : {1, 28}) {
+            check_rank(make_problem(f32, 32, 64, 64, 56, 56, 3, 3, 1), isa,
+                    nthr);
+            check_rank(make_problem(bf16, 1, 256, 512, 28, 28, 1, 1, 1), isa,
+                    nthr);
+            check_rank(make_problem(s8, 8, 32, 64, 112, 112, 3, 3, 2), isa,
+                    nthr);
+            check_rank(make_problem(f32, 64, 512, 1000, 7, 7, 7, 7, 1), isa,
+                    nthr);
+        }
+}
+
+TEST(conv_cost_model_test, Applicability) {
+    const auto f32 = impl::data_type::f32;
+    const auto bf16 = impl::data_type::bf16;
+    const auto inf = impl::nstl::numeric_limits<double>::infinity();
+
+    // Inner product needs the kernel to cover the whole source.
+    const auto fc = make_problem(f32, 64, 512, 1000, 7, 7, 7, 7, 1);
+    const auto conv3x3 = make_problem(f32, 32, 64, 64, 56, 56, 3, 3, 1);
+    ASSERT_NE(conv_cost_model::cycles(fc, alg_t::ip, avx2, 1), inf);
+    ASSERT_EQ(conv_cost_model::cycles(conv3x3, alg_t::ip, avx2, 1), inf);
+
+    // Winograd has neither strided nor bf16 nor pre-avx2 kernels.
+    const auto strided = make_problem(f32, 32, 64, 64, 56, 56, 3, 3, 2);
+    const auto conv3x3_bf16 = make_problem(bf16, 32, 64, 64, 56, 56, 3, 3, 1);
+    ASSERT_NE(conv_cost_model::cycles(conv3x3, alg_t::winograd, avx2, 1), inf);
+    ASSERT_EQ(conv_cost_model::cycles(conv3x3, alg_t::winograd, sse41, 1), inf);
+    ASSERT_EQ(conv_cost_model::cycles(strided, alg_t::winograd, avx2, 1), inf);
+    ASSERT_EQ(conv_cost_model::cycles(
+                      conv3x3_bf16, alg_t::winograd, avx512_core, 1),
+            inf);
+
+    // Brgemm kernels start with avx512_core.
+    ASSERT_EQ(conv_cost_model::cycles(conv3x3, alg_t::brgemm, avx2, 1), inf);
+    ASSERT_NE(
+            conv_cost_model::cycles(conv3x3, alg_t::brgemm, avx512_core, 1),
+            inf);
+
+    // Direct and gemm always apply.
+    for (const auto alg : {alg_t::direct, alg_t::gemm})
+        ASSERT_NE(conv_cost_model::cycles(strided, alg, sse41, 1), inf);
+}
+
+TEST(conv_cost_model_test, AmxPrefersBrgemm) {
+    const auto conv = make_problem(
+            impl::data_type::bf16, 32, 256, 256, 28, 28, 3, 3, 1);
+    alg_t order[conv_cost_model::n_algs];
+    const int n = conv_cost_model::rank(
+            conv, avx512_core_bf16_amx_bf16, 4, order);
+    ASSERT_GT(n, 0);
+    ASSERT_EQ(order[0], alg_t::brgemm);
+}
+
+} // namespace dnnl
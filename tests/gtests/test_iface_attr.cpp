@@ -544,6 +544,116 @@ HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, DepthwiseFusion) {
     }
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, DepthwiseFusionChain) {
+
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind != engine::kind::cpu,
+            "Depthwise fusion is only supported on CPU engine");
+#if DNNL_AARCH64
+    SKIP_IF(true, "Depthwise fusion is not supported on AArch64 at this time");
+#endif
+
+    engine e {engine_kind, 0};
+    stream s(e);
+
+    // The two intermediate tensors take about 270 MB, more than the last
+    // level cache, so the fused chain is executed by several blocks of rows.
+    const memory::dim mb = 1, ic = 8, oc = 32, h = 1024, w = 1024;
+    const auto dt = data_type::f32;
+
+    memory::desc src_md {{mb, ic, h, w}, dt, tag::nhwc};
+    memory::desc wei_md {{oc, ic, 3, 3}, dt, tag::any};
+    memory::desc mid_md {{mb, oc, h, w}, dt, tag::nhwc};
+    memory::desc dw_wei_md {{oc, 1, 1, 3, 3}, dt, tag::any};
+    memory::desc dw_bia_md {{oc}, dt, tag::x};
+    memory::desc dst_md {{mb, oc, h / 2, w / 2}, dt, tag::nhwc};
+
+    auto conv_desc = convolution_forward::desc(prop_kind::forward_inference,
+            algorithm::convolution_direct, src_md, wei_md, mid_md, {1, 1},
+            {1, 1}, {1, 1});
+    auto dw1_desc = convolution_forward::desc(prop_kind::forward_inference,
+            algorithm::convolution_direct, mid_md, dw_wei_md, dw_bia_md,
+            mid_md, {1, 1}, {1, 1}, {1, 1});
+    auto dw2_desc = convolution_forward::desc(prop_kind::forward_inference,
+            algorithm::convolution_direct, mid_md, dw_wei_md, dw_bia_md,
+            dst_md, {2, 2}, {1, 1}, {0, 0});
+
+    dnnl::post_ops ops;
+    ops.append_dw_k3s1p1(dt, dt, dt, 0, std::vector<float>());
+    ops.append_dw_k3s2p1(dt, dt, dt, 0, std::vector<float>());
+    dnnl::primitive_attr attr;
+    attr.set_post_ops(ops);
+
+    convolution_forward::primitive_desc fused_pd;
+    ASSERT_NO_THROW(fused_pd
+            = convolution_forward::primitive_desc(conv_desc, attr, e));
+
+    const int dw1_wei_arg = DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS;
+    const int dw1_bia_arg = DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS;
+    const int dw2_wei_arg
+            = DNNL_ARG_ATTR_MULTIPLE_POST_OP(1) | DNNL_ARG_WEIGHTS;
+    const int dw2_bia_arg = DNNL_ARG_ATTR_MULTIPLE_POST_OP(1) | DNNL_ARG_BIAS;
+    const auto fused_dw1_wei_md
+            = fused_pd.query_md(query::exec_arg_md, dw1_wei_arg);
+    const auto fused_dw2_wei_md
+            = fused_pd.query_md(query::exec_arg_md, dw2_wei_arg);
+    ASSERT_EQ(fused_dw1_wei_md.dims(), dw_wei_md.dims());
+    ASSERT_EQ(fused_dw2_wei_md.dims(), dw_wei_md.dims());
+    ASSERT_EQ(fused_pd.dst_desc(), dst_md);
+
+    memory src(src_md, e);
+    memory user_wei({{oc, ic, 3, 3}, dt, tag::oihw}, e);
+    memory user_dw1_wei({{oc, 1, 1, 3, 3}, dt, tag::goihw}, e);
+    memory user_dw2_wei({{oc, 1, 1, 3, 3}, dt, tag::goihw}, e);
+    memory dw1_bia(dw_bia_md, e), dw2_bia(dw_bia_md, e);
+    fill_data(dt, src, 1.f, 0.5f);
+    fill_data(dt, user_wei, 0.f, 0.25f);
+    fill_data(dt, user_dw1_wei, 0.f, 0.5f);
+    fill_data(dt, user_dw2_wei, 0.f, 0.5f);
+    fill_data(dt, dw1_bia, 0.f, 1.f);
+    fill_data(dt, dw2_bia, 0.f, 1.f);
+
+    auto reordered = [&](memory m, const memory::desc &md) {
+        memory r(md, e);
+        reorder(m, r).execute(s, m, r);
+        return r;
+    };
+
+    // Reference: a chain of separate convolutions.
+    auto conv_pd = convolution_forward::primitive_desc(conv_desc, e);
+    auto dw1_pd = convolution_forward::primitive_desc(dw1_desc, e);
+    auto dw2_pd = convolution_forward::primitive_desc(dw2_desc, e);
+    memory mid1(mid_md, e), mid2(mid_md, e), dst_ref(dst_md, e);
+    convolution_forward(conv_pd).execute(s,
+            {{DNNL_ARG_SRC, src},
+                    {DNNL_ARG_WEIGHTS,
+                            reordered(user_wei, conv_pd.weights_desc())},
+                    {DNNL_ARG_DST, mid1}});
+    convolution_forward(dw1_pd).execute(s,
+            {{DNNL_ARG_SRC, mid1},
+                    {DNNL_ARG_WEIGHTS,
+                            reordered(user_dw1_wei, dw1_pd.weights_desc())},
+                    {DNNL_ARG_BIAS, dw1_bia}, {DNNL_ARG_DST, mid2}});
+    convolution_forward(dw2_pd).execute(s,
+            {{DNNL_ARG_SRC, mid2},
+                    {DNNL_ARG_WEIGHTS,
+                            reordered(user_dw2_wei, dw2_pd.weights_desc())},
+                    {DNNL_ARG_BIAS, dw2_bia}, {DNNL_ARG_DST, dst_ref}});
+
+    memory dst(dst_md, e);
+    convolution_forward(fused_pd).execute(s,
+            {{DNNL_ARG_SRC, src},
+                    {DNNL_ARG_WEIGHTS,
+                            reordered(user_wei, fused_pd.weights_desc())},
+                    {dw1_wei_arg, reordered(user_dw1_wei, fused_dw1_wei_md)},
+                    {dw1_bia_arg, dw1_bia},
+                    {dw2_wei_arg, reordered(user_dw2_wei, fused_dw2_wei_md)},
+                    {dw2_bia_arg, dw2_bia}, {DNNL_ARG_DST, dst}});
+    s.wait();
+
+    compare_data<float>(dst_ref, dst);
+}
+
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, InnerProdBlockedWeights) {
     auto engine_kind = get_test_engine_kind();
     bool skip_test = !DNNL_X64 || (DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE)
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2022 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -69,4 +69,32 @@ TEST_F(pd_test_t, ConvTestEmpty) {
     }
 }
 
+TEST_F(pd_test_t, ConvTestTimeEstimate) {
+    SKIP_IF(!DNNL_X64 || get_test_engine_kind() != engine::kind::cpu,
+            "Time estimate is implemented for x64 CPU only.");
+
+    auto estimate = [&](memory::dim mb, algorithm alg) {
+        const auto dt = memory::data_type::f32;
+        const auto tag = memory::format_tag::any;
+        memory::desc src_md {{mb, 32, 28, 28}, dt, tag};
+        memory::desc wei_md {{64, 32, 3, 3}, dt, tag};
+        memory::desc dst_md {{mb, 64, 28, 28}, dt, tag};
+        auto pd = convolution_forward::primitive_desc {
+                {prop_kind::forward_inference, alg, src_md, wei_md, dst_md,
+                        {1, 1}, {1, 1}, {1, 1}},
+                e};
+        double time = 0;
+        EXPECT_EQ(dnnl_primitive_desc_query(
+                          pd.get(), dnnl_query_time_estimate_f64, 0, &time),
+                dnnl_success);
+        return time;
+    };
+
+    const double t_small = estimate(1, algorithm::convolution_direct);
+    const double t_large = estimate(64, algorithm::convolution_direct);
+    ASSERT_GT(t_small, 0.);
+    ASSERT_GT(t_large, t_small);
+    ASSERT_GT(estimate(64, algorithm::convolution_auto), 0.);
+}
+
 } // namespace dnnl
@@ -35,6 +35,7 @@ protected:
         data_type dat_dt;
         data_type wei_dt;
         bool wino_supported = false;
+        bool inference_only = false;
         bool backward_supported = false;
     } input_f32, input_f16, input_int8;
 
@@ -53,12 +54,16 @@ protected:
         const bool is_cpu = get_test_engine_kind() == engine::kind::cpu;
         const bool is_gpu = get_test_engine_kind() == engine::kind::gpu;
         static const auto isa = get_effective_cpu_isa();
+        static const bool has_avx2 = dnnl::is_superset(isa, cpu_isa::avx2);
         static const bool has_avx512_core
                 = dnnl::is_superset(isa, cpu_isa::avx512_core);
-        input_f32.wino_supported = is_gpu || (is_cpu && has_avx512_core);
+        input_f32.wino_supported = is_gpu || (is_cpu && has_avx2);
+        // avx2 implementation only supports forward inference
+        input_f32.inference_only = is_cpu && !has_avx512_core;
         input_f16.wino_supported = is_gpu;
         input_int8.wino_supported = is_cpu && has_avx512_core;
-        input_f32.backward_supported = is_cpu && impl::dnnl_thr_syncable();
+        input_f32.backward_supported
+                = is_cpu && has_avx512_core && impl::dnnl_thr_syncable();
 #elif DNNL_AARCH64 && DNNL_AARCH64_USE_ACL
         const bool is_cpu = get_test_engine_kind() == engine::kind::cpu;
         input_f32.wino_supported = is_cpu;
@@ -81,7 +86,10 @@ TEST_F(wino_conv_test_t, TestSmallPadding) {
         memory::desc src_md {{1, 16, 7, 7}, input.dat_dt, tag::any};
         memory::desc wei_md {{32, 16, 3, 3}, input.wei_dt, tag::any};
         memory::desc dst_md {{1, 32, 7, 7}, input.dat_dt, tag::any};
-        auto fwd_op_desc = convolution_forward::desc(prop_kind::forward,
+        const auto fwd_prop_kind = input.inference_only
+                ? prop_kind::forward_inference
+                : prop_kind::forward;
+        auto fwd_op_desc = convolution_forward::desc(fwd_prop_kind,
                 algorithm::convolution_winograd, src_md, wei_md, dst_md, {1, 1},
                 {1, 1}, {1, 1});
 
@@ -151,4 +159,44 @@ TEST_F(wino_conv_test_t, TestUnsupportedKernel) {
     }
 }
 
+TEST_F(wino_conv_test_t, TestInferenceMatchesDirect) {
+    const auto &input = input_f32;
+    if (!input.wino_supported || unsupported_data_type(input.dat_dt)) return;
+
+    const memory::dims src_dims {1, 16, 13, 13};
+    const memory::dims wei_dims {32, 16, 3, 3};
+    const memory::dims dst_dims {1, 32, 13, 13};
+    memory::desc src_md {src_dims, input.dat_dt, tag::any};
+    memory::desc wei_md {wei_dims, input.wei_dt, tag::any};
+    memory::desc dst_md {dst_dims, input.dat_dt, tag::any};
+
+    stream strm(eng);
+    memory user_src({src_dims, input.dat_dt, tag::nchw}, eng);
+    memory user_wei({wei_dims, input.wei_dt, tag::oihw}, eng);
+    fill_data<float>(user_src.get_desc().get_size() / sizeof(float), user_src);
+    fill_data<float>(user_wei.get_desc().get_size() / sizeof(float), user_wei);
+
+    auto run_conv = [&](algorithm alg) {
+        auto conv_pd = convolution_forward::primitive_desc(
+                {prop_kind::forward_inference, alg, src_md, wei_md, dst_md,
+                        {1, 1}, {1, 1}, {1, 1}},
+                eng);
+        memory src(conv_pd.src_desc(), eng);
+        memory wei(conv_pd.weights_desc(), eng);
+        memory dst(conv_pd.dst_desc(), eng);
+        reorder(user_src, src).execute(strm, user_src, src);
+        reorder(user_wei, wei).execute(strm, user_wei, wei);
+        convolution_forward(conv_pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}});
+        strm.wait();
+        return dst;
+    };
+
+    memory wino_dst, direct_dst;
+    ASSERT_NO_THROW(wino_dst = run_conv(algorithm::convolution_winograd));
+    ASSERT_NO_THROW(direct_dst = run_conv(algorithm::convolution_direct));
+    compare_data<float>(direct_dst, wino_dst);
+}
+
 } // namespace dnnl
@@ -23,6 +23,10 @@
 
 #include "oneapi/dnnl/dnnl.hpp"
 
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+#include <omp.h>
+#endif
+
 namespace dnnl {
 
 struct test_rnn_sizes_t {
@@ -817,4 +821,334 @@ CPU_INSTANTIATE_TEST_SUITE_P(TestAUGRUlbr, lbr_augru_forward_test_f32,
                                 fmt::undef},
                         test_rnn_sizes_t {1, 1, 5, 1, 4, 4, 4, 4}}));
 
+namespace {
+memory::desc f32_md(const memory::dims &dims, memory::format_tag tag) {
+    return memory::desc(dims, memory::data_type::f32, tag);
+}
+
+// Returns a memory filled with random values around mean.
+memory new_mem(
+        const memory::desc &md, const engine &eng, float mean, float dev) {
+    memory mem(md, eng);
+    fill_data<float>(md.get_size() / sizeof(float), mem, mean, dev);
+    return mem;
+}
+} // namespace
+
+// A ragged minibatch must give the same results as independent runs on each
+// sequence truncated to its own length.
+TEST(rnn_forward_variable_seq_lengths, TestsLSTM) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Variable sequence lengths are supported on CPU only.");
+
+    using tag = memory::format_tag;
+    const memory::dim l = 2, d = 1, t = 6, mb = 4, c = 8, g = 4;
+    const std::vector<int32_t> lengths = {6, 2, 0, 4};
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    auto wei_layer
+            = new_mem(f32_md({l, d, c, g, c}, tag::ldigo), eng, 0.f, 0.2f);
+    auto wei_iter
+            = new_mem(f32_md({l, d, c, g, c}, tag::ldigo), eng, 0.f, 0.2f);
+    auto bias = new_mem(f32_md({l, d, g, c}, tag::ldgo), eng, 0.f, 0.2f);
+
+    const auto run = [&](memory::dim n_iter, memory::dim n_mb,
+                             const memory &src_layer, const memory &src_iter,
+                             const memory &src_iter_c, const memory *seq) {
+        const auto layer_md = f32_md({n_iter, n_mb, c}, tag::tnc);
+        const auto iter_md = f32_md({l, d, n_mb, c}, tag::ldnc);
+        auto desc = lstm_forward::desc(prop_kind::forward_inference,
+                rnn_direction::unidirectional_left2right, layer_md, iter_md,
+                iter_md, wei_layer.get_desc(), wei_iter.get_desc(),
+                bias.get_desc(), layer_md, iter_md, iter_md,
+                seq ? rnn_flags::variable_seq_lengths : rnn_flags::undef);
+        auto pd = lstm_forward::primitive_desc(desc, eng);
+        std::vector<memory> dst {memory(layer_md, eng), memory(iter_md, eng),
+                memory(iter_md, eng)};
+        std::unordered_map<int, memory> args {{DNNL_ARG_SRC_LAYER, src_layer},
+                {DNNL_ARG_SRC_ITER, src_iter},
+                {DNNL_ARG_SRC_ITER_C, src_iter_c},
+                {DNNL_ARG_WEIGHTS_LAYER, wei_layer},
+                {DNNL_ARG_WEIGHTS_ITER, wei_iter}, {DNNL_ARG_BIAS, bias},
+                {DNNL_ARG_DST_LAYER, dst[0]}, {DNNL_ARG_DST_ITER, dst[1]},
+                {DNNL_ARG_DST_ITER_C, dst[2]}};
+        if (seq) args.insert({DNNL_ARG_SEQ_LENGTHS, *seq});
+        lstm_forward(pd).execute(strm, args);
+        strm.wait();
+        return dst;
+    };
+
+    auto src_layer = new_mem(f32_md({t, mb, c}, tag::tnc), eng, 0.f, 1.f);
+    auto src_iter = new_mem(f32_md({l, d, mb, c}, tag::ldnc), eng, 0.f, 1.f);
+    auto src_iter_c = new_mem(f32_md({l, d, mb, c}, tag::ldnc), eng, 0.f, 1.f);
+    memory seq({{mb}, memory::data_type::s32, tag::x}, eng);
+    {
+        auto seq_ptr = map_memory<int32_t>(seq);
+        for (memory::dim b = 0; b < mb; b++)
+            seq_ptr[b] = lengths[b];
+    }
+
+    const auto ragged = run(t, mb, src_layer, src_iter, src_iter_c, &seq);
+    auto dst_layer = map_memory<float>(ragged[0]);
+    auto dst_iter = map_memory<float>(ragged[1]);
+    auto dst_iter_c = map_memory<float>(ragged[2]);
+    auto src_layer_ptr = map_memory<float>(src_layer);
+    auto src_iter_ptr = map_memory<float>(src_iter);
+    auto src_iter_c_ptr = map_memory<float>(src_iter_c);
+
+    const float eps = 1e-5f;
+    for (memory::dim b = 0; b < mb; b++) {
+        const memory::dim len = lengths[b];
+        for (memory::dim it = len; it < t; it++)
+            for (memory::dim ch = 0; ch < c; ch++)
+                ASSERT_EQ(dst_layer[(it * mb + b) * c + ch], 0.f);
+
+        // The states of an empty sequence are passed through.
+        if (len == 0) {
+            for (memory::dim i = 0; i < l * d; i++)
+                for (memory::dim ch = 0; ch < c; ch++) {
+                    const auto off = (i * mb + b) * c + ch;
+                    ASSERT_EQ(dst_iter[off], src_iter_ptr[off]);
+                    ASSERT_EQ(dst_iter_c[off], src_iter_c_ptr[off]);
+                }
+            continue;
+        }
+
+        auto seq_src_layer = memory(f32_md({len, 1, c}, tag::tnc), eng);
+        auto seq_src_iter = memory(f32_md({l, d, 1, c}, tag::ldnc), eng);
+        auto seq_src_iter_c = memory(f32_md({l, d, 1, c}, tag::ldnc), eng);
+        {
+            auto sl = map_memory<float>(seq_src_layer);
+            auto si = map_memory<float>(seq_src_iter);
+            auto sc = map_memory<float>(seq_src_iter_c);
+            for (memory::dim it = 0; it < len; it++)
+                for (memory::dim ch = 0; ch < c; ch++)
+                    sl[it * c + ch] = src_layer_ptr[(it * mb + b) * c + ch];
+            for (memory::dim i = 0; i < l * d; i++)
+                for (memory::dim ch = 0; ch < c; ch++) {
+                    si[i * c + ch] = src_iter_ptr[(i * mb + b) * c + ch];
+                    sc[i * c + ch] = src_iter_c_ptr[(i * mb + b) * c + ch];
+                }
+        }
+        const auto ref = run(
+                len, 1, seq_src_layer, seq_src_iter, seq_src_iter_c, nullptr);
+        auto ref_layer = map_memory<float>(ref[0]);
+        auto ref_iter = map_memory<float>(ref[1]);
+        auto ref_iter_c = map_memory<float>(ref[2]);
+        for (memory::dim it = 0; it < len; it++)
+            for (memory::dim ch = 0; ch < c; ch++)
+                ASSERT_NEAR(dst_layer[(it * mb + b) * c + ch],
+                        ref_layer[it * c + ch], eps);
+        for (memory::dim i = 0; i < l * d; i++)
+            for (memory::dim ch = 0; ch < c; ch++) {
+                const auto off = (i * mb + b) * c + ch;
+                ASSERT_NEAR(dst_iter[off], ref_iter[i * c + ch], eps);
+                ASSERT_NEAR(dst_iter_c[off], ref_iter_c[i * c + ch], eps);
+            }
+    }
+}
+
+// Processing a sequence by chunks with the states updated in place, src_iter
+// and dst_iter sharing the same memory, must give the same results as a
+// single run over the whole sequence.
+TEST(rnn_forward_inplace_states, TestsLSTMandGRU) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "In-place states are tested on CPU only.");
+
+    using tag = memory::format_tag;
+    const memory::dim l = 2, d = 1, t = 4, mb = 2, c = 64;
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+    const auto iter_md = f32_md({l, d, mb, c}, tag::ldnc);
+
+    for (bool is_lstm : {true, false}) {
+        const memory::dim g = is_lstm ? 4 : 3;
+        auto wei_layer
+                = new_mem(f32_md({l, d, c, g, c}, tag::ldigo), eng, 0.f, 0.1f);
+        auto wei_iter
+                = new_mem(f32_md({l, d, c, g, c}, tag::ldigo), eng, 0.f, 0.1f);
+        auto bias = new_mem(f32_md({l, d, g, c}, tag::ldgo), eng, 0.f, 0.1f);
+
+        const auto run = [&](const memory &src_layer, const memory &src_iter,
+                                 const memory &src_iter_c,
+                                 const memory &dst_layer,
+                                 const memory &dst_iter,
+                                 const memory &dst_iter_c) {
+            const auto layer_md = src_layer.get_desc();
+            const auto dir = rnn_direction::unidirectional_left2right;
+            primitive p;
+            if (is_lstm) {
+                auto desc = lstm_forward::desc(prop_kind::forward_inference,
+                        dir, layer_md, iter_md, iter_md, wei_layer.get_desc(),
+                        wei_iter.get_desc(), bias.get_desc(), layer_md,
+                        iter_md, iter_md);
+                p = lstm_forward(lstm_forward::primitive_desc(desc, eng));
+            } else {
+                auto desc = gru_forward::desc(prop_kind::forward_inference,
+                        dir, layer_md, iter_md, wei_layer.get_desc(),
+                        wei_iter.get_desc(), bias.get_desc(), layer_md,
+                        iter_md);
+                p = gru_forward(gru_forward::primitive_desc(desc, eng));
+            }
+            std::unordered_map<int, memory> args {
+                    {DNNL_ARG_SRC_LAYER, src_layer},
+                    {DNNL_ARG_SRC_ITER, src_iter},
+                    {DNNL_ARG_WEIGHTS_LAYER, wei_layer},
+                    {DNNL_ARG_WEIGHTS_ITER, wei_iter}, {DNNL_ARG_BIAS, bias},
+                    {DNNL_ARG_DST_LAYER, dst_layer},
+                    {DNNL_ARG_DST_ITER, dst_iter}};
+            if (is_lstm) {
+                args.insert({DNNL_ARG_SRC_ITER_C, src_iter_c});
+                args.insert({DNNL_ARG_DST_ITER_C, dst_iter_c});
+            }
+            p.execute(strm, args);
+            strm.wait();
+        };
+
+        const auto seq_md = f32_md({t, mb, c}, tag::tnc);
+        auto src_layer = new_mem(seq_md, eng, 0.f, 1.f);
+        auto src_iter = new_mem(iter_md, eng, 0.f, 1.f);
+        auto src_iter_c = new_mem(iter_md, eng, 0.f, 1.f);
+        memory dst_layer(seq_md, eng), dst_iter(iter_md, eng),
+                dst_iter_c(iter_md, eng);
+        run(src_layer, src_iter, src_iter_c, dst_layer, dst_iter, dst_iter_c);
+
+        memory states(iter_md, eng), states_c(iter_md, eng);
+        {
+            auto s = map_memory<float>(states);
+            auto sc = map_memory<float>(states_c);
+            auto si = map_memory<float>(src_iter);
+            auto sic = map_memory<float>(src_iter_c);
+            for (memory::dim i = 0; i < l * d * mb * c; i++) {
+                s[i] = si[i];
+                sc[i] = sic[i];
+            }
+        }
+
+        const float eps = 1e-5f;
+        const auto chunk_md = f32_md({1, mb, c}, tag::tnc);
+        for (memory::dim it = 0; it < t; it++) {
+            memory chunk_src(chunk_md, eng), chunk_dst(chunk_md, eng);
+            {
+                auto cs = map_memory<float>(chunk_src);
+                auto sl = map_memory<float>(src_layer);
+                for (memory::dim i = 0; i < mb * c; i++)
+                    cs[i] = sl[it * mb * c + i];
+            }
+            run(chunk_src, states, states_c, chunk_dst, states, states_c);
+
+            auto cd = map_memory<float>(chunk_dst);
+            auto dl = map_memory<float>(dst_layer);
+            for (memory::dim i = 0; i < mb * c; i++)
+                ASSERT_NEAR(cd[i], dl[it * mb * c + i], eps);
+        }
+
+        auto s = map_memory<float>(states);
+        auto di = map_memory<float>(dst_iter);
+        for (memory::dim i = 0; i < l * d * mb * c; i++)
+            ASSERT_NEAR(s[i], di[i], eps);
+        if (is_lstm) {
+            auto sc = map_memory<float>(states_c);
+            auto dic = map_memory<float>(dst_iter_c);
+            for (memory::dim i = 0; i < l * d * mb * c; i++)
+                ASSERT_NEAR(sc[i], dic[i], eps);
+        }
+    }
+}
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+// A stack computed by several threads must give the same results as the one
+// computed by a single thread. The number of threads of a primitive is fixed
+// at its creation.
+TEST(rnn_forward_threads, TestsLSTMandGRU) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Threads are only set for CPU.");
+
+    using tag = memory::format_tag;
+    struct shape_t {
+        bool is_lstm;
+        memory::dim l, t, mb, c;
+    };
+    const std::vector<shape_t> shapes = {
+            // Wavefronts of cells with their minibatch rows split between
+            // the threads.
+            {false, 3, 4, 7, 16},
+            // A single block of rows, the brgemm layer runs in one parallel
+            // region when the cpu supports it.
+            {true, 1, 4, 2, 128},
+    };
+    const memory::dim d = 1;
+
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+    const int nthr_saved = omp_get_max_threads();
+
+    for (const auto &s : shapes) {
+        const memory::dim g = s.is_lstm ? 4 : 3;
+        const auto layer_md = f32_md({s.t, s.mb, s.c}, tag::tnc);
+        const auto iter_md = f32_md({s.l, d, s.mb, s.c}, tag::ldnc);
+        auto wei_layer = new_mem(
+                f32_md({s.l, d, s.c, g, s.c}, tag::ldigo), eng, 0.f, 0.1f);
+        auto wei_iter = new_mem(
+                f32_md({s.l, d, s.c, g, s.c}, tag::ldigo), eng, 0.f, 0.1f);
+        auto bias
+                = new_mem(f32_md({s.l, d, g, s.c}, tag::ldgo), eng, 0.f, 0.1f);
+        auto src_layer = new_mem(layer_md, eng, 0.f, 1.f);
+        auto src_iter = new_mem(iter_md, eng, 0.f, 1.f);
+        auto src_iter_c = new_mem(iter_md, eng, 0.f, 1.f);
+
+        const auto run = [&](int nthr) {
+            omp_set_num_threads(nthr);
+            const auto dir = rnn_direction::unidirectional_left2right;
+            primitive p;
+            if (s.is_lstm) {
+                auto desc = lstm_forward::desc(prop_kind::forward_inference,
+                        dir, layer_md, iter_md, iter_md, wei_layer.get_desc(),
+                        wei_iter.get_desc(), bias.get_desc(), layer_md,
+                        iter_md, iter_md);
+                p = lstm_forward(lstm_forward::primitive_desc(desc, eng));
+            } else {
+                auto desc = gru_forward::desc(prop_kind::forward_inference,
+                        dir, layer_md, iter_md, wei_layer.get_desc(),
+                        wei_iter.get_desc(), bias.get_desc(), layer_md,
+                        iter_md);
+                p = gru_forward(gru_forward::primitive_desc(desc, eng));
+            }
+            std::vector<memory> dst {memory(layer_md, eng),
+                    memory(iter_md, eng), memory(iter_md, eng)};
+            std::unordered_map<int, memory> args {
+                    {DNNL_ARG_SRC_LAYER, src_layer},
+                    {DNNL_ARG_SRC_ITER, src_iter},
+                    {DNNL_ARG_WEIGHTS_LAYER, wei_layer},
+                    {DNNL_ARG_WEIGHTS_ITER, wei_iter}, {DNNL_ARG_BIAS, bias},
+                    {DNNL_ARG_DST_LAYER, dst[0]}, {DNNL_ARG_DST_ITER, dst[1]}};
+            if (s.is_lstm) {
+                args.insert({DNNL_ARG_SRC_ITER_C, src_iter_c});
+                args.insert({DNNL_ARG_DST_ITER_C, dst[2]});
+            } else
+                dst.pop_back();
+            p.execute(strm, args);
+            strm.wait();
+            omp_set_num_threads(nthr_saved);
+            return dst;
+        };
+
+        const auto ref = run(1);
+        const auto got = run(4);
+
+        const float eps = 1e-5f;
+        for (size_t i = 0; i < ref.size(); i++) {
+            auto ref_ptr = map_memory<float>(ref[i]);
+            auto got_ptr = map_memory<float>(got[i]);
+            const auto nelems = ref[i].get_desc().get_size() / sizeof(float);
+            for (size_t e = 0; e < nelems; e++)
+                ASSERT_NEAR(got_ptr[e], ref_ptr[e], eps);
+        }
+    }
+}
+#endif
+
 } // namespace dnnl